@@ -10,6 +10,7 @@
 #include "HuntingSpirit/Enemies/Base/HSEnemyBase.h"
 #include "HuntingSpirit/Characters/Player/HSPlayerCharacter.h"
 #include "HuntingSpirit/Combat/HSCombatComponent.h"
+#include "HuntingSpirit/Optimization/HSSignificanceManager.h"
 #include "HuntingSpirit/World/Navigation/HSRuntimeNavigation.h"
 #include "HuntingSpirit/World/Navigation/HSNavigationIntegration.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
@@ -89,6 +90,12 @@ void AHSAIControllerBase::BeginPlay()
     // AI 감지 시스템 설정
     SetupAIPerception();
 
+    // 조종 중인 폰과 플레이어의 관련도에 따라 틱/인지 빈도 조절
+    if (UHSSignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UHSSignificanceManager>())
+    {
+        SignificanceManager->RegisterActor(this, EHSSignificanceCategory::AIController);
+    }
+
     // 감지 이벤트 바인딩
     if (AIPerceptionComponent)
     {
@@ -113,6 +120,20 @@ void AHSAIControllerBase::BeginPlay()
     StartAI();
 }
 
+/**
+ * @brief 게임 종료/파괴 시 정리
+ * @details 중요도 관리자에서 등록을 해제합니다 (약참조 정리를 기다리지 않음)
+ */
+void AHSAIControllerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UHSSignificanceManager* SignificanceManager = GetWorld() ? GetWorld()->GetSubsystem<UHSSignificanceManager>() : nullptr)
+    {
+        SignificanceManager->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AHSAIControllerBase::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
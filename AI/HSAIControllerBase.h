@@ -55,6 +55,12 @@ public:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief 게임 종료/파괴 시 정리
+     * @details 중요도 관리 대상에서 제외합니다
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /**
      * @brief 매 프레임 호출되는 업데이트 처리
      * @param DeltaSeconds 이전 프레임과의 시간 차이
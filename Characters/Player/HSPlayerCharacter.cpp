@@ -16,6 +16,7 @@
 #include "EnhancedInputSubsystems.h"
 #include "Animation/AnimInstance.h"
 #include "HuntingSpirit/Core/PlayerController/HSPlayerController.h"
+#include "HuntingSpirit/Core/GameState/HSGameStateBase.h"
 #include "Animation/AnimMontage.h"
 #include "TimerManager.h"
 
@@ -98,6 +99,30 @@ void AHSPlayerCharacter::BeginPlay()
     
     // 스태미너 초기화
     StaminaCurrent = StaminaMax;
+
+    // 게임 상태의 플레이어 인구 조사에 등록 (서버)
+    if (HasAuthority())
+    {
+        if (AHSGameStateBase* HSGameState = GetWorld()->GetGameState<AHSGameStateBase>())
+        {
+            HSGameState->OnPlayerJoined(this);
+        }
+    }
+}
+
+// 제거 또는 레벨 종료 시 호출
+void AHSPlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 게임 상태의 플레이어 인구 조사에서 제외 (서버)
+    if (HasAuthority())
+    {
+        if (AHSGameStateBase* HSGameState = GetWorld() ? GetWorld()->GetGameState<AHSGameStateBase>() : nullptr)
+        {
+            HSGameState->OnPlayerLeft(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 // 매 프레임 호출
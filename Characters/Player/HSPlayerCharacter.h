@@ -166,6 +166,9 @@ protected:
     /** @brief 게임 시작 또는 스폰 시 호출되는 초기화 함수 */
     virtual void BeginPlay() override;
 
+    /** @brief 제거 또는 레벨 종료 시 호출되는 정리 함수 */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /** @brief 카메라 설정을 위한 Spring Arm 컴포넌트 */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera)
     USpringArmComponent* CameraBoom;
@@ -53,6 +53,8 @@ void UHSStatsComponent::BeginPlay()
 
 float UHSStatsComponent::ApplyDamage(float DamageAmount, bool bIgnoreDefense)
 {
+	FlushPendingStatRecalculation();
+
 	if (bIsDead || !AttributeSet)
 	{
 		return 0.0f;
@@ -92,6 +94,8 @@ float UHSStatsComponent::ApplyDamage(float DamageAmount, bool bIgnoreDefense)
 
 void UHSStatsComponent::Heal(float HealAmount)
 {
+	FlushPendingStatRecalculation();
+
 	if (bIsDead || !AttributeSet)
 	{
 		return;
@@ -104,6 +108,8 @@ void UHSStatsComponent::Heal(float HealAmount)
 
 bool UHSStatsComponent::ConsumeMana(float ManaAmount)
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return false;
@@ -121,6 +127,8 @@ bool UHSStatsComponent::ConsumeMana(float ManaAmount)
 
 void UHSStatsComponent::RestoreMana(float ManaAmount)
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return;
@@ -132,6 +140,8 @@ void UHSStatsComponent::RestoreMana(float ManaAmount)
 
 bool UHSStatsComponent::ConsumeStamina(float StaminaAmount)
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return false;
@@ -149,6 +159,8 @@ bool UHSStatsComponent::ConsumeStamina(float StaminaAmount)
 
 void UHSStatsComponent::RestoreStamina(float StaminaAmount)
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return;
@@ -168,6 +180,8 @@ void UHSStatsComponent::GainExperience(int32 ExpAmount)
 
 bool UHSStatsComponent::IsCriticalHit() const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return false;
@@ -179,6 +193,8 @@ bool UHSStatsComponent::IsCriticalHit() const
 
 float UHSStatsComponent::CalculateFinalDamage(float BaseDamage) const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return BaseDamage;
@@ -204,6 +220,8 @@ bool UHSStatsComponent::IsDead() const
 
 float UHSStatsComponent::GetAttackPower() const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return 0.0f;
@@ -214,6 +232,8 @@ float UHSStatsComponent::GetAttackPower() const
 
 float UHSStatsComponent::GetHealthPercent() const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return 0.0f;
@@ -232,6 +252,8 @@ float UHSStatsComponent::GetHealthPercent() const
 
 float UHSStatsComponent::GetCurrentHealth() const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return 0.0f;
@@ -242,6 +264,9 @@ float UHSStatsComponent::GetCurrentHealth() const
 
 void UHSStatsComponent::InitializeStatsForClass(const FName& ClassName)
 {
+	// 대기 중인 버프 재계산을 먼저 반영해야 기반값 역산이 어긋나지 않는다
+	FlushDirtyStats();
+
 	if (ClassName == "Warrior")
 	{
 		InitializeWarriorStats();
@@ -330,6 +355,8 @@ void UHSStatsComponent::HandleLevelUp(int32 NewLevel, int32 StatPoints)
 	{
 		return;
 	}
+
+	FlushDirtyStats();
 	
 	// 레벨업 시 최대치 증가
 	float HealthIncrease = 10.0f * NewLevel;
@@ -430,6 +457,8 @@ void UHSStatsComponent::InitializeMageStats()
 
 float UHSStatsComponent::GetCurrentMana() const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return 0.0f;
@@ -440,6 +469,8 @@ float UHSStatsComponent::GetCurrentMana() const
 
 void UHSStatsComponent::SetCurrentMana(float NewMana)
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return;
@@ -450,6 +481,8 @@ void UHSStatsComponent::SetCurrentMana(float NewMana)
 
 float UHSStatsComponent::GetCurrentStamina() const
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return 0.0f;
@@ -460,6 +493,8 @@ float UHSStatsComponent::GetCurrentStamina() const
 
 void UHSStatsComponent::SetCurrentStamina(float NewStamina)
 {
+	FlushPendingStatRecalculation();
+
 	if (!AttributeSet)
 	{
 		return;
@@ -468,45 +503,51 @@ void UHSStatsComponent::SetCurrentStamina(float NewStamina)
 	AttributeSet->SetStamina(NewStamina);
 }
 
-void UHSStatsComponent::ApplyBuff(const FBuffData& BuffData)
+int32 UHSStatsComponent::ApplyBuff(const FBuffData& BuffData)
 {
 	if (BuffData.BuffID.IsEmpty() || BuffData.BuffType == EBuffType::None)
 	{
-		return;
+		return INDEX_NONE;
 	}
 
-	// 기존 버프 확인
-	FBuffData* ExistingBuff = ActiveBuffs.FindByPredicate([&BuffData](const FBuffData& Buff)
-	{
-		return Buff.BuffID == BuffData.BuffID;
-	});
+	UWorld* World = GetWorld();
+	const float CurrentTime = World ? World->GetTimeSeconds() : 0.0f;
+	const float NewExpireTime = BuffData.Duration > 0.0f ? CurrentTime + BuffData.Duration : TNumericLimits<float>::Max();
 
-	if (ExistingBuff)
+	// 기존 버프 확인 (ID 인덱스 조회)
+	int32 BuffHandle = INDEX_NONE;
+	const int32 ExistingIndex = FindBuffIndex(BuffData.BuffID);
+	if (ExistingIndex != INDEX_NONE)
 	{
-		if (!ExistingBuff->bIsPercentage && FMath::IsNearlyZero(ExistingBuff->FlatValuePerStack))
+		BuffHandle = ActiveBuffHandles[ExistingIndex];
+
+		FBuffData& ExistingBuff = ActiveBuffs[ExistingIndex];
+		if (!ExistingBuff.bIsPercentage && FMath::IsNearlyZero(ExistingBuff.FlatValuePerStack))
 		{
-			ExistingBuff->FlatValuePerStack = ExistingBuff->Value;
+			ExistingBuff.FlatValuePerStack = ExistingBuff.Value;
 		}
-		if (ExistingBuff->bIsPercentage && FMath::IsNearlyZero(ExistingBuff->PercentValuePerStack))
+		if (ExistingBuff.bIsPercentage && FMath::IsNearlyZero(ExistingBuff.PercentValuePerStack))
 		{
-			ExistingBuff->PercentValuePerStack = ExistingBuff->Value;
+			ExistingBuff.PercentValuePerStack = ExistingBuff.Value;
 		}
 
-		if (BuffData.bStackable && ExistingBuff->CurrentStacks < MaxBuffStackCount)
+		if (BuffData.bStackable && ExistingBuff.CurrentStacks < MaxBuffStackCount)
 		{
-			const int32 NewStacks = FMath::Clamp(ExistingBuff->CurrentStacks + 1, 1, MaxBuffStackCount);
-			const int32 StackDelta = NewStacks - ExistingBuff->CurrentStacks;
+			const int32 NewStacks = FMath::Clamp(ExistingBuff.CurrentStacks + 1, 1, MaxBuffStackCount);
+			const int32 StackDelta = NewStacks - ExistingBuff.CurrentStacks;
 			if (StackDelta > 0)
 			{
-				ApplyBuffStacks(*ExistingBuff, StackDelta);
-				ExistingBuff->CurrentStacks = NewStacks;
+				ApplyBuffStacks(ExistingBuff, StackDelta);
+				ExistingBuff.CurrentStacks = NewStacks;
 			}
-			ExistingBuff->RemainingTime = BuffData.Duration;
 		}
-		else
+
+		// 스택 여부와 관계없이 지속 시간 갱신 (이전 힙 항목은 만료 처리 시 무시된다)
+		ExistingBuff.RemainingTime = BuffData.Duration;
+		ActiveBuffExpireTimes[ExistingIndex] = NewExpireTime;
+		if (BuffData.Duration > 0.0f)
 		{
-			// 스택 불가능한 경우 효과는 유지하고 지속 시간만 갱신
-			ExistingBuff->RemainingTime = BuffData.Duration;
+			PushBuffExpiry(NewExpireTime, BuffHandle);
 		}
 	}
 	else
@@ -523,46 +564,48 @@ void UHSStatsComponent::ApplyBuff(const FBuffData& BuffData)
 		}
 		NewBuff.CurrentStacks = FMath::Clamp(NewBuff.CurrentStacks, 1, MaxBuffStackCount);
 		NewBuff.RemainingTime = BuffData.Duration;
-		ActiveBuffs.Add(NewBuff);
-		FBuffData& StoredBuff = ActiveBuffs.Last();
-		
+
+		BuffHandle = NextBuffHandle++;
+		const int32 NewIndex = ActiveBuffs.Add(NewBuff);
+		ActiveBuffExpireTimes.Add(NewExpireTime);
+		ActiveBuffHandles.Add(BuffHandle);
+		BuffIndexByHandle.Add(BuffHandle, NewIndex);
+		BuffHandleByID.Add(NewBuff.BuffID, BuffHandle);
+
 		// 즉시 적용 버프 처리
+		FBuffData& StoredBuff = ActiveBuffs[NewIndex];
 		ApplyBuffStacks(StoredBuff, StoredBuff.CurrentStacks);
-		
-		// 지속 시간이 있는 버프는 타이머 설정
+
+		// 지속 시간이 있는 버프만 만료 힙에 등록
 		if (BuffData.Duration > 0.0f)
 		{
-			FTimerHandle& TimerHandle = BuffTimerHandles.FindOrAdd(BuffData.BuffID);
-			GetWorld()->GetTimerManager().SetTimer(TimerHandle, 
-				[this, BuffID = BuffData.BuffID]() { RemoveBuff(BuffID); }, 
-				BuffData.Duration, false);
+			PushBuffExpiry(NewExpireTime, BuffHandle);
 		}
 	}
+
+	ScheduleNextBuffExpiry();
+	return BuffHandle;
 }
 
 void UHSStatsComponent::RemoveBuff(const FString& BuffID)
 {
-	int32 BuffIndex = ActiveBuffs.IndexOfByPredicate([&BuffID](const FBuffData& Buff)
+	const int32 BuffIndex = FindBuffIndex(BuffID);
+	if (BuffIndex != INDEX_NONE)
 	{
-		return Buff.BuffID == BuffID;
-	});
-	
+		RemoveBuffAt(BuffIndex);
+
+		// 힙에 남은 항목은 무효 처리되므로 다음 만료 시각만 다시 맞춘다
+		ScheduleNextBuffExpiry();
+	}
+}
+
+void UHSStatsComponent::RemoveBuffByHandle(int32 BuffHandle)
+{
+	const int32 BuffIndex = FindBuffIndexByHandle(BuffHandle);
 	if (BuffIndex != INDEX_NONE)
 	{
-		FBuffData& BuffToRemove = ActiveBuffs[BuffIndex];
-		
-		// 버프 효과 제거
-		ApplyBuffStacks(BuffToRemove, -BuffToRemove.CurrentStacks);
-		
-		// 버프 목록에서 제거
-		ActiveBuffs.RemoveAt(BuffIndex);
-		
-		// 타이머 제거
-		if (FTimerHandle* TimerHandle = BuffTimerHandles.Find(BuffID))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-			BuffTimerHandles.Remove(BuffID);
-		}
+		RemoveBuffAt(BuffIndex);
+		ScheduleNextBuffExpiry();
 	}
 }
 
@@ -574,28 +617,225 @@ void UHSStatsComponent::ClearAllBuffs()
 		ApplyBuffStacks(Buff, -Buff.CurrentStacks);
 	}
 	
-	// 버프 목록 초기화
+	// 버프 목록 및 인덱스 초기화
 	ActiveBuffs.Empty();
+	ActiveBuffExpireTimes.Empty();
+	ActiveBuffHandles.Empty();
+	BuffIndexByHandle.Empty();
+	BuffHandleByID.Empty();
+	BuffExpiryHeap.Empty();
 	
-	// 모든 타이머 제거
-	for (auto& TimerPair : BuffTimerHandles)
+	// 만료 타이머 제거
+	if (UWorld* World = GetWorld())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(TimerPair.Value);
+		World->GetTimerManager().ClearTimer(BuffExpiryTimerHandle);
 	}
-	BuffTimerHandles.Empty();
+	ArmedBuffExpiryTime = -1.0f;
 }
 
 bool UHSStatsComponent::HasBuff(const FString& BuffID) const
 {
-	return ActiveBuffs.ContainsByPredicate([&BuffID](const FBuffData& Buff)
-	{
-		return Buff.BuffID == BuffID;
-	});
+	return FindBuffIndex(BuffID) != INDEX_NONE;
 }
 
 TArray<FBuffData> UHSStatsComponent::GetActiveBuffs() const
 {
-	return ActiveBuffs;
+	TArray<FBuffData> Result = ActiveBuffs;
+
+	// 남은 시간은 절대 만료 시각에서 조회 시점에 계산한다
+	if (const UWorld* World = GetWorld())
+	{
+		const float CurrentTime = World->GetTimeSeconds();
+		for (int32 Index = 0; Index < Result.Num(); ++Index)
+		{
+			if (ActiveBuffExpireTimes[Index] < TNumericLimits<float>::Max())
+			{
+				Result[Index].RemainingTime = FMath::Max(0.0f, ActiveBuffExpireTimes[Index] - CurrentTime);
+			}
+		}
+	}
+
+	return Result;
+}
+
+int32 UHSStatsComponent::FindBuffIndex(const FString& BuffID) const
+{
+	if (BuffID.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32* HandlePtr = BuffHandleByID.Find(BuffID);
+	return HandlePtr ? FindBuffIndexByHandle(*HandlePtr) : INDEX_NONE;
+}
+
+int32 UHSStatsComponent::FindBuffIndexByHandle(int32 BuffHandle) const
+{
+	const int32* IndexPtr = BuffIndexByHandle.Find(BuffHandle);
+	return IndexPtr ? *IndexPtr : INDEX_NONE;
+}
+
+void UHSStatsComponent::RemoveBuffAt(int32 BuffIndex)
+{
+	if (!ActiveBuffs.IsValidIndex(BuffIndex))
+	{
+		return;
+	}
+
+	FBuffData& BuffToRemove = ActiveBuffs[BuffIndex];
+	
+	// 버프 효과 제거
+	ApplyBuffStacks(BuffToRemove, -BuffToRemove.CurrentStacks);
+	BuffHandleByID.Remove(BuffToRemove.BuffID);
+	BuffIndexByHandle.Remove(ActiveBuffHandles[BuffIndex]);
+
+	// 스왑 제거 후 마지막 원소의 인덱스 갱신 (힙에 남은 제거된 핸들 항목은 꺼낼 때 무시)
+	ActiveBuffs.RemoveAtSwap(BuffIndex, 1, false);
+	ActiveBuffExpireTimes.RemoveAtSwap(BuffIndex, 1, false);
+	ActiveBuffHandles.RemoveAtSwap(BuffIndex, 1, false);
+	if (ActiveBuffs.IsValidIndex(BuffIndex))
+	{
+		BuffIndexByHandle.Add(ActiveBuffHandles[BuffIndex], BuffIndex);
+	}
+}
+
+void UHSStatsComponent::PushBuffExpiry(float ExpireTime, int32 BuffHandle)
+{
+	// 갱신으로 무효화된 항목이 과도하게 쌓이면 유효 항목만으로 힙을 재구성
+	if (BuffExpiryHeap.Num() > ActiveBuffs.Num() * 4 + 16)
+	{
+		BuffExpiryHeap.Reset();
+		for (int32 Index = 0; Index < ActiveBuffs.Num(); ++Index)
+		{
+			const float BuffExpireTime = ActiveBuffExpireTimes[Index];
+			if (BuffExpireTime < TNumericLimits<float>::Max())
+			{
+				BuffExpiryHeap.Add({ BuffExpireTime, ActiveBuffHandles[Index] });
+			}
+		}
+		BuffExpiryHeap.Heapify(FBuffExpiryEntryPredicate());
+		return;
+	}
+
+	BuffExpiryHeap.HeapPush({ ExpireTime, BuffHandle }, FBuffExpiryEntryPredicate());
+}
+
+void UHSStatsComponent::ScheduleNextBuffExpiry()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 힙 최상단의 무효 항목(제거/갱신된 버프) 정리
+	while (BuffExpiryHeap.Num() > 0)
+	{
+		const FBuffExpiryEntry& Top = BuffExpiryHeap.HeapTop();
+		const int32* IndexPtr = BuffIndexByHandle.Find(Top.BuffHandle);
+		if (IndexPtr && ActiveBuffExpireTimes[*IndexPtr] == Top.ExpireTime)
+		{
+			break;
+		}
+
+		FBuffExpiryEntry Discarded;
+		BuffExpiryHeap.HeapPop(Discarded, FBuffExpiryEntryPredicate(), false);
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (BuffExpiryHeap.Num() == 0)
+	{
+		TimerManager.ClearTimer(BuffExpiryTimerHandle);
+		ArmedBuffExpiryTime = -1.0f;
+		return;
+	}
+
+	// 가장 이른 만료 시각이 바뀌었을 때만 타이머 재설정
+	const float NextExpireTime = BuffExpiryHeap.HeapTop().ExpireTime;
+	if (NextExpireTime == ArmedBuffExpiryTime && TimerManager.IsTimerActive(BuffExpiryTimerHandle))
+	{
+		return;
+	}
+
+	const float Delay = FMath::Max(NextExpireTime - World->GetTimeSeconds(), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(BuffExpiryTimerHandle, this, &UHSStatsComponent::ProcessBuffExpirations, Delay, false);
+	ArmedBuffExpiryTime = NextExpireTime;
+}
+
+void UHSStatsComponent::ProcessBuffExpirations()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	ArmedBuffExpiryTime = -1.0f;
+	const float CurrentTime = World->GetTimeSeconds();
+
+	// 만료 시각이 지난 항목을 한 번에 처리
+	while (BuffExpiryHeap.Num() > 0 && BuffExpiryHeap.HeapTop().ExpireTime <= CurrentTime + KINDA_SMALL_NUMBER)
+	{
+		FBuffExpiryEntry Entry;
+		BuffExpiryHeap.HeapPop(Entry, FBuffExpiryEntryPredicate(), false);
+
+		const int32* IndexPtr = BuffIndexByHandle.Find(Entry.BuffHandle);
+		if (IndexPtr && ActiveBuffExpireTimes[*IndexPtr] == Entry.ExpireTime)
+		{
+			RemoveBuffAt(*IndexPtr);
+		}
+	}
+
+	ScheduleNextBuffExpiry();
+}
+
+void UHSStatsComponent::MarkStatDirty(EBuffType BuffType)
+{
+	DirtyStatMask |= 1u << static_cast<uint32>(BuffType);
+
+	if (bStatRecalculationScheduled)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		bStatRecalculationScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(this, &UHSStatsComponent::FlushDirtyStats);
+	}
+	else
+	{
+		// 월드가 없으면 지연할 수 없으므로 즉시 반영
+		FlushDirtyStats();
+	}
+}
+
+void UHSStatsComponent::FlushDirtyStats()
+{
+	bStatRecalculationScheduled = false;
+
+	uint32 PendingMask = DirtyStatMask;
+	DirtyStatMask = 0;
+
+	while (PendingMask != 0)
+	{
+		const uint32 Bit = FMath::CountTrailingZeros(PendingMask);
+		PendingMask &= PendingMask - 1;
+
+		const EBuffType BuffType = static_cast<EBuffType>(Bit);
+		RecalculateAttributeFromAccumulator(BuffType);
+		CleanupAccumulatorIfNeutral(BuffType);
+	}
+}
+
+void UHSStatsComponent::FlushPendingStatRecalculation() const
+{
+	// 다음 틱 재계산 전에 스탯을 읽는 호출자가 이전 값을 보지 않도록 즉시 반영
+	// (예약된 타이머는 남아 있어도 더티 마스크가 비어 있으면 아무 일도 하지 않음)
+	if (DirtyStatMask != 0)
+	{
+		const_cast<UHSStatsComponent*>(this)->FlushDirtyStats();
+	}
 }
 
 void UHSStatsComponent::ApplyBuffStacks(FBuffData& BuffData, int32 StackDelta)
@@ -691,8 +931,8 @@ void UHSStatsComponent::UpdateStatAccumulator(EBuffType BuffType, bool bIsPercen
 		Accumulator.FlatBonus += DeltaValue;
 	}
 
-	RecalculateAttributeFromAccumulator(BuffType);
-	CleanupAccumulatorIfNeutral(BuffType);
+	// 같은 프레임의 적용/제거를 모아 한 번만 속성에 반영
+	MarkStatDirty(BuffType);
 }
 
 void UHSStatsComponent::RecalculateAttributeFromAccumulator(EBuffType BuffType)
@@ -756,7 +996,10 @@ void UHSStatsComponent::EnsureBaseAttributeCached(EBuffType BuffType)
 	const FBuffStatAccumulator* AccumulatorPtr = BuffAccumulators.Find(BuffType);
 	const bool bHasModifier = AccumulatorPtr && (!FMath::IsNearlyZero(AccumulatorPtr->FlatBonus) || !FMath::IsNearlyZero(AccumulatorPtr->PercentBonus));
 
-	if (!BaseAttributeValues.Contains(BuffType) || !bHasModifier)
+	// 재계산 대기 중인 타입은 속성값이 아직 이전 누적치를 반영하고 있으므로 기반값을 유지
+	const bool bPendingRecalculation = (DirtyStatMask & (1u << static_cast<uint32>(BuffType))) != 0;
+
+	if (!BaseAttributeValues.Contains(BuffType) || (!bHasModifier && !bPendingRecalculation))
 	{
 		BaseAttributeValues.Add(BuffType, ExtractCurrentAttributeValue(BuffType));
 	}
@@ -114,9 +114,9 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
-	/** 속성 세트 가져오기 */
+	/** 속성 세트 가져오기 (대기 중인 버프 재계산을 먼저 반영) */
 	UFUNCTION(BlueprintCallable, Category = "Stats")
-	UHSAttributeSet* GetAttributeSet() const { return AttributeSet; }
+	UHSAttributeSet* GetAttributeSet() const { FlushPendingStatRecalculation(); return AttributeSet; }
 	
 	/** 레벨 시스템 가져오기 */
 	UFUNCTION(BlueprintCallable, Category = "Stats")
@@ -192,13 +192,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stats|Resource")
 	void SetCurrentStamina(float NewStamina);
 	
-	/** 버프 적용 */
+	/** 버프 적용 (적용된 버프의 핸들 반환, 실패 시 INDEX_NONE) */
 	UFUNCTION(BlueprintCallable, Category = "Stats|Buff")
-	void ApplyBuff(const FBuffData& BuffData);
+	int32 ApplyBuff(const FBuffData& BuffData);
 	
 	/** 버프 제거 */
 	UFUNCTION(BlueprintCallable, Category = "Stats|Buff")
 	void RemoveBuff(const FString& BuffID);
+
+	/** ApplyBuff가 반환한 핸들로 버프 제거 (문자열 조회 없음) */
+	UFUNCTION(BlueprintCallable, Category = "Stats|Buff")
+	void RemoveBuffByHandle(int32 BuffHandle);
 	
 	/** 모든 버프 제거 */
 	UFUNCTION(BlueprintCallable, Category = "Stats|Buff")
@@ -262,12 +266,41 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Stats|Combat")
 	bool bIsDead;
 	
-	/** 활성 버프 목록 */
+	/** 활성 버프 목록 (제거 시 스왑 제거되므로 순서 보장 없음) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats|Buff")
 	TArray<FBuffData> ActiveBuffs;
 	
-	/** 버프 타이머 핸들 */
-	TMap<FString, FTimerHandle> BuffTimerHandles;
+	/** ActiveBuffs와 같은 인덱스의 절대 만료 시각 (영구 버프는 float 최대값) */
+	TArray<float> ActiveBuffExpireTimes;
+
+	/** ActiveBuffs와 같은 인덱스의 버프 핸들 (ApplyBuff에서 새 버프마다 발급) */
+	TArray<int32> ActiveBuffHandles;
+
+	/** 버프 핸들 -> ActiveBuffs 인덱스 (만료/재배치 등 내부 관리는 모두 핸들 기준) */
+	TMap<int32, int32> BuffIndexByHandle;
+
+	/** 버프 ID 키 비교 (대소문자 구분 - FName/기본 FString 키는 대소문자를 무시해 다른 버프가 합쳐짐) */
+	struct FBuffIDKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static FORCEINLINE bool Matches(const FString& A, const FString& B)
+		{
+			return A.Equals(B, ESearchCase::CaseSensitive);
+		}
+
+		static FORCEINLINE uint32 GetKeyHash(const FString& Key)
+		{
+			return FCrc::StrCrc32(*Key);
+		}
+	};
+
+	/** 버프 ID -> 버프 핸들 (문자열 ID를 받는 공개 API에서만 조회) */
+	TMap<FString, int32, FDefaultSetAllocator, FBuffIDKeyFuncs> BuffHandleByID;
+
+	/** 다음에 발급할 버프 핸들 */
+	int32 NextBuffHandle = 1;
+
+	/** 모든 버프 만료를 구동하는 단일 타이머 */
+	FTimerHandle BuffExpiryTimerHandle;
 
 private:
 	/** 자동 회복 타이머 핸들 */
@@ -282,6 +315,30 @@ private:
 	TMap<EBuffType, FBuffStatAccumulator> BuffAccumulators;
 	TMap<EBuffType, float> BaseAttributeValues;
 	static constexpr int32 MaxBuffStackCount = 10;
+
+	/** 버프 만료 최소 힙 항목 (갱신된 버프의 이전 항목은 꺼낼 때 무시) */
+	struct FBuffExpiryEntry
+	{
+		float ExpireTime = 0.0f;
+		int32 BuffHandle = INDEX_NONE;
+	};
+
+	struct FBuffExpiryEntryPredicate
+	{
+		bool operator()(const FBuffExpiryEntry& A, const FBuffExpiryEntry& B) const
+		{
+			return A.ExpireTime < B.ExpireTime;
+		}
+	};
+
+	TArray<FBuffExpiryEntry> BuffExpiryHeap;
+
+	/** 현재 타이머가 예약된 만료 시각 (불필요한 타이머 재설정 방지) */
+	float ArmedBuffExpiryTime = -1.0f;
+
+	/** 다음 프레임에 재계산할 스탯 타입 비트마스크 */
+	uint32 DirtyStatMask = 0;
+	bool bStatRecalculationScheduled = false;
 	
 	/** 자동 회복 처리 */
 	void HandleRegeneration();
@@ -298,6 +355,19 @@ private:
 	/** 마법사 클래스 초기 스탯 */
 	void InitializeMageStats();
 	
+	/** 버프 저장소/만료 관리 */
+	int32 FindBuffIndex(const FString& BuffID) const;
+	int32 FindBuffIndexByHandle(int32 BuffHandle) const;
+	void RemoveBuffAt(int32 BuffIndex);
+	void PushBuffExpiry(float ExpireTime, int32 BuffHandle);
+	void ScheduleNextBuffExpiry();
+	void ProcessBuffExpirations();
+
+	/** 스탯 재계산 지연 처리 (프레임당 1회, 재계산 전에 스탯을 읽으면 즉시 반영) */
+	void MarkStatDirty(EBuffType BuffType);
+	void FlushDirtyStats();
+	void FlushPendingStatRecalculation() const;
+
 	/** 버프 효과 적용/제거 */
 	void ApplyBuffStacks(FBuffData& BuffData, int32 StackDelta);
 	void ApplyAllStatsDelta(FBuffData& BuffData, int32 StackDelta);
@@ -4,6 +4,7 @@
 #include "HuntingSpirit/Characters/Base/HSCharacterBase.h"
 #include "HuntingSpirit/Combat/HSHitReactionComponent.h"
 #include "HuntingSpirit/Characters/Stats/HSStatsComponent.h"
+#include "HuntingSpirit/Combat/StatusEffects/HSStatusEffectSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -12,9 +13,8 @@
 // 생성자
 UHSCombatComponent::UHSCombatComponent()
 {
-    // Tick 활성화
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.TickInterval = 0.1f; // 0.1초마다 상태 효과 처리
+    // 상태 효과는 UHSStatusEffectSubsystem이 일괄 처리하므로 Tick 불필요
+    PrimaryComponentTick.bCanEverTick = false;
 
     // 네트워크 복제 활성화
     SetIsReplicatedByDefault(true);
@@ -53,6 +53,17 @@ void UHSCombatComponent::BeginPlay()
     CurrentHealth = MaxHealth;
 }
 
+// 컴포넌트 종료
+void UHSCombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UHSStatusEffectSubsystem* StatusEffectSubsystem = GetStatusEffectSubsystem())
+    {
+        StatusEffectSubsystem->UnregisterComponent(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 // 네트워크 복제 설정
 void UHSCombatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
@@ -63,18 +74,6 @@ void UHSCombatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
     DOREPLIFETIME(UHSCombatComponent, ActiveStatusEffects);
 }
 
-// 매 프레임 호출
-void UHSCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // 상태 효과 처리 (서버에서만)
-    if (GetOwner()->HasAuthority())
-    {
-        ProcessStatusEffects(DeltaTime);
-    }
-}
-
 // 데미지 적용 함수
 FHSDamageResult UHSCombatComponent::ApplyDamage(const FHSDamageInfo& DamageInfo, AActor* DamageInstigator)
 {
@@ -322,16 +321,14 @@ bool UHSCombatComponent::ApplyStatusEffect(const FHSStatusEffect& StatusEffect,
     else
     {
         // 새로운 상태 효과 추가
-        ActiveStatusEffects.Add(StatusEffect);
+        ExistingEffect = &ActiveStatusEffects.Add_GetRef(StatusEffect);
     }
 
-    // 타이머 설정 (기존 타이머가 있으면 갱신)
-    FTimerHandle& TimerHandle = StatusEffectTimerHandles.FindOrAdd(StatusEffect.EffectType);
-    GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-    
-    FTimerDelegate TimerDelegate;
-    TimerDelegate.BindUFunction(this, FName("OnStatusEffectExpired"), (uint8)StatusEffect.EffectType);
-    GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, StatusEffect.Duration, false);
+    // 지속 데미지와 만료는 월드 서브시스템에서 일괄 처리 (기존 항목이면 만료 시각 갱신)
+    if (UHSStatusEffectSubsystem* StatusEffectSubsystem = GetStatusEffectSubsystem())
+    {
+        StatusEffectSubsystem->ApplyEffect(this, *ExistingEffect, EffectInstigator);
+    }
 
     return true;
 }
@@ -344,11 +341,9 @@ void UHSCombatComponent::RemoveStatusEffect(EHSStatusEffectType EffectType)
         return Effect.EffectType == EffectType;
     });
 
-    // 타이머 정리
-    if (FTimerHandle* TimerHandle = StatusEffectTimerHandles.Find(EffectType))
+    if (UHSStatusEffectSubsystem* StatusEffectSubsystem = GetStatusEffectSubsystem())
     {
-        GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-        StatusEffectTimerHandles.Remove(EffectType);
+        StatusEffectSubsystem->RemoveEffect(this, EffectType);
     }
 }
 
@@ -357,12 +352,10 @@ void UHSCombatComponent::ClearAllStatusEffects()
 {
     ActiveStatusEffects.Empty();
 
-    // 모든 타이머 정리
-    for (auto& TimerPair : StatusEffectTimerHandles)
+    if (UHSStatusEffectSubsystem* StatusEffectSubsystem = GetStatusEffectSubsystem())
     {
-        GetWorld()->GetTimerManager().ClearTimer(TimerPair.Value);
+        StatusEffectSubsystem->RemoveAllEffects(this);
     }
-    StatusEffectTimerHandles.Empty();
 }
 
 // 최대 체력 설정
@@ -428,45 +421,31 @@ float UHSCombatComponent::CalculateArmorReduction(float Damage, float Armor, flo
     return Damage * ReductionRatio;
 }
 
-// 상태 효과 처리
-void UHSCombatComponent::ProcessStatusEffects(float DeltaTime)
+// 상태 효과 서브시스템 조회
+UHSStatusEffectSubsystem* UHSCombatComponent::GetStatusEffectSubsystem() const
 {
-    for (const FHSStatusEffect& Effect : ActiveStatusEffects)
-    {
-        switch (Effect.EffectType)
-        {
-            case EHSStatusEffectType::PoisonDot:
-            case EHSStatusEffectType::Burn:
-                // DoT 데미지 적용 (1초마다)
-                ApplyStatusEffectDamage(Effect);
-                break;
-                
-            case EHSStatusEffectType::Slow:
-                // 이동속도 감소는 다른 컴포넌트에서 처리
-                break;
-                
-            default:
-                break;
-        }
-    }
+    const UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UHSStatusEffectSubsystem>() : nullptr;
 }
 
-// 상태 효과 데미지 적용
-void UHSCombatComponent::ApplyStatusEffectDamage(const FHSStatusEffect& Effect)
+// 상태 효과 데미지 적용 (서브시스템 일괄 처리에서 호출, 초당 Intensity 기준 누적분)
+void UHSCombatComponent::ApplyStatusEffectTickDamage(EHSStatusEffectType EffectType, float Damage, AActor* EffectInstigator)
 {
-    if (Effect.Intensity > 0.0f)
+    if (Damage <= 0.0f || IsDead() || !GetOwner() || !GetOwner()->HasAuthority())
     {
-        FHSDamageInfo DotDamageInfo;
-        DotDamageInfo.BaseDamage = Effect.Intensity;
-        DotDamageInfo.DamageType = (Effect.EffectType == EHSStatusEffectType::Burn) ? EHSDamageType::Fire : EHSDamageType::Poison;
-        DotDamageInfo.CalculationMode = EHSDamageCalculationMode::Fixed;
-        
-        // 자기 자신에게 데미지 적용 (무적 상태 무시)
-        bool bWasInvincible = bInvincible;
-        bInvincible = false;
-        ApplyDamage(DotDamageInfo, nullptr);
-        bInvincible = bWasInvincible;
+        return;
     }
+
+    FHSDamageInfo DotDamageInfo;
+    DotDamageInfo.BaseDamage = Damage;
+    DotDamageInfo.DamageType = (EffectType == EHSStatusEffectType::Burn) ? EHSDamageType::Fire : EHSDamageType::Poison;
+    DotDamageInfo.CalculationMode = EHSDamageCalculationMode::Fixed;
+
+    // 자기 자신에게 데미지 적용 (무적 상태 무시)
+    bool bWasInvincible = bInvincible;
+    bInvincible = false;
+    ApplyDamage(DotDamageInfo, EffectInstigator);
+    bInvincible = bWasInvincible;
 }
 
 // 상태 효과 만료 처리
@@ -16,6 +16,7 @@
 
 class AHSCharacterBase;
 class UHSHitReactionComponent;
+class UHSStatusEffectSubsystem;
 
 /**
  * @brief 데미지 수신 시 호출되는 델리게이트
@@ -69,14 +70,6 @@ public:
      */
     UHSCombatComponent();
 
-    /**
-     * @brief 매 프레임마다 호출되는 틱 함수
-     * @param DeltaTime 이전 프레임과의 시간 차이
-     * @param TickType 틱 유형
-     * @param ThisTickFunction 틱 함수 구조체
-     */
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
     /**
      * @brief 네트워크 복제 속성을 설정
      * @param OutLifetimeProps 복제할 속성 목록
@@ -312,6 +305,12 @@ protected:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief 컴포넌트 종료 시 상태 효과 서브시스템에서 등록 해제
+     * @param EndPlayReason 종료 사유
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /**
      * @brief 최대 체력
      */
@@ -388,11 +387,6 @@ protected:
      */
     FTimerHandle InvincibilityTimerHandle;
 
-    /**
-     * @brief 상태 효과별 타이머 핸들 맵
-     */
-    TMap<EHSStatusEffectType, FTimerHandle> StatusEffectTimerHandles;
-
     /**
      * @brief 오너 캐릭터 캐시
      */
@@ -438,6 +432,9 @@ protected:
     float DamageShareRatio = 0.0f;
 
 private:
+    // 상태 효과 서브시스템이 일괄 처리 결과를 적용할 수 있도록 허용
+    friend class UHSStatusEffectSubsystem;
+
     /**
      * @brief 방어력을 통한 데미지 감소를 계산
      * @param Damage 원본 데미지
@@ -448,16 +445,18 @@ private:
     float CalculateArmorReduction(float Damage, float Armor, float ArmorPenetration = 0.0f) const;
 
     /**
-     * @brief 매 프레임마다 상태 효과들을 처리
-     * @param DeltaTime 이전 프레임과의 시간 차이
+     * @brief 월드의 상태 효과 서브시스템을 반환
+     * @return 상태 효과 서브시스템 (없으면 nullptr)
      */
-    void ProcessStatusEffects(float DeltaTime);
+    UHSStatusEffectSubsystem* GetStatusEffectSubsystem() const;
 
     /**
-     * @brief 상태 효과로 인한 데미지를 적용
-     * @param Effect 적용할 상태 효과
+     * @brief 상태 효과 서브시스템이 누적한 지속 데미지를 적용
+     * @param EffectType 데미지를 발생시킨 상태 효과 타입
+     * @param Damage 이번 일괄 처리에서 누적된 데미지
+     * @param EffectInstigator 상태 효과를 적용한 액터
      */
-    void ApplyStatusEffectDamage(const FHSStatusEffect& Effect);
+    void ApplyStatusEffectTickDamage(EHSStatusEffectType EffectType, float Damage, AActor* EffectInstigator);
 
     /**
      * @brief 상태 효과 만료 시 호출되는 함수
@@ -5,6 +5,7 @@
 #include "HuntingSpirit/Characters/Player/HSPlayerCharacter.h"
 #include "HuntingSpirit/Combat/HSCombatComponent.h"
 #include "HuntingSpirit/Optimization/ObjectPool/HSObjectPool.h"
+#include "HuntingSpirit/Optimization/HSSignificanceManager.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Particles/ParticleSystemComponent.h"
@@ -67,6 +68,24 @@ void AHSMagicProjectile::BeginPlay()
     
     // 현재 수명 초기화
     CurrentLifeTime = 0.0f;
+
+    // 수명 관리 틱은 누적 시간 기반이므로 원거리 발사체는 낮은 빈도로 처리
+    if (UHSSignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UHSSignificanceManager>())
+    {
+        SignificanceManager->RegisterActor(this, EHSSignificanceCategory::Projectile);
+    }
+}
+
+// 게임 종료/파괴 시 호출
+void AHSMagicProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 중요도 관리 대상에서 즉시 제외
+    if (UHSSignificanceManager* SignificanceManager = GetWorld() ? GetWorld()->GetSubsystem<UHSSignificanceManager>() : nullptr)
+    {
+        SignificanceManager->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 // 매 프레임 호출
@@ -112,6 +131,13 @@ void AHSMagicProjectile::OnActivated_Implementation()
     
     // 수명 초기화
     CurrentLifeTime = 0.0f;
+
+    // 비활성 동안 Dormant 등급의 긴 틱 간격이 남아 있을 수 있으므로 기준 틱 간격으로 복원 후 다시 등록
+    if (UHSSignificanceManager* SignificanceManager = GetWorld() ? GetWorld()->GetSubsystem<UHSSignificanceManager>() : nullptr)
+    {
+        SignificanceManager->UnregisterActor(this);
+        SignificanceManager->RegisterActor(this, EHSSignificanceCategory::Projectile);
+    }
 }
 
 // 오브젝트 풀에서 비활성화될 때 호출
@@ -138,6 +164,12 @@ void AHSMagicProjectile::OnDeactivated_Implementation()
     // 위치 초기화
     SetActorLocation(FVector::ZeroVector);
     SetActorRotation(FRotator::ZeroRotator);
+
+    // 풀에 있는 동안은 중요도 평가 대상에서 제외 (기준 틱 간격으로 복원됨)
+    if (UHSSignificanceManager* SignificanceManager = GetWorld() ? GetWorld()->GetSubsystem<UHSSignificanceManager>() : nullptr)
+    {
+        SignificanceManager->UnregisterActor(this);
+    }
 }
 
 // 오브젝트 풀에서 생성될 때 호출
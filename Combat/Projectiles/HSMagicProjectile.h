@@ -42,6 +42,9 @@ public:
 protected:
     // 게임 시작 시 호출
     virtual void BeginPlay() override;
+
+    // 게임 종료/파괴 시 호출
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     
     // 매 프레임 호출
     virtual void Tick(float DeltaTime) override;
@@ -0,0 +1,360 @@
+// HuntingSpirit Game - Status Effect Subsystem Implementation
+
+#include "HSStatusEffectSubsystem.h"
+#include "HuntingSpirit/Combat/HSCombatComponent.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+void UHSStatusEffectSubsystem::Deinitialize()
+{
+    OwnerHandles.Empty();
+    EffectTypes.Empty();
+    Intensities.Empty();
+    ExpireTimes.Empty();
+    LastDamageTimes.Empty();
+    Instigators.Empty();
+    PendingDamage.Empty();
+    PendingRemoval.Empty();
+    EffectIndexByKey.Empty();
+    OwnerComponents.Empty();
+    OwnerComponentKeys.Empty();
+    FreeOwnerHandles.Empty();
+    OwnerHandleByComponent.Empty();
+    DeferredHandleReleases.Empty();
+    DeferredApplies.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UHSStatusEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHSStatusEffectSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHSStatusEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UHSStatusEffectSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const int32 EffectCount = EffectTypes.Num();
+    UWorld* World = GetWorld();
+    if (EffectCount == 0 || !World)
+    {
+        return;
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+
+    // 1. 평가: 효과별로 독립적이므로 대량일 때 병렬 수행
+    ParallelFor(EffectCount, [this, CurrentTime](int32 Index)
+    {
+        float Damage = 0.0f;
+        if (IsPeriodicDamageEffect(EffectTypes[Index]))
+        {
+            // 마지막 적용 이후 경과 시간만큼 초당 데미지를 적용 (만료 시각 이후는 제외)
+            const float EvaluateUntil = FMath::Min(CurrentTime, ExpireTimes[Index]);
+            const float Elapsed = EvaluateUntil - LastDamageTimes[Index];
+            if (Elapsed > 0.0f)
+            {
+                Damage = Intensities[Index] * Elapsed;
+                LastDamageTimes[Index] = EvaluateUntil;
+            }
+        }
+
+        PendingDamage[Index] = Damage;
+        PendingRemoval[Index] = (CurrentTime >= ExpireTimes[Index]) ? EPendingRemoval::Expired : EPendingRemoval::None;
+    }, EffectCount < ParallelEvaluationThreshold);
+
+    bIsProcessingBatch = true;
+
+    // 2. 데미지 일괄 적용 (게임 스레드)
+    TArray<FHSStatusEffectDamageEvent> DamageEvents;
+    for (int32 Index = 0; Index < EffectCount; ++Index)
+    {
+        UHSCombatComponent* Component = OwnerComponents[OwnerHandles[Index]].Get();
+        if (!Component)
+        {
+            PendingRemoval[Index] = EPendingRemoval::Removed;
+            continue;
+        }
+
+        // 앞선 데미지로 사망해 제거된 효과는 건너뜀
+        if (PendingDamage[Index] <= 0.0f || PendingRemoval[Index] == EPendingRemoval::Removed)
+        {
+            continue;
+        }
+
+        Component->ApplyStatusEffectTickDamage(EffectTypes[Index], PendingDamage[Index], Instigators[Index].Get());
+
+        FHSStatusEffectDamageEvent& DamageEvent = DamageEvents.AddDefaulted_GetRef();
+        DamageEvent.Target = Component->GetOwner();
+        DamageEvent.EffectType = EffectTypes[Index];
+        DamageEvent.Damage = PendingDamage[Index];
+    }
+
+    bIsProcessingBatch = false;
+
+    // 3. 만료/제거 정리 - 뒤에서부터 스왑 제거하여 처리 대상 인덱스 보존
+    TArray<TPair<TWeakObjectPtr<UHSCombatComponent>, EHSStatusEffectType>> ExpiredEffects;
+    for (int32 Index = EffectTypes.Num() - 1; Index >= 0; --Index)
+    {
+        const EPendingRemoval Removal = PendingRemoval[Index];
+        if (Removal == EPendingRemoval::None)
+        {
+            continue;
+        }
+
+        const int32 OwnerHandle = OwnerHandles[Index];
+        if (Removal == EPendingRemoval::Expired)
+        {
+            ExpiredEffects.Emplace(OwnerComponents[OwnerHandle], EffectTypes[Index]);
+        }
+
+        // EndPlay 없이 소멸한 소유자는 2단계에서 모든 효과가 제거 표시되므로 핸들도 반납
+        // (같은 소유자의 효과가 여럿이면 중복 추가되지만 반납은 한 번만 처리됨)
+        if (!OwnerComponents[OwnerHandle].IsValid())
+        {
+            DeferredHandleReleases.Add(OwnerHandle);
+        }
+
+        EraseEffectAt(Index);
+    }
+
+    for (const int32 OwnerHandle : DeferredHandleReleases)
+    {
+        ReleaseOwnerHandle(OwnerHandle);
+    }
+    DeferredHandleReleases.Reset();
+
+    LastBatchDamageEventCount = DamageEvents.Num();
+    LastBatchExpiredCount = ExpiredEffects.Num();
+
+    // 4. 만료 통지
+    for (const TPair<TWeakObjectPtr<UHSCombatComponent>, EHSStatusEffectType>& Expired : ExpiredEffects)
+    {
+        if (UHSCombatComponent* Component = Expired.Key.Get())
+        {
+            Component->OnStatusEffectExpired(Expired.Value);
+        }
+    }
+
+    // 5. 일괄 처리 중 들어온 효과 적용 - 제거와 핸들 반납이 모두 끝난 뒤에 적용해야
+    //    같은 배치에서 해제 후 재적용된 효과가 반납된 핸들에 남지 않음
+    if (DeferredApplies.Num() > 0)
+    {
+        TArray<FDeferredEffectApply> Applies = MoveTemp(DeferredApplies);
+        DeferredApplies.Reset();
+        for (const FDeferredEffectApply& Apply : Applies)
+        {
+            if (UHSCombatComponent* Component = Apply.Component.Get())
+            {
+                ApplyEffect(Component, Apply.Effect, Apply.Instigator.Get());
+            }
+        }
+    }
+
+    // 6. 데미지 이벤트 일괄 브로드캐스트
+    if (DamageEvents.Num() > 0)
+    {
+        OnStatusEffectDamageBatch.Broadcast(DamageEvents);
+    }
+}
+
+void UHSStatusEffectSubsystem::ApplyEffect(UHSCombatComponent* Component, const FHSStatusEffect& Effect, AActor* EffectInstigator)
+{
+    UWorld* World = GetWorld();
+    if (!Component || !World || Effect.EffectType == EHSStatusEffectType::None)
+    {
+        return;
+    }
+
+    if (bIsProcessingBatch)
+    {
+        FDeferredEffectApply& Apply = DeferredApplies.AddDefaulted_GetRef();
+        Apply.Component = Component;
+        Apply.Effect = Effect;
+        Apply.Instigator = EffectInstigator;
+        return;
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+    const int32 OwnerHandle = AcquireOwnerHandle(Component);
+    const uint64 EffectKey = MakeEffectKey(OwnerHandle, Effect.EffectType);
+
+    int32 EffectIndex = INDEX_NONE;
+    if (const int32* ExistingIndex = EffectIndexByKey.Find(EffectKey))
+    {
+        // 갱신 시 마지막 적용 시각은 유지 (이미 적용된 구간을 다시 적용하지 않음)
+        EffectIndex = *ExistingIndex;
+    }
+    else
+    {
+        EffectIndex = EffectTypes.Num();
+        OwnerHandles.Add(OwnerHandle);
+        EffectTypes.Add(Effect.EffectType);
+        Intensities.AddZeroed();
+        ExpireTimes.AddZeroed();
+        LastDamageTimes.Add(CurrentTime);
+        Instigators.AddDefaulted();
+        PendingDamage.AddZeroed();
+        PendingRemoval.Add(EPendingRemoval::None);
+        EffectIndexByKey.Add(EffectKey, EffectIndex);
+    }
+
+    Intensities[EffectIndex] = Effect.Intensity;
+    ExpireTimes[EffectIndex] = CurrentTime + Effect.Duration;
+    Instigators[EffectIndex] = EffectInstigator;
+}
+
+void UHSStatusEffectSubsystem::RemoveEffect(UHSCombatComponent* Component, EHSStatusEffectType EffectType)
+{
+    CancelDeferredApplies(Component, EffectType);
+
+    const int32* OwnerHandle = OwnerHandleByComponent.Find(Component);
+    if (!OwnerHandle)
+    {
+        return;
+    }
+
+    if (const int32* EffectIndex = EffectIndexByKey.Find(MakeEffectKey(*OwnerHandle, EffectType)))
+    {
+        RemoveEffectAt(*EffectIndex);
+    }
+}
+
+void UHSStatusEffectSubsystem::RemoveAllEffects(UHSCombatComponent* Component)
+{
+    CancelDeferredApplies(Component, EHSStatusEffectType::None);
+
+    const int32* OwnerHandle = OwnerHandleByComponent.Find(Component);
+    if (!OwnerHandle)
+    {
+        return;
+    }
+
+    const int32 Handle = *OwnerHandle;
+    const int64 MaxEffectType = StaticEnum<EHSStatusEffectType>()->GetMaxEnumValue();
+    for (int64 TypeValue = 0; TypeValue <= MaxEffectType; ++TypeValue)
+    {
+        if (const int32* EffectIndex = EffectIndexByKey.Find(MakeEffectKey(Handle, static_cast<EHSStatusEffectType>(TypeValue))))
+        {
+            RemoveEffectAt(*EffectIndex);
+        }
+    }
+}
+
+void UHSStatusEffectSubsystem::UnregisterComponent(UHSCombatComponent* Component)
+{
+    RemoveAllEffects(Component);
+
+    if (const int32* OwnerHandle = OwnerHandleByComponent.Find(Component))
+    {
+        if (bIsProcessingBatch)
+        {
+            DeferredHandleReleases.AddUnique(*OwnerHandle);
+        }
+        else
+        {
+            ReleaseOwnerHandle(*OwnerHandle);
+        }
+    }
+}
+
+void UHSStatusEffectSubsystem::CancelDeferredApplies(const UHSCombatComponent* Component, EHSStatusEffectType EffectType)
+{
+    // 적용 요청 뒤에 온 제거 요청이 우선하도록 대기 중인 적용을 취소 (None이면 해당 컴포넌트 전체)
+    DeferredApplies.RemoveAll([Component, EffectType](const FDeferredEffectApply& Apply)
+    {
+        return Apply.Component == Component && (EffectType == EHSStatusEffectType::None || Apply.Effect.EffectType == EffectType);
+    });
+}
+
+bool UHSStatusEffectSubsystem::IsPeriodicDamageEffect(EHSStatusEffectType EffectType)
+{
+    return EffectType == EHSStatusEffectType::Burn || EffectType == EHSStatusEffectType::PoisonDot;
+}
+
+uint64 UHSStatusEffectSubsystem::MakeEffectKey(int32 OwnerHandle, EHSStatusEffectType EffectType)
+{
+    return (static_cast<uint64>(OwnerHandle) << 8) | static_cast<uint64>(EffectType);
+}
+
+int32 UHSStatusEffectSubsystem::AcquireOwnerHandle(UHSCombatComponent* Component)
+{
+    if (const int32* ExistingHandle = OwnerHandleByComponent.Find(Component))
+    {
+        return *ExistingHandle;
+    }
+
+    int32 NewHandle = INDEX_NONE;
+    if (FreeOwnerHandles.Num() > 0)
+    {
+        NewHandle = FreeOwnerHandles.Pop(false);
+        OwnerComponents[NewHandle] = Component;
+        OwnerComponentKeys[NewHandle] = Component;
+    }
+    else
+    {
+        NewHandle = OwnerComponents.Add(Component);
+        OwnerComponentKeys.Add(Component);
+    }
+
+    OwnerHandleByComponent.Add(Component, NewHandle);
+    return NewHandle;
+}
+
+void UHSStatusEffectSubsystem::ReleaseOwnerHandle(int32 OwnerHandle)
+{
+    // 이미 반납된 핸들은 무시 (키가 기본값)
+    if (!OwnerComponentKeys.IsValidIndex(OwnerHandle) || OwnerComponentKeys[OwnerHandle] == TObjectKey<UHSCombatComponent>())
+    {
+        return;
+    }
+
+    OwnerHandleByComponent.Remove(OwnerComponentKeys[OwnerHandle]);
+    OwnerComponentKeys[OwnerHandle] = TObjectKey<UHSCombatComponent>();
+    OwnerComponents[OwnerHandle].Reset();
+    FreeOwnerHandles.Add(OwnerHandle);
+}
+
+void UHSStatusEffectSubsystem::RemoveEffectAt(int32 EffectIndex)
+{
+    if (!EffectTypes.IsValidIndex(EffectIndex))
+    {
+        return;
+    }
+
+    // 일괄 처리 중에는 표시만 하고 정리 단계에서 제거
+    if (bIsProcessingBatch)
+    {
+        PendingRemoval[EffectIndex] = EPendingRemoval::Removed;
+        return;
+    }
+
+    EraseEffectAt(EffectIndex);
+}
+
+void UHSStatusEffectSubsystem::EraseEffectAt(int32 EffectIndex)
+{
+    EffectIndexByKey.Remove(MakeEffectKey(OwnerHandles[EffectIndex], EffectTypes[EffectIndex]));
+
+    // 마지막 효과를 빈 자리로 옮기고 인덱스 갱신
+    const int32 LastIndex = EffectTypes.Num() - 1;
+    if (EffectIndex != LastIndex)
+    {
+        EffectIndexByKey.Add(MakeEffectKey(OwnerHandles[LastIndex], EffectTypes[LastIndex]), EffectIndex);
+    }
+
+    OwnerHandles.RemoveAtSwap(EffectIndex, 1, false);
+    EffectTypes.RemoveAtSwap(EffectIndex, 1, false);
+    Intensities.RemoveAtSwap(EffectIndex, 1, false);
+    ExpireTimes.RemoveAtSwap(EffectIndex, 1, false);
+    LastDamageTimes.RemoveAtSwap(EffectIndex, 1, false);
+    Instigators.RemoveAtSwap(EffectIndex, 1, false);
+    PendingDamage.RemoveAtSwap(EffectIndex, 1, false);
+    PendingRemoval.RemoveAtSwap(EffectIndex, 1, false);
+}
@@ -0,0 +1,147 @@
+// HuntingSpirit Game - Status Effect Subsystem Header
+// 월드 단위로 모든 상태 효과의 지속 데미지/만료를 일괄 처리하는 서브시스템
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HuntingSpirit/Combat/Damage/HSDamageType.h"
+#include "HSStatusEffectSubsystem.generated.h"
+
+class UHSCombatComponent;
+
+// 한 번의 일괄 처리에서 발생한 상태 효과 데미지 이벤트
+USTRUCT(BlueprintType)
+struct HUNTINGSPIRIT_API FHSStatusEffectDamageEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status Effect")
+    TObjectPtr<AActor> Target = nullptr;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status Effect")
+    EHSStatusEffectType EffectType = EHSStatusEffectType::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status Effect")
+    float Damage = 0.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatusEffectDamageBatch, const TArray<FHSStatusEffectDamageEvent>&, DamageEvents);
+
+/**
+ * 상태 효과 일괄 처리 서브시스템
+ * - 활성 효과를 (소유자 핸들, 효과 타입) 키로 조밀한 SoA 배열에 저장
+ * - 매 틱 한 번의 패스로 DoT(강도 = 초당 데미지 x 경과 시간)와 만료를 평가 (대량일 때 병렬 평가)
+ * - 평가 결과를 게임 스레드에서 일괄 적용하고 데미지 이벤트를 한 번에 브로드캐스트
+ * - 효과별 타이머와 컴포넌트별 틱을 대체
+ */
+UCLASS()
+class HUNTINGSPIRIT_API UHSStatusEffectSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem 인터페이스
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject 인터페이스
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * 상태 효과를 등록하거나 갱신합니다 (만료 시각과 강도를 덮어씀)
+     * 일괄 처리 중 호출되면 제거/핸들 반납이 끝난 뒤 적용됩니다
+     * @param Component 효과를 받는 전투 컴포넌트
+     * @param Effect 병합이 끝난 상태 효과
+     * @param EffectInstigator 효과를 건 액터
+     */
+    void ApplyEffect(UHSCombatComponent* Component, const FHSStatusEffect& Effect, AActor* EffectInstigator);
+
+    /**
+     * 특정 컴포넌트의 상태 효과를 제거합니다
+     */
+    void RemoveEffect(UHSCombatComponent* Component, EHSStatusEffectType EffectType);
+
+    /**
+     * 특정 컴포넌트의 모든 상태 효과를 제거합니다
+     */
+    void RemoveAllEffects(UHSCombatComponent* Component);
+
+    /**
+     * 컴포넌트의 효과를 모두 제거하고 소유자 핸들을 반납합니다 (EndPlay 시 호출)
+     */
+    void UnregisterComponent(UHSCombatComponent* Component);
+
+    // 통계
+    int32 GetActiveEffectCount() const { return EffectTypes.Num(); }
+    int32 GetLastBatchDamageEventCount() const { return LastBatchDamageEventCount; }
+    int32 GetLastBatchExpiredCount() const { return LastBatchExpiredCount; }
+
+    // 일괄 데미지 이벤트 (한 틱에 한 번)
+    UPROPERTY(BlueprintAssignable, Category = "Status Effect")
+    FOnStatusEffectDamageBatch OnStatusEffectDamageBatch;
+
+    // 이 수 이상의 효과가 있을 때 평가 단계를 병렬 수행
+    int32 ParallelEvaluationThreshold = 256;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    static bool IsPeriodicDamageEffect(EHSStatusEffectType EffectType);
+    static uint64 MakeEffectKey(int32 OwnerHandle, EHSStatusEffectType EffectType);
+
+    int32 AcquireOwnerHandle(UHSCombatComponent* Component);
+    void ReleaseOwnerHandle(int32 OwnerHandle);
+    void RemoveEffectAt(int32 EffectIndex);
+    void EraseEffectAt(int32 EffectIndex);
+
+    // 일괄 처리 중 제거 요청 상태
+    enum class EPendingRemoval : uint8
+    {
+        None,
+        Expired,    // 만료 - 처리 후 컴포넌트에 통지
+        Removed     // 외부 제거/소유자 소멸 - 통지 없이 정리
+    };
+
+    // 일괄 처리 중 요청된 효과 적용 (제거 정리 후 처리)
+    struct FDeferredEffectApply
+    {
+        TWeakObjectPtr<UHSCombatComponent> Component;
+        FHSStatusEffect Effect;
+        TWeakObjectPtr<AActor> Instigator;
+    };
+
+    void CancelDeferredApplies(const UHSCombatComponent* Component, EHSStatusEffectType EffectType);
+
+    // 효과별 SoA 저장소 (동일 인덱스가 하나의 효과)
+    TArray<int32> OwnerHandles;
+    TArray<EHSStatusEffectType> EffectTypes;
+    TArray<float> Intensities;
+    TArray<float> ExpireTimes;
+    TArray<float> LastDamageTimes;
+    TArray<TWeakObjectPtr<AActor>> Instigators;
+
+    // 평가 단계 출력 (효과 인덱스와 동일 크기)
+    TArray<float> PendingDamage;
+    TArray<EPendingRemoval> PendingRemoval;
+
+    // 일괄 처리 중에는 배열 구조 변경(스왑 제거, 핸들 반납)을 지연
+    bool bIsProcessingBatch = false;
+    TArray<int32> DeferredHandleReleases;
+    TArray<FDeferredEffectApply> DeferredApplies;
+
+    // (소유자 핸들, 효과 타입) -> 효과 인덱스
+    TMap<uint64, int32> EffectIndexByKey;
+
+    // 소유자 핸들 <-> 전투 컴포넌트 (키는 컴포넌트가 소멸한 뒤에도 맵 항목을 지울 수 있도록 따로 보관)
+    TArray<TWeakObjectPtr<UHSCombatComponent>> OwnerComponents;
+    TArray<TObjectKey<UHSCombatComponent>> OwnerComponentKeys;
+    TArray<int32> FreeOwnerHandles;
+    TMap<TObjectKey<UHSCombatComponent>, int32> OwnerHandleByComponent;
+
+    // 마지막 일괄 처리 통계
+    int32 LastBatchDamageEventCount = 0;
+    int32 LastBatchExpiredCount = 0;
+};
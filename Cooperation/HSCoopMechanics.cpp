@@ -768,20 +768,10 @@ bool UHSCoopMechanics::SetTeamFormation(int32 TeamID, const FName& FormationType
         return false;
     }
 
-    // 팀 유효성 확인
-    if (TeamManager)
+    // 팀 유효성 및 리더 소속 확인 (플레이어-팀 매핑은 존재하는 팀만 가리킴)
+    if (TeamManager && TeamManager->GetPlayerTeamID(Leader->GetPlayerState()) != TeamID)
     {
-        FHSTeamInfo TeamInfo = TeamManager->GetTeamInfo(TeamID);
-        if (TeamInfo.TeamID == -1)
-        {
-            return false;
-        }
-
-        // 리더가 해당 팀에 속하는지 확인
-        if (!TeamInfo.IsPlayerInTeam(Leader->GetPlayerState()))
-        {
-            return false;
-        }
+        return false;
     }
 
     // 대형 설정
@@ -807,7 +797,6 @@ void UHSCoopMechanics::UpdateFormationMovement(int32 TeamID, const FVector& Targ
         return;
     }
 
-    FHSTeamInfo TeamInfo = TeamManager->GetTeamInfo(TeamID);
     TArray<APlayerState*> TeamMembers = TeamManager->GetTeamMembers(TeamID);
     UWorld* World = GetWorld();
     if (!World)
@@ -310,6 +310,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Coop Mechanics|Revival")
     bool IsRevivalInProgress(AHSCharacterBase* DeadPlayer) const;
 
+    // 진행 중인 부활의 부활자 (없으면 nullptr)
+    AHSCharacterBase* GetReviver(AHSCharacterBase* DeadPlayer) const { return RevivalPairs.FindRef(DeadPlayer); }
+
     // 자원 공유 시스템
     UFUNCTION(BlueprintCallable, Category = "Coop Mechanics|Resource")
     bool ShareResource(AHSCharacterBase* Giver, AHSCharacterBase* Receiver, const FName& ResourceType, float Amount);
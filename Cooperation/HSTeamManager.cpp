@@ -10,6 +10,7 @@
 #include "../Characters/Player/HSPlayerCharacter.h"
 #include "../Characters/Stats/HSStatsComponent.h"
 #include "../Characters/Stats/HSLevelSystem.h"
+#include "../Characters/Stats/HSAttributeSet.h"
 #include "../Combat/HSCombatComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/NetConnection.h"
@@ -32,10 +33,38 @@ DEFINE_LOG_CATEGORY_STATIC(LogHSTeamManager, Log, All);
     DECLARE_CYCLE_STAT(TEXT("HSTeamManager_AddPlayer"), STAT_HSTeamManager_AddPlayer, STATGROUP_Game);
     DECLARE_CYCLE_STAT(TEXT("HSTeamManager_RemovePlayer"), STAT_HSTeamManager_RemovePlayer, STATGROUP_Game);
     DECLARE_CYCLE_STAT(TEXT("HSTeamManager_Cleanup"), STAT_HSTeamManager_Cleanup, STATGROUP_Game);
+    DECLARE_CYCLE_STAT(TEXT("HSTeamManager_Aggregates"), STAT_HSTeamManager_Aggregates, STATGROUP_Game);
+    DECLARE_CYCLE_STAT(TEXT("HSTeamManager_ReplicatedUpdate"), STAT_HSTeamManager_ReplicatedUpdate, STATGROUP_Game);
 #else
     #define HS_TEAM_PERF_SCOPE(Name)
 #endif
 
+// === FastArray 복제 콜백 ===
+
+void FHSTeamInfo::PreReplicatedRemove(const FHSTeamDatabase& InArraySerializer)
+{
+    if (InArraySerializer.OwnerManager)
+    {
+        InArraySerializer.OwnerManager->HandleTeamReplicatedRemove(*this);
+    }
+}
+
+void FHSTeamInfo::PostReplicatedAdd(const FHSTeamDatabase& InArraySerializer)
+{
+    if (InArraySerializer.OwnerManager)
+    {
+        InArraySerializer.OwnerManager->HandleTeamReplicatedAdd(*this);
+    }
+}
+
+void FHSTeamInfo::PostReplicatedChange(const FHSTeamDatabase& InArraySerializer)
+{
+    if (InArraySerializer.OwnerManager)
+    {
+        InArraySerializer.OwnerManager->HandleTeamReplicatedChange(*this);
+    }
+}
+
 UHSTeamManager::UHSTeamManager()
 {
     // 기본값 초기화
@@ -47,7 +76,10 @@ UHSTeamManager::UHSTeamManager()
 
     // 메모리 풀 미리 할당 (성능 최적화)
     InactiveTeamPool.Reserve(MaxTeamsAllowed / 4); // 25% 미리 할당
-    TeamDatabase.Reserve(MaxTeamsAllowed);
+    TeamDatabase = &LocalTeamDatabase;
+    TeamDatabase->Items.Reserve(MaxTeamsAllowed);
+    TeamDatabase->OwnerManager = this;
+    TeamIndexByID.Reserve(MaxTeamsAllowed);
     PlayerToTeamMap.Reserve(MaxTeamsAllowed * DefaultMaxTeamSize); // 예상 최대 플레이어 수
 
     UE_LOG(LogHSTeamManager, Log, TEXT("HSTeamManager 생성자 호출됨"));
@@ -95,7 +127,21 @@ void UHSTeamManager::Deinitialize()
     // 메모리 정리
     {
         FScopeLock Lock(&TeamDatabaseMutex);
-        TeamDatabase.Empty();
+        TeamDatabase->Items.Empty();
+        TeamDatabase->MarkArrayDirty();
+        TeamDatabase->OwnerManager = nullptr;
+        TeamDatabase = &LocalTeamDatabase;
+        TeamIndexByID.Empty();
+
+        TArray<TWeakObjectPtr<APlayerState>> BoundPlayers;
+        MemberStatBindings.GetKeys(BoundPlayers);
+        for (const TWeakObjectPtr<APlayerState>& BoundPlayer : BoundPlayers)
+        {
+            UnbindMemberStatEvents(BoundPlayer);
+        }
+
+        MappedTeamRosters.Empty();
+        TeamAggregateCache.Empty();
         PlayerToTeamMap.Empty();
         InactiveTeamPool.Empty();
         TeamCreationTimes.Empty();
@@ -108,13 +154,61 @@ void UHSTeamManager::Deinitialize()
     Super::Deinitialize();
 }
 
-void UHSTeamManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void UHSTeamManager::BindTeamDatabase(FHSTeamDatabase& InTeamDatabase)
 {
-    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    FScopeLock Lock(&TeamDatabaseMutex);
 
-    // 네트워크 복제 설정
-    DOREPLIFETIME(UHSTeamManager, TeamDatabase);
-    DOREPLIFETIME(UHSTeamManager, NextTeamID);
+    if (TeamDatabase == &InTeamDatabase)
+    {
+        return;
+    }
+
+    // 게임 상태보다 먼저 만든 팀은 복제 저장소로 옮김 (클라이언트는 복제된 항목을 그대로 사용)
+    if (InTeamDatabase.Items.Num() == 0 && TeamDatabase->Items.Num() > 0)
+    {
+        InTeamDatabase.Items = MoveTemp(TeamDatabase->Items);
+        InTeamDatabase.MarkArrayDirty();
+    }
+    TeamDatabase->Items.Reset();
+    TeamDatabase->MarkArrayDirty();
+
+    InTeamDatabase.OwnerManager = this;
+    TeamDatabase = &InTeamDatabase;
+
+    // 저장소가 바뀌었으므로 색인과 플레이어 매핑을 새 항목 기준으로 다시 만듦
+    RebuildTeamIndex();
+    TeamAggregateCache.Reset();
+    for (const FHSTeamInfo& TeamInfo : TeamDatabase->Items)
+    {
+        SyncTeamMapping(TeamInfo);
+    }
+
+    UE_LOG(LogHSTeamManager, Log, TEXT("게임 상태 팀 데이터베이스 연결 (%d개 팀)"), TeamDatabase->Items.Num());
+}
+
+void UHSTeamManager::UnbindTeamDatabase(FHSTeamDatabase& InTeamDatabase)
+{
+    FScopeLock Lock(&TeamDatabaseMutex);
+
+    if (TeamDatabase != &InTeamDatabase)
+    {
+        return;
+    }
+
+    // 팀은 해당 월드의 PlayerState를 가리키므로 게임 상태와 함께 정리됨
+    for (const FHSTeamInfo& TeamInfo : TeamDatabase->Items)
+    {
+        ClearTeamMapping(TeamInfo.TeamID);
+        TeamCreationTimes.Remove(TeamInfo.TeamID);
+    }
+
+    InTeamDatabase.OwnerManager = nullptr;
+    TeamDatabase = &LocalTeamDatabase;
+    TeamIndexByID.Reset();
+    bTeamIndexDirty = false;
+    TeamAggregateCache.Reset();
+
+    UE_LOG(LogHSTeamManager, Log, TEXT("게임 상태 팀 데이터베이스 연결 해제"));
 }
 
 int32 UHSTeamManager::CreateTeam(APlayerState* TeamLeader, int32 MaxTeamSize)
@@ -142,9 +236,9 @@ int32 UHSTeamManager::CreateTeam(APlayerState* TeamLeader, int32 MaxTeamSize)
     }
 
     // 최대 팀 수 제한 확인
-    if (TeamDatabase.Num() >= MaxTeamsAllowed)
+    if (TeamDatabase->Items.Num() >= MaxTeamsAllowed)
     {
-        UE_LOG(LogHSTeamManager, Warning, TEXT("CreateTeam: 최대 팀 수에 도달했습니다 (%d/%d)"), TeamDatabase.Num(), MaxTeamsAllowed);
+        UE_LOG(LogHSTeamManager, Warning, TEXT("CreateTeam: 최대 팀 수에 도달했습니다 (%d/%d)"), TeamDatabase->Items.Num(), MaxTeamsAllowed);
         return -1;
     }
 
@@ -174,11 +268,10 @@ int32 UHSTeamManager::CreateTeam(APlayerState* TeamLeader, int32 MaxTeamSize)
     NewTeamInfo.SharedHealth = 100.0f;
     NewTeamInfo.TeamLevel = 1;
 
-    // 팀 데이터베이스에 추가
-    TeamDatabase.Add(NewTeamInfo);
-
-    // 플레이어-팀 매핑 업데이트
-    UpdatePlayerTeamMapping(TeamLeader, NewTeamID);
+    // 팀 데이터베이스에 추가 (색인 등록 후 복제 더티 처리 및 매핑 갱신)
+    const int32 NewTeamIndex = TeamDatabase->Items.Add(NewTeamInfo);
+    TeamIndexByID.Add(NewTeamID, NewTeamIndex);
+    MarkTeamDirty(TeamDatabase->Items[NewTeamIndex]);
 
     // 생성 시간 기록 (성능 분석용)
     TeamCreationTimes.Add(NewTeamID, NewTeamInfo.CreationTime);
@@ -212,24 +305,13 @@ bool UHSTeamManager::DisbandTeam(int32 TeamID)
         return false;
     }
 
-    FHSTeamInfo* TeamInfo = &TeamDatabase[TeamIndex];
+    FHSTeamInfo* TeamInfo = &TeamDatabase->Items[TeamIndex];
 
     // 해체 전에 팀 정보 백업 (이벤트용)
     const FHSTeamInfo TeamInfoCopy = *TeamInfo;
 
     // 모든 팀원의 매핑 제거
-    if (TeamInfo->TeamLeader.IsValid())
-    {
-        UpdatePlayerTeamMapping(TeamInfo->TeamLeader.Get(), -1);
-    }
-
-    for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo->TeamMembers)
-    {
-        if (Member.IsValid())
-        {
-            UpdatePlayerTeamMapping(Member.Get(), -1);
-        }
-    }
+    ClearTeamMapping(TeamID);
 
     // 메모리 풀로 팀 정보 반환 (재사용을 위해)
     TeamInfo->bIsActive = false;
@@ -242,8 +324,7 @@ bool UHSTeamManager::DisbandTeam(int32 TeamID)
     }
 
     // 데이터베이스에서 제거
-    TeamDatabase.RemoveAt(TeamIndex);
-    TeamCreationTimes.Remove(TeamID);
+    RemoveTeamAt(TeamIndex);
 
     UE_LOG(LogHSTeamManager, Log, TEXT("팀 해체됨 - ID: %d"), TeamID);
 
@@ -297,9 +378,7 @@ bool UHSTeamManager::AddPlayerToTeam(int32 TeamID, APlayerState* PlayerState)
 
     // 팀원 추가
     TeamInfo->TeamMembers.Add(PlayerState);
-
-    // 플레이어-팀 매핑 업데이트
-    UpdatePlayerTeamMapping(PlayerState, TeamID);
+    MarkTeamDirty(*TeamInfo);
 
     UE_LOG(LogHSTeamManager, Log, TEXT("플레이어 %s가 팀 %d에 가입함 (%d/%d)"), 
            *PlayerState->GetPlayerName(), TeamID, TeamInfo->GetTeamMemberCount(), TeamInfo->MaxTeamSize);
@@ -385,8 +464,8 @@ bool UHSTeamManager::RemovePlayerFromTeam(APlayerState* PlayerState)
         }
     }
 
-    // 플레이어-팀 매핑 업데이트
-    UpdatePlayerTeamMapping(PlayerState, -1);
+    // 복제 더티 처리 및 떠난 플레이어 매핑 해제
+    MarkTeamDirty(*TeamInfo);
 
     UE_LOG(LogHSTeamManager, Log, TEXT("플레이어 %s가 팀 %d에서 떠남"), *PlayerState->GetPlayerName(), TeamID);
 
@@ -434,6 +513,7 @@ bool UHSTeamManager::ChangeTeamLeader(int32 TeamID, APlayerState* NewLeader)
     }
 
     TeamInfo->TeamLeader = NewLeader;
+    MarkTeamDirty(*TeamInfo);
 
     UE_LOG(LogHSTeamManager, Log, TEXT("팀 %d의 리더가 변경됨: %s -> %s"), 
            TeamID, 
@@ -474,6 +554,14 @@ FHSTeamInfo UHSTeamManager::GetTeamInfo(int32 TeamID) const
     return FHSTeamInfo(); // 빈 구조체 반환
 }
 
+const FHSTeamInfo& UHSTeamManager::GetTeamInfoRef(int32 TeamID) const
+{
+    static const FHSTeamInfo EmptyTeamInfo;
+
+    const FHSTeamInfo* TeamInfo = FindTeamByID(TeamID);
+    return TeamInfo ? *TeamInfo : EmptyTeamInfo;
+}
+
 FHSTeamInfo UHSTeamManager::GetPlayerTeamInfo(APlayerState* PlayerState) const
 {
     const int32 TeamID = GetPlayerTeamID(PlayerState);
@@ -492,9 +580,9 @@ TArray<int32> UHSTeamManager::GetAllActiveTeamIDs() const
     FScopeLock Lock(&TeamDatabaseMutex);
     
     // 메모리 미리 할당 (성능 최적화)
-    ActiveTeamIDs.Reserve(TeamDatabase.Num());
+    ActiveTeamIDs.Reserve(TeamDatabase->Items.Num());
 
-    for (const FHSTeamInfo& TeamInfo : TeamDatabase)
+    for (const FHSTeamInfo& TeamInfo : TeamDatabase->Items)
     {
         if (TeamInfo.bIsActive)
         {
@@ -536,7 +624,8 @@ bool UHSTeamManager::IsPlayerTeamLeader(APlayerState* PlayerState) const
         return false;
     }
 
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
     return TeamInfo.TeamLeader.IsValid() && TeamInfo.TeamLeader.Get() == PlayerState;
 }
 
@@ -547,7 +636,8 @@ void UHSTeamManager::BroadcastMessageToTeam(int32 TeamID, const FString& Message
         return;
     }
 
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
     if (!TeamInfo.bIsActive)
     {
         return;
@@ -597,162 +687,121 @@ void UHSTeamManager::BroadcastMessageToTeam(int32 TeamID, const FString& Message
 
 float UHSTeamManager::GetTeamAverageLevel(int32 TeamID) const
 {
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
     if (!TeamInfo.bIsActive)
     {
         return 0.0f;
     }
 
-    float TotalLevel = 0.0f;
-    int32 ValidPlayerCount = 0;
-    TSet<const APlayerState*> ProcessedPlayers;
+    return GetTeamAggregates(TeamInfo).AverageLevel;
+}
 
-    const auto AccumulateLevel = [&](const TWeakObjectPtr<APlayerState>& PlayerPtr)
+float UHSTeamManager::GetTeamTotalHealth(int32 TeamID) const
+{
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
+    if (!TeamInfo.bIsActive)
     {
-        if (!PlayerPtr.IsValid())
-        {
-            return;
-        }
-
-        APlayerState* PlayerState = PlayerPtr.Get();
-        if (ProcessedPlayers.Contains(PlayerState))
-        {
-            return;
-        }
-
-        ProcessedPlayers.Add(PlayerState);
-
-        if (APawn* PlayerPawn = PlayerState->GetPawn())
-        {
-            if (AHSPlayerCharacter* PlayerCharacter = Cast<AHSPlayerCharacter>(PlayerPawn))
-            {
-                if (UHSStatsComponent* StatsComponent = PlayerCharacter->GetStatsComponent())
-                {
-                    if (UHSLevelSystem* LevelSystem = StatsComponent->GetLevelSystem())
-                    {
-                        TotalLevel += static_cast<float>(LevelSystem->GetCurrentLevel());
-                        ValidPlayerCount++;
-                    }
-                }
-            }
-        }
-    };
+        return 0.0f;
+    }
 
-    AccumulateLevel(TeamInfo.TeamLeader);
+    return GetTeamAggregates(TeamInfo).TotalHealth;
+}
 
-    for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo.TeamMembers)
+FVector UHSTeamManager::GetTeamCenterLocation(int32 TeamID) const
+{
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
+    if (!TeamInfo.bIsActive)
     {
-        AccumulateLevel(Member);
+        return FVector::ZeroVector;
     }
 
-    if (ValidPlayerCount == 0)
-    {
-        return static_cast<float>(TeamInfo.TeamLevel);
-    }
+    return GetTeamAggregates(TeamInfo).CenterLocation;
+}
 
-    return TotalLevel / ValidPlayerCount;
+void UHSTeamManager::InvalidateTeamAggregates(int32 TeamID)
+{
+    FScopeLock Lock(&TeamDatabaseMutex);
+    TeamAggregateCache.Remove(TeamID);
 }
 
-float UHSTeamManager::GetTeamTotalHealth(int32 TeamID) const
+UHSTeamManager::FTeamAggregateCache UHSTeamManager::GetTeamAggregates(const FHSTeamInfo& TeamInfo) const
 {
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
-    if (!TeamInfo.bIsActive)
+    FScopeLock Lock(&TeamDatabaseMutex);
+    FTeamAggregateCache& Cache = TeamAggregateCache.FindOrAdd(TeamInfo.TeamID);
+
+    // 중심 위치는 이동으로 매 프레임 바뀌므로 프레임 단위로 다시 계산하고,
+    // 같은 프레임 안의 체력/레벨 변경은 팀원 스탯 이벤트가 캐시를 지워 반영함
+    if (Cache.ComputedFrame == GFrameCounter)
     {
-        return 0.0f;
+        return Cache;
     }
 
+    HS_TEAM_PERF_SCOPE(HSTeamManager_Aggregates);
+
+    float TotalLevel = 0.0f;
+    int32 LevelPlayerCount = 0;
     float TotalHealth = 0.0f;
-    TSet<const APlayerState*> ProcessedPlayers;
+    FVector LocationSum = FVector::ZeroVector;
+    int32 LocationCount = 0;
+    TArray<const APlayerState*, TInlineAllocator<8>> ProcessedPlayers;
 
-    const auto AccumulateHealth = [&](const TWeakObjectPtr<APlayerState>& PlayerPtr)
+    const auto Accumulate = [&](const TWeakObjectPtr<APlayerState>& PlayerPtr)
     {
-        if (!PlayerPtr.IsValid())
-        {
-            return;
-        }
-
-        APlayerState* PlayerState = PlayerPtr.Get();
-        if (ProcessedPlayers.Contains(PlayerState))
+        const APlayerState* PlayerState = PlayerPtr.Get();
+        if (!PlayerState || ProcessedPlayers.Contains(PlayerState))
         {
             return;
         }
 
         ProcessedPlayers.Add(PlayerState);
 
-        if (APawn* PlayerPawn = PlayerState->GetPawn())
+        APawn* PlayerPawn = PlayerState->GetPawn();
+        if (!PlayerPawn)
         {
-            if (AHSPlayerCharacter* PlayerCharacter = Cast<AHSPlayerCharacter>(PlayerPawn))
-            {
-                if (UHSStatsComponent* StatsComponent = PlayerCharacter->GetStatsComponent())
-                {
-                    TotalHealth += StatsComponent->GetCurrentHealth();
-                    return;
-                }
-
-                if (UHSCombatComponent* CombatComponent = PlayerCharacter->FindComponentByClass<UHSCombatComponent>())
-                {
-                    TotalHealth += CombatComponent->GetCurrentHealth();
-                }
-            }
+            return;
         }
-    };
-
-    AccumulateHealth(TeamInfo.TeamLeader);
 
-    for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo.TeamMembers)
-    {
-        AccumulateHealth(Member);
-    }
-
-    return TotalHealth;
-}
+        LocationSum += PlayerPawn->GetActorLocation();
+        ++LocationCount;
 
-FVector UHSTeamManager::GetTeamCenterLocation(int32 TeamID) const
-{
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
-    if (!TeamInfo.bIsActive)
-    {
-        return FVector::ZeroVector;
-    }
-
-    // SIMD 최적화를 위한 벡터 배열 준비
-    TArray<FVector> PlayerLocations;
-    PlayerLocations.Reserve(TeamInfo.MaxTeamSize);
-
-    // 리더 위치 추가
-    if (TeamInfo.TeamLeader.IsValid())
-    {
-        if (APawn* PlayerPawn = TeamInfo.TeamLeader->GetPawn())
+        AHSPlayerCharacter* PlayerCharacter = Cast<AHSPlayerCharacter>(PlayerPawn);
+        if (!PlayerCharacter)
         {
-            PlayerLocations.Add(PlayerPawn->GetActorLocation());
+            return;
         }
-    }
 
-    // 팀원 위치 추가
-    for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo.TeamMembers)
-    {
-        if (Member.IsValid())
+        if (UHSStatsComponent* StatsComponent = PlayerCharacter->GetStatsComponent())
         {
-            if (APawn* PlayerPawn = Member->GetPawn())
+            if (UHSLevelSystem* LevelSystem = StatsComponent->GetLevelSystem())
             {
-                PlayerLocations.Add(PlayerPawn->GetActorLocation());
+                TotalLevel += static_cast<float>(LevelSystem->GetCurrentLevel());
+                ++LevelPlayerCount;
             }
+
+            TotalHealth += StatsComponent->GetCurrentHealth();
         }
-    }
+        else if (UHSCombatComponent* CombatComponent = PlayerCharacter->FindComponentByClass<UHSCombatComponent>())
+        {
+            TotalHealth += CombatComponent->GetCurrentHealth();
+        }
+    };
 
-    if (PlayerLocations.Num() == 0)
-    {
-        return FVector::ZeroVector;
-    }
+    Accumulate(TeamInfo.TeamLeader);
 
-    // SIMD 최적화된 벡터 평균 계산
-    FVector CenterLocation = FVector::ZeroVector;
-    for (const FVector& Location : PlayerLocations)
+    for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo.TeamMembers)
     {
-        CenterLocation += Location;
+        Accumulate(Member);
     }
 
-    return CenterLocation / PlayerLocations.Num();
+    Cache.AverageLevel = (LevelPlayerCount > 0) ? TotalLevel / LevelPlayerCount : static_cast<float>(TeamInfo.TeamLevel);
+    Cache.TotalHealth = TotalHealth;
+    Cache.CenterLocation = (LocationCount > 0) ? LocationSum / LocationCount : FVector::ZeroVector;
+    Cache.ComputedFrame = GFrameCounter;
+
+    return Cache;
 }
 
 void UHSTeamManager::CleanupInvalidData()
@@ -766,30 +815,32 @@ void UHSTeamManager::CleanupInvalidData()
 
     FScopeLock Lock(&TeamDatabaseMutex);
 
-    TArray<int32> TeamsToRemove;
-    
-    // 유효하지 않은 팀들 찾기
-    for (FHSTeamInfo& TeamInfo : TeamDatabase)
+    int32 RemovedTeamCount = 0;
+
+    // 뒤에서부터 순회 (제거 시 마지막 항목이 현재 위치로 옮겨지므로 이미 확인한 항목만 이동)
+    for (int32 TeamIndex = TeamDatabase->Items.Num() - 1; TeamIndex >= 0; --TeamIndex)
     {
+        FHSTeamInfo& TeamInfo = TeamDatabase->Items[TeamIndex];
+        const int32 PreviousMemberCount = TeamInfo.TeamMembers.Num();
+        const bool bHadStaleLeader = !TeamInfo.TeamLeader.IsValid() && !TeamInfo.TeamLeader.IsExplicitlyNull();
+
         // 유효하지 않은 팀원들 정리
         TeamInfo.CleanupInvalidMembers();
         
-        // 리더와 팀원이 모두 없으면 팀 제거 대상으로 표시
+        // 리더와 팀원이 모두 없으면 팀 제거
         if (!TeamInfo.TeamLeader.IsValid() && TeamInfo.TeamMembers.Num() == 0)
         {
-            TeamsToRemove.Add(TeamInfo.TeamID);
+            UE_LOG(LogHSTeamManager, Log, TEXT("유효하지 않은 팀 제거: %d"), TeamInfo.TeamID);
+            ClearTeamMapping(TeamInfo.TeamID);
+            RemoveTeamAt(TeamIndex);
+            ++RemovedTeamCount;
+            continue;
         }
-    }
 
-    // 유효하지 않은 팀들 제거 (역순으로 제거하여 인덱스 문제 방지)
-    for (int32 TeamID : TeamsToRemove)
-    {
-        const int32 TeamIndex = FindTeamIndexByID(TeamID);
-        if (TeamIndex != INDEX_NONE)
+        // 실제로 바뀐 팀만 복제 대상으로 표시
+        if (bHadStaleLeader || TeamInfo.TeamMembers.Num() != PreviousMemberCount)
         {
-            UE_LOG(LogHSTeamManager, Log, TEXT("유효하지 않은 팀 제거: %d"), TeamID);
-            TeamDatabase.RemoveAt(TeamIndex);
-            TeamCreationTimes.Remove(TeamID);
+            MarkTeamDirty(TeamInfo);
         }
     }
 
@@ -806,10 +857,26 @@ void UHSTeamManager::CleanupInvalidData()
     for (const TWeakObjectPtr<APlayerState>& Player : PlayersToRemove)
     {
         PlayerToTeamMap.Remove(Player);
+        UnbindMemberStatEvents(Player);
+    }
+
+    // 사라진 플레이어의 스탯 이벤트 구독 정리
+    TArray<TWeakObjectPtr<APlayerState>> StaleBindings;
+    for (const auto& BindingPair : MemberStatBindings)
+    {
+        if (!BindingPair.Key.IsValid())
+        {
+            StaleBindings.Add(BindingPair.Key);
+        }
+    }
+
+    for (const TWeakObjectPtr<APlayerState>& Player : StaleBindings)
+    {
+        UnbindMemberStatEvents(Player);
     }
 
     UE_LOG(LogHSTeamManager, VeryVerbose, TEXT("정리 작업 완료 - 제거된 팀: %d개, 정리된 매핑: %d개"), 
-           TeamsToRemove.Num(), PlayersToRemove.Num());
+           RemovedTeamCount, PlayersToRemove.Num());
 }
 
 void UHSTeamManager::DisbandAllTeams()
@@ -835,7 +902,7 @@ void UHSTeamManager::LogTeamManagerStatus() const
 {
     UE_LOG(LogHSTeamManager, Log, TEXT("=== HSTeamManager 상태 ==="));
     UE_LOG(LogHSTeamManager, Log, TEXT("초기화 상태: %s"), bIsInitialized ? TEXT("완료") : TEXT("미완료"));
-    UE_LOG(LogHSTeamManager, Log, TEXT("활성 팀 수: %d/%d"), TeamDatabase.Num(), MaxTeamsAllowed);
+    UE_LOG(LogHSTeamManager, Log, TEXT("활성 팀 수: %d/%d"), TeamDatabase->Items.Num(), MaxTeamsAllowed);
     UE_LOG(LogHSTeamManager, Log, TEXT("다음 팀 ID: %d"), NextTeamID);
     UE_LOG(LogHSTeamManager, Log, TEXT("플레이어-팀 매핑 수: %d"), PlayerToTeamMap.Num());
     UE_LOG(LogHSTeamManager, Log, TEXT("메모리 풀 크기: %d"), InactiveTeamPool.Num());
@@ -845,7 +912,8 @@ void UHSTeamManager::LogTeamManagerStatus() const
 
 void UHSTeamManager::LogTeamDetails(int32 TeamID) const
 {
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
     
     if (!TeamInfo.bIsActive)
     {
@@ -909,6 +977,7 @@ void UHSTeamManager::UpdatePlayerTeamMapping(APlayerState* PlayerState, int32 Ne
     {
         // 팀에서 제거
         PlayerToTeamMap.Remove(PlayerState);
+        UnbindMemberStatEvents(PlayerState);
     }
     else
     {
@@ -923,70 +992,277 @@ void UHSTeamManager::PerformScheduledCleanup()
     CleanupInvalidData();
 }
 
-void UHSTeamManager::OnRep_TeamDatabase()
+void UHSTeamManager::MarkTeamDirty(FHSTeamInfo& TeamInfo)
 {
-    // 네트워크 복제 시 호출되는 함수
-    UE_LOG(LogHSTeamManager, VeryVerbose, TEXT("팀 데이터베이스 네트워크 복제됨"));
-    
-    // 클라이언트에서 플레이어-팀 매핑 캐시 재구성
-    PlayerToTeamMap.Empty();
-    
-    for (const FHSTeamInfo& TeamInfo : TeamDatabase)
+    TeamDatabase->MarkItemDirty(TeamInfo);
+    SyncTeamMapping(TeamInfo);
+}
+
+void UHSTeamManager::RemoveTeamAt(int32 TeamIndex)
+{
+    const int32 RemovedTeamID = TeamDatabase->Items[TeamIndex].TeamID;
+
+    // 순서는 의미가 없으므로 마지막 항목과 교체해 제거하고 옮겨진 항목의 색인만 보정
+    TeamDatabase->Items.RemoveAtSwap(TeamIndex, 1, false);
+    TeamDatabase->MarkArrayDirty();
+
+    TeamIndexByID.Remove(RemovedTeamID);
+    if (TeamDatabase->Items.IsValidIndex(TeamIndex))
+    {
+        TeamIndexByID.Add(TeamDatabase->Items[TeamIndex].TeamID, TeamIndex);
+    }
+
+    TeamAggregateCache.Remove(RemovedTeamID);
+    TeamCreationTimes.Remove(RemovedTeamID);
+}
+
+void UHSTeamManager::HandleTeamReplicatedAdd(const FHSTeamInfo& TeamInfo)
+{
+    HS_TEAM_PERF_SCOPE(HSTeamManager_ReplicatedUpdate);
+
+    FScopeLock Lock(&TeamDatabaseMutex);
+    bTeamIndexDirty = true;
+    SyncTeamMapping(TeamInfo);
+}
+
+void UHSTeamManager::HandleTeamReplicatedChange(const FHSTeamInfo& TeamInfo)
+{
+    HS_TEAM_PERF_SCOPE(HSTeamManager_ReplicatedUpdate);
+
+    // 팀원 PlayerState가 늦게 복제되면 참조가 연결될 때 다시 호출됨
+    FScopeLock Lock(&TeamDatabaseMutex);
+    SyncTeamMapping(TeamInfo);
+}
+
+void UHSTeamManager::HandleTeamReplicatedRemove(const FHSTeamInfo& TeamInfo)
+{
+    HS_TEAM_PERF_SCOPE(HSTeamManager_ReplicatedUpdate);
+
+    FScopeLock Lock(&TeamDatabaseMutex);
+    bTeamIndexDirty = true;
+    ClearTeamMapping(TeamInfo.TeamID);
+}
+
+void UHSTeamManager::SyncTeamMapping(const FHSTeamInfo& TeamInfo)
+{
+    TArray<TWeakObjectPtr<APlayerState>, TInlineAllocator<4>>& Roster = MappedTeamRosters.FindOrAdd(TeamInfo.TeamID);
+
+    // 이전 명단 매핑 해제 (그 사이 다른 팀으로 옮긴 플레이어는 유지)
+    TArray<TWeakObjectPtr<APlayerState>, TInlineAllocator<4>> PreviousRoster = MoveTemp(Roster);
+    for (const TWeakObjectPtr<APlayerState>& PreviousPlayer : PreviousRoster)
     {
-        if (TeamInfo.TeamLeader.IsValid())
+        const int32* MappedTeamID = PlayerToTeamMap.Find(PreviousPlayer);
+        if (MappedTeamID && *MappedTeamID == TeamInfo.TeamID)
         {
-            PlayerToTeamMap.Add(TeamInfo.TeamLeader, TeamInfo.TeamID);
+            PlayerToTeamMap.Remove(PreviousPlayer);
         }
-        
-        for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo.TeamMembers)
+    }
+    Roster.Reset();
+
+    const auto MapPlayer = [&](const TWeakObjectPtr<APlayerState>& PlayerPtr)
+    {
+        if (PlayerPtr.IsValid())
+        {
+            PlayerToTeamMap.Add(PlayerPtr, TeamInfo.TeamID);
+            Roster.Add(PlayerPtr);
+            BindMemberStatEvents(PlayerPtr.Get());
+        }
+    };
+
+    MapPlayer(TeamInfo.TeamLeader);
+
+    for (const TWeakObjectPtr<APlayerState>& Member : TeamInfo.TeamMembers)
+    {
+        MapPlayer(Member);
+    }
+
+    // 어느 팀에도 남지 않은 이전 팀원은 스탯 이벤트 구독 해제
+    for (const TWeakObjectPtr<APlayerState>& PreviousPlayer : PreviousRoster)
+    {
+        if (!PlayerToTeamMap.Contains(PreviousPlayer))
+        {
+            UnbindMemberStatEvents(PreviousPlayer);
+        }
+    }
+
+    TeamAggregateCache.Remove(TeamInfo.TeamID);
+}
+
+void UHSTeamManager::ClearTeamMapping(int32 TeamID)
+{
+    if (const TArray<TWeakObjectPtr<APlayerState>, TInlineAllocator<4>>* Roster = MappedTeamRosters.Find(TeamID))
+    {
+        for (const TWeakObjectPtr<APlayerState>& Player : *Roster)
         {
-            if (Member.IsValid())
+            const int32* MappedTeamID = PlayerToTeamMap.Find(Player);
+            if (MappedTeamID && *MappedTeamID == TeamID)
             {
-                PlayerToTeamMap.Add(Member, TeamInfo.TeamID);
+                PlayerToTeamMap.Remove(Player);
+                UnbindMemberStatEvents(Player);
             }
         }
+        MappedTeamRosters.Remove(TeamID);
     }
+
+    TeamAggregateCache.Remove(TeamID);
 }
 
-// === 헬퍼 함수 구현 ===
+void UHSTeamManager::BindMemberStatEvents(APlayerState* PlayerState)
+{
+    if (!PlayerState || MemberStatBindings.Contains(PlayerState))
+    {
+        return;
+    }
 
-FHSTeamInfo* UHSTeamManager::FindTeamByID(int32 TeamID)
+    MemberStatBindings.Add(PlayerState);
+
+    // 부활/재접속으로 폰이 바뀌면 새 스탯 컴포넌트로 다시 구독
+    PlayerState->OnPawnSet.AddUniqueDynamic(this, &UHSTeamManager::HandleMemberPawnSet);
+    RebindMemberStatsComponent(PlayerState, PlayerState->GetPawn());
+}
+
+void UHSTeamManager::UnbindMemberStatEvents(const TWeakObjectPtr<APlayerState>& PlayerState)
 {
-    // 선형 검색으로 팀 찾기 (팀 개수가 적으므로 성능상 문제없음)
-    for (FHSTeamInfo& TeamInfo : TeamDatabase)
+    FTeamMemberStatBinding Binding;
+    if (!MemberStatBindings.RemoveAndCopyValue(PlayerState, Binding))
     {
-        if (TeamInfo.TeamID == TeamID)
-        {
-            return &TeamInfo;
-        }
+        return;
+    }
+
+    if (UHSAttributeSet* AttributeSet = Binding.AttributeSet.Get())
+    {
+        AttributeSet->OnHealthChanged.Remove(Binding.HealthChangedHandle);
+    }
+
+    if (UHSStatsComponent* StatsComponent = Binding.StatsComponent.Get())
+    {
+        StatsComponent->OnStatsLevelUp.Remove(Binding.LevelUpHandle);
+    }
+
+    if (APlayerState* BoundPlayerState = PlayerState.Get())
+    {
+        BoundPlayerState->OnPawnSet.RemoveDynamic(this, &UHSTeamManager::HandleMemberPawnSet);
     }
-    return nullptr;
 }
 
-const FHSTeamInfo* UHSTeamManager::FindTeamByID(int32 TeamID) const
+void UHSTeamManager::RebindMemberStatsComponent(APlayerState* PlayerState, APawn* NewPawn)
 {
-    // 선형 검색으로 팀 찾기 (팀 개수가 적으므로 성능상 문제없음)
-    for (const FHSTeamInfo& TeamInfo : TeamDatabase)
+    FTeamMemberStatBinding* Binding = MemberStatBindings.Find(PlayerState);
+    if (!Binding)
     {
-        if (TeamInfo.TeamID == TeamID)
-        {
-            return &TeamInfo;
-        }
+        return;
+    }
+
+    AHSPlayerCharacter* PlayerCharacter = Cast<AHSPlayerCharacter>(NewPawn);
+    UHSStatsComponent* NewStatsComponent = PlayerCharacter ? PlayerCharacter->GetStatsComponent() : nullptr;
+    if (Binding->StatsComponent.Get() == NewStatsComponent && NewStatsComponent)
+    {
+        return;
+    }
+
+    if (UHSAttributeSet* OldAttributeSet = Binding->AttributeSet.Get())
+    {
+        OldAttributeSet->OnHealthChanged.Remove(Binding->HealthChangedHandle);
+    }
+
+    if (UHSStatsComponent* OldStatsComponent = Binding->StatsComponent.Get())
+    {
+        OldStatsComponent->OnStatsLevelUp.Remove(Binding->LevelUpHandle);
+    }
+
+    *Binding = FTeamMemberStatBinding();
+    if (!NewStatsComponent)
+    {
+        return;
+    }
+
+    const TWeakObjectPtr<APlayerState> PlayerKey(PlayerState);
+    Binding->StatsComponent = NewStatsComponent;
+    Binding->LevelUpHandle = NewStatsComponent->OnStatsLevelUp.AddUObject(this, &UHSTeamManager::HandleMemberLevelUp, PlayerKey);
+
+    if (UHSAttributeSet* AttributeSet = NewStatsComponent->GetAttributeSet())
+    {
+        Binding->AttributeSet = AttributeSet;
+        Binding->HealthChangedHandle = AttributeSet->OnHealthChanged.AddUObject(this, &UHSTeamManager::HandleMemberHealthChanged, PlayerKey);
+    }
+}
+
+void UHSTeamManager::InvalidatePlayerTeamAggregates(const TWeakObjectPtr<APlayerState>& PlayerState)
+{
+    FScopeLock Lock(&TeamDatabaseMutex);
+
+    if (const int32* TeamID = PlayerToTeamMap.Find(PlayerState))
+    {
+        TeamAggregateCache.Remove(*TeamID);
     }
-    return nullptr;
+}
+
+void UHSTeamManager::HandleMemberHealthChanged(float OldHealth, float NewHealth, TWeakObjectPtr<APlayerState> PlayerState)
+{
+    InvalidatePlayerTeamAggregates(PlayerState);
+}
+
+void UHSTeamManager::HandleMemberLevelUp(int32 NewLevel, int32 StatPoints, TWeakObjectPtr<APlayerState> PlayerState)
+{
+    InvalidatePlayerTeamAggregates(PlayerState);
+}
+
+void UHSTeamManager::HandleMemberPawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn)
+{
+    FScopeLock Lock(&TeamDatabaseMutex);
+
+    RebindMemberStatsComponent(Player, NewPawn);
+    InvalidatePlayerTeamAggregates(Player);
+}
+
+// === 헬퍼 함수 구현 ===
+
+FHSTeamInfo* UHSTeamManager::FindTeamByID(int32 TeamID)
+{
+    const int32 TeamIndex = FindTeamIndexByID(TeamID);
+    return (TeamIndex != INDEX_NONE) ? &TeamDatabase->Items[TeamIndex] : nullptr;
+}
+
+const FHSTeamInfo* UHSTeamManager::FindTeamByID(int32 TeamID) const
+{
+    const int32 TeamIndex = FindTeamIndexByID(TeamID);
+    return (TeamIndex != INDEX_NONE) ? &TeamDatabase->Items[TeamIndex] : nullptr;
 }
 
 int32 UHSTeamManager::FindTeamIndexByID(int32 TeamID) const
 {
-    // 선형 검색으로 팀 인덱스 찾기
-    for (int32 i = 0; i < TeamDatabase.Num(); ++i)
+    const TArray<FHSTeamInfo>& Items = TeamDatabase->Items;
+
+    if (const int32* TeamIndex = TeamIndexByID.Find(TeamID))
     {
-        if (TeamDatabase[i].TeamID == TeamID)
+        if (Items.IsValidIndex(*TeamIndex) && Items[*TeamIndex].TeamID == TeamID)
         {
-            return i;
+            return *TeamIndex;
         }
     }
-    return INDEX_NONE;
+
+    // 클라이언트에서 복제로 항목이 추가/제거된 뒤에만 색인을 다시 만듦
+    if (!bTeamIndexDirty)
+    {
+        return INDEX_NONE;
+    }
+
+    RebuildTeamIndex();
+
+    const int32* RebuiltIndex = TeamIndexByID.Find(TeamID);
+    return RebuiltIndex ? *RebuiltIndex : INDEX_NONE;
+}
+
+void UHSTeamManager::RebuildTeamIndex() const
+{
+    TeamIndexByID.Reset();
+
+    for (int32 TeamIndex = 0; TeamIndex < TeamDatabase->Items.Num(); ++TeamIndex)
+    {
+        TeamIndexByID.Add(TeamDatabase->Items[TeamIndex].TeamID, TeamIndex);
+    }
+
+    bTeamIndexDirty = false;
 }
 
 // === Blueprint 안전 접근 헬퍼 함수들 ===
@@ -994,7 +1270,8 @@ int32 UHSTeamManager::FindTeamIndexByID(int32 TeamID) const
 APlayerState* UHSTeamManager::GetTeamLeader(int32 TeamID) const
 {
     // 팀 정보를 안전하게 가져와서 리더 반환
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
     if (!TeamInfo.bIsActive)
     {
         return nullptr;
@@ -1008,7 +1285,8 @@ TArray<APlayerState*> UHSTeamManager::GetTeamMembers(int32 TeamID) const
     TArray<APlayerState*> Members;
     
     // 팀 정보를 안전하게 가져오기
-    const FHSTeamInfo TeamInfo = GetTeamInfo(TeamID);
+    FScopeLock Lock(&TeamDatabaseMutex);
+    const FHSTeamInfo& TeamInfo = GetTeamInfoRef(TeamID);
     if (!TeamInfo.bIsActive)
     {
         return Members;
@@ -9,18 +9,21 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "HSTeamManager.generated.h"
 
 // 전방 선언
 class AHSPlayerController;
 class AHSPlayerCharacter;
+class UHSTeamManager;
+struct FHSTeamDatabase;
 
 /**
  * 팀 정보를 저장하는 구조체
- * 네트워크 복제를 지원하여 모든 클라이언트에서 팀 상태를 동기화
+ * FastArray 항목으로 복제되어 변경된 팀만 클라이언트에 전송
  */
 USTRUCT(BlueprintType)
-struct HUNTINGSPIRIT_API FHSTeamInfo
+struct HUNTINGSPIRIT_API FHSTeamInfo : public FFastArraySerializerItem
 {
     GENERATED_BODY()
 
@@ -117,6 +120,41 @@ struct HUNTINGSPIRIT_API FHSTeamInfo
             TeamLeader = nullptr;
         }
     }
+
+    // FastArray 복제 콜백 (클라이언트에서 항목 단위로 호출)
+    void PreReplicatedRemove(const FHSTeamDatabase& InArraySerializer);
+    void PostReplicatedAdd(const FHSTeamDatabase& InArraySerializer);
+    void PostReplicatedChange(const FHSTeamDatabase& InArraySerializer);
+};
+
+/**
+ * 팀 데이터베이스 FastArray 래퍼
+ * AHSGameStateBase가 복제 속성으로 소유하고, 항목별 추가/변경/제거 콜백을 바인딩된 팀 관리자로 전달
+ */
+USTRUCT()
+struct HUNTINGSPIRIT_API FHSTeamDatabase : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FHSTeamInfo> Items;
+
+    // 복제 콜백을 받을 팀 관리자 (복제 대상 아님, UHSTeamManager::BindTeamDatabase에서 설정)
+    UHSTeamManager* OwnerManager = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FHSTeamInfo, FHSTeamDatabase>(Items, DeltaParms, *this);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FHSTeamDatabase> : public TStructOpsTypeTraitsBase2<FHSTeamDatabase>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true
+    };
 };
 
 /**
@@ -138,6 +176,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnTeamLeaderChanged, int32, Team
  * - 팀 상태 네트워크 동기화
  * - 팀 기반 협동 메커니즘 지원
  * - 메모리 최적화 및 오브젝트 풀링 적용
+ * - 팀 ID 색인과 팀별 집계(평균 레벨, 총 체력, 중심 위치) 캐시로 조회 시 복사/선형 검색 제거
+ *
+ * 복제 구조:
+ * GameInstanceSubsystem은 액터 채널이 없어 직접 복제되지 않으므로 팀 데이터베이스는 AHSGameStateBase가 복제 속성으로 소유함.
+ * 게임 상태가 BindTeamDatabase로 저장소를 연결하면 서버는 그 저장소를 수정하고, 클라이언트는 FastArray 콜백으로 매핑만 갱신함.
+ * 게임 상태가 없을 때(메뉴, 단독 테스트)는 복제되지 않는 로컬 저장소를 사용함.
  */
 UCLASS(BlueprintType, Blueprintable)
 class HUNTINGSPIRIT_API UHSTeamManager : public UGameInstanceSubsystem
@@ -152,21 +196,33 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
-    // 네트워크 복제 지원
-    virtual bool IsSupportedForNetworking() const override { return true; }
-    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    /**
+     * 게임 상태가 소유한 복제 팀 데이터베이스를 연결합니다 (AHSGameStateBase 전용)
+     * 게임 상태가 생기기 전에 만든 팀은 연결된 저장소로 옮겨짐
+     * @param InTeamDatabase 게임 상태의 팀 데이터베이스
+     */
+    void BindTeamDatabase(FHSTeamDatabase& InTeamDatabase);
+
+    /**
+     * 게임 상태의 팀 데이터베이스 연결을 해제하고 로컬 저장소로 돌아갑니다 (AHSGameStateBase 전용)
+     * @param InTeamDatabase 연결했던 팀 데이터베이스
+     */
+    void UnbindTeamDatabase(FHSTeamDatabase& InTeamDatabase);
 
 protected:
-    // 팀 데이터 저장소 (네트워크 복제 지원을 위해 배열 사용)
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Team Management")
-    TArray<FHSTeamInfo> TeamDatabase;
+    // 게임 상태가 없을 때 사용하는 로컬 팀 저장소 (복제되지 않음)
+    UPROPERTY()
+    FHSTeamDatabase LocalTeamDatabase;
+
+    // 현재 사용 중인 팀 저장소 (게임 상태의 복제 저장소 또는 LocalTeamDatabase)
+    FHSTeamDatabase* TeamDatabase;
 
     // 플레이어별 팀 매핑 (빠른 검색을 위한 캐시 - Blueprint 접근 불필요)
     UPROPERTY()
     TMap<TWeakObjectPtr<APlayerState>, int32> PlayerToTeamMap;
 
-    // 다음 팀 ID (고유성 보장)
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Team Management")
+    // 다음 팀 ID (고유성 보장, 서버에서만 발급)
+    UPROPERTY(BlueprintReadOnly, Category = "Team Management")
     int32 NextTeamID;
 
     // 팀 생성 시간 기록 (성능 분석용)
@@ -380,6 +436,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "Team Statistics")
     FVector GetTeamCenterLocation(int32 TeamID) const;
 
+    /**
+     * 팀 집계 캐시를 무효화합니다 (팀원의 체력/레벨/폰 변경 이벤트에서 자동 호출)
+     * @param TeamID 대상 팀 ID
+     */
+    void InvalidateTeamAggregates(int32 TeamID);
+
     // === 최적화 및 유지보수 기능 ===
 
     /**
@@ -437,10 +499,16 @@ protected:
     void PerformScheduledCleanup();
 
     /**
-     * 네트워크 복제용 함수들
+     * 팀 항목 변경 후 호출합니다 (복제 더티 처리, 플레이어-팀 매핑 갱신, 집계 캐시 무효화)
+     * @param TeamInfo 변경된 팀 항목
      */
-    UFUNCTION()
-    void OnRep_TeamDatabase();
+    void MarkTeamDirty(FHSTeamInfo& TeamInfo);
+
+    /**
+     * 팀 항목을 제거합니다 (마지막 항목과 교체 후 색인 보정)
+     * @param TeamIndex 제거할 배열 인덱스
+     */
+    void RemoveTeamAt(int32 TeamIndex);
 
     /**
      * TeamID로 팀 정보를 찾는 헬퍼 함수
@@ -457,7 +525,69 @@ protected:
      */
     int32 FindTeamIndexByID(int32 TeamID) const;
 
+    /**
+     * 팀 정보를 복사 없이 반환합니다 (TeamDatabaseMutex를 잡은 상태에서만 호출하고, 잠금 해제 후에는 참조를 쓰지 않음)
+     * @param TeamID 조회할 팀 ID
+     * @return 팀 정보, 존재하지 않으면 빈 구조체
+     */
+    const FHSTeamInfo& GetTeamInfoRef(int32 TeamID) const;
+
 private:
+    friend struct FHSTeamInfo;
+
+    // 팀별 집계 캐시 (프레임당 한 번 계산, 팀 구성 변경 시 무효화)
+    struct FTeamAggregateCache
+    {
+        uint64 ComputedFrame = MAX_uint64;
+        float AverageLevel = 0.0f;
+        float TotalHealth = 0.0f;
+        FVector CenterLocation = FVector::ZeroVector;
+    };
+
+    // 복제 콜백 처리 (추가/변경된 팀의 매핑만 갱신) - 게임 상태의 TeamDatabase 복제 시 클라이언트에서 호출됨
+    void HandleTeamReplicatedAdd(const FHSTeamInfo& TeamInfo);
+    void HandleTeamReplicatedChange(const FHSTeamInfo& TeamInfo);
+    void HandleTeamReplicatedRemove(const FHSTeamInfo& TeamInfo);
+
+    // 팀 명단과 이전 명단의 차이만큼 플레이어-팀 매핑을 갱신
+    void SyncTeamMapping(const FHSTeamInfo& TeamInfo);
+    void ClearTeamMapping(int32 TeamID);
+
+    void RebuildTeamIndex() const;
+
+    // TeamDatabaseMutex를 잡은 상태에서 호출 (캐시 항목은 잠금 밖으로 참조를 넘기지 않고 복사해 반환)
+    FTeamAggregateCache GetTeamAggregates(const FHSTeamInfo& TeamInfo) const;
+
+    // 팀원 스탯 이벤트 구독 (체력/레벨 변경과 폰 교체 시 소속 팀 집계 무효화)
+    struct FTeamMemberStatBinding
+    {
+        TWeakObjectPtr<class UHSStatsComponent> StatsComponent;
+        TWeakObjectPtr<class UHSAttributeSet> AttributeSet;
+        FDelegateHandle HealthChangedHandle;
+        FDelegateHandle LevelUpHandle;
+    };
+
+    void BindMemberStatEvents(APlayerState* PlayerState);
+    void UnbindMemberStatEvents(const TWeakObjectPtr<APlayerState>& PlayerState);
+    void RebindMemberStatsComponent(APlayerState* PlayerState, APawn* NewPawn);
+    void InvalidatePlayerTeamAggregates(const TWeakObjectPtr<APlayerState>& PlayerState);
+    void HandleMemberHealthChanged(float OldHealth, float NewHealth, TWeakObjectPtr<APlayerState> PlayerState);
+    void HandleMemberLevelUp(int32 NewLevel, int32 StatPoints, TWeakObjectPtr<APlayerState> PlayerState);
+
+    UFUNCTION()
+    void HandleMemberPawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn);
+
+    TMap<TWeakObjectPtr<APlayerState>, FTeamMemberStatBinding> MemberStatBindings;
+
+    // 팀 ID -> TeamDatabase 인덱스 (클라이언트는 항목 추가/제거 후 다음 조회 시 재구성)
+    mutable TMap<int32, int32> TeamIndexByID;
+    mutable bool bTeamIndexDirty = false;
+
+    // 팀별로 매핑에 반영된 명단 (다음 변경 시 빠진 플레이어만 매핑 해제)
+    TMap<int32, TArray<TWeakObjectPtr<APlayerState>, TInlineAllocator<4>>> MappedTeamRosters;
+
+    mutable TMap<int32, FTeamAggregateCache> TeamAggregateCache;
+
     // 내부 상태 변수들
     bool bIsInitialized;
     mutable FCriticalSection TeamDatabaseMutex; // 스레드 안전성을 위한 뮤텍스
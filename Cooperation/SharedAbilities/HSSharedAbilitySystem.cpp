@@ -2,6 +2,7 @@
 
 #include "HSSharedAbilitySystem.h"
 #include "../../Characters/Base/HSCharacterBase.h"
+#include "../../Characters/Player/HSPlayerCharacter.h"
 #include "../HSTeamManager.h"
 #include "../../Characters/Stats/HSStatsComponent.h"
 #include "../../Combat/HSCombatComponent.h"
@@ -16,31 +17,62 @@
 #include "Net/UnrealNetwork.h"
 #include "HAL/PlatformMath.h"
 #include "Math/UnrealMathUtility.h"
+#include "Stats/Stats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Abilities In Use"), STAT_HSSharedAbilitiesInUse, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shared Ability Pool Chunks"), STAT_HSSharedAbilityPoolChunks, STATGROUP_Game);
 
 // 최적화를 위한 상수 정의
 static constexpr float SPATIAL_HASH_CELL_SIZE = 500.0f;
-static constexpr int32 ABILITY_POOL_INITIAL_SIZE = 10;
-static constexpr float SYNERGY_CACHE_LIFETIME = 5.0f;
 static constexpr float PROXIMITY_CHECK_SQUARED = true; // 제곱 거리 사용으로 최적화
 
 UHSSharedAbilitySystem::UHSSharedAbilitySystem()
 {
-    AbilityPoolSize = ABILITY_POOL_INITIAL_SIZE;
     SpatialHashCellSize = SPATIAL_HASH_CELL_SIZE;
-    CacheInvalidationTimer = 0.0f;
+    SharedAbilityTime = 0.0;
     
-    // 메모리 풀 사전 할당
-    AbilityPool.Reserve(AbilityPoolSize);
-    for (int32 i = 0; i < AbilityPoolSize; ++i)
+    // 메모리 풀은 Initialize 또는 첫 활성화 시 청크 단위로 할당
+    FirstFreeSlotIndex = INDEX_NONE;
+    PooledAbilityInUseCount = 0;
+}
+
+void UHSSharedAbilitySystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+    UHSSharedAbilitySystem* This = CastChecked<UHSSharedAbilitySystem>(InThis);
+    
+    // 사용 중인 풀 슬롯의 참가자 참조 유지
+    for (const TUniquePtr<FAbilityPoolChunk>& Chunk : This->AbilityPoolChunks)
     {
-        AbilityPool.Add(FActiveSharedAbility());
+        for (FAbilityPoolSlot& Slot : Chunk->Slots)
+        {
+            if (Slot.bInUse)
+            {
+                Collector.AddReferencedObjects(Slot.Ability.ParticipatingPlayers, This);
+            }
+        }
     }
+    
+    Super::AddReferencedObjects(InThis, Collector);
 }
 
 void UHSSharedAbilitySystem::Initialize(UHSTeamManager* InTeamManager)
 {
     TeamManager = InTeamManager;
     
+    // 팀 구성이 바뀌면 시너지 캐시 무효화
+    if (TeamManager)
+    {
+        TeamManager->OnPlayerJoinedTeam.AddUniqueDynamic(this, &UHSSharedAbilitySystem::HandlePlayerJoinedTeam);
+        TeamManager->OnPlayerLeftTeam.AddUniqueDynamic(this, &UHSSharedAbilitySystem::HandlePlayerLeftTeam);
+        TeamManager->OnTeamDisbanded.AddUniqueDynamic(this, &UHSSharedAbilitySystem::HandleTeamDisbanded);
+    }
+    
+    // 메모리 풀 사전 할당
+    if (AbilityPoolChunks.Num() == 0)
+    {
+        AllocateAbilityPoolChunk();
+    }
+    
     // 기본 공유 능력들 등록 (데이터 테이블에서 로드하는 것이 이상적)
     // 여기서는 예시로 하드코딩
     FSharedAbilityData CombinedAttack;
@@ -86,10 +118,18 @@ void UHSSharedAbilitySystem::Shutdown()
     
     RegisteredAbilities.Empty();
     ActiveAbilities.Empty();
-    AbilityCooldowns.Empty();
+    AbilityCooldownEndTimes.Empty();
+    DurationExpiryHeap.Empty();
+    CooldownExpiryHeap.Empty();
     SynergyBonusCache.Empty();
     SpatialHash.Empty();
     
+    if (TeamManager)
+    {
+        TeamManager->OnPlayerJoinedTeam.RemoveAll(this);
+        TeamManager->OnPlayerLeftTeam.RemoveAll(this);
+        TeamManager->OnTeamDisbanded.RemoveAll(this);
+    }
     TeamManager = nullptr;
 }
 
@@ -114,7 +154,7 @@ void UHSSharedAbilitySystem::UnregisterSharedAbility(const FName& AbilityID)
     }
     
     RegisteredAbilities.Remove(AbilityID);
-    AbilityCooldowns.Remove(AbilityID);
+    AbilityCooldownEndTimes.Remove(AbilityID);
     
     UE_LOG(LogTemp, Log, TEXT("공유 능력 등록 해제됨: %s"), *AbilityID.ToString());
 }
@@ -135,8 +175,7 @@ bool UHSSharedAbilitySystem::TryActivateSharedAbility(const FName& AbilityID, co
 
 void UHSSharedAbilitySystem::DeactivateSharedAbility(const FName& AbilityID)
 {
-    FActiveSharedAbility* ActiveAbility = ActiveAbilities.Find(AbilityID);
-    if (!ActiveAbility || !ActiveAbility->bIsActive)
+    if (!IsSharedAbilityActive(AbilityID))
     {
         return;
     }
@@ -162,10 +201,10 @@ bool UHSSharedAbilitySystem::CanActivateSharedAbility(const FName& AbilityID, co
     }
     
     // 쿨다운 확인
-    const float* Cooldown = AbilityCooldowns.Find(AbilityID);
-    if (Cooldown && *Cooldown > 0.0f)
+    const float RemainingCooldown = GetSharedAbilityCooldown(AbilityID);
+    if (RemainingCooldown > 0.0f)
     {
-        OutFailureReason = FString::Printf(TEXT("쿨다운 중입니다. (%.1f초 남음)"), *Cooldown);
+        OutFailureReason = FString::Printf(TEXT("쿨다운 중입니다. (%.1f초 남음)"), RemainingCooldown);
         return false;
     }
     
@@ -228,9 +267,14 @@ TArray<FActiveSharedAbility> UHSSharedAbilitySystem::GetActiveSharedAbilities()
     
     for (const auto& Pair : ActiveAbilities)
     {
-        if (Pair.Value.bIsActive)
+        const FActiveSharedAbility* ActiveAbility = ResolveAbilityHandle(Pair.Value);
+        if (ActiveAbility && ActiveAbility->bIsActive)
         {
-            Result.Add(Pair.Value);
+            // 남은 시간은 종료 시각에서 계산해 채움
+            FActiveSharedAbility& AbilityInfo = Result.Add_GetRef(*ActiveAbility);
+            const double DurationEndTime = GetPoolSlot(Pair.Value.SlotIndex).DurationEndTime;
+            AbilityInfo.RemainingDuration = DurationEndTime > 0.0 ? static_cast<float>(FMath::Max(0.0, DurationEndTime - SharedAbilityTime)) : 0.0f;
+            AbilityInfo.RemainingCooldown = GetSharedAbilityCooldown(Pair.Key);
         }
     }
     
@@ -239,73 +283,48 @@ TArray<FActiveSharedAbility> UHSSharedAbilitySystem::GetActiveSharedAbilities()
 
 bool UHSSharedAbilitySystem::IsSharedAbilityActive(const FName& AbilityID) const
 {
-    const FActiveSharedAbility* ActiveAbility = ActiveAbilities.Find(AbilityID);
+    const FHSSharedAbilityHandle* Handle = ActiveAbilities.Find(AbilityID);
+    const FActiveSharedAbility* ActiveAbility = Handle ? ResolveAbilityHandle(*Handle) : nullptr;
     return ActiveAbility && ActiveAbility->bIsActive;
 }
 
 float UHSSharedAbilitySystem::GetSharedAbilityCooldown(const FName& AbilityID) const
 {
-    const float* Cooldown = AbilityCooldowns.Find(AbilityID);
-    return Cooldown ? *Cooldown : 0.0f;
+    const double* CooldownEndTime = AbilityCooldownEndTimes.Find(AbilityID);
+    return CooldownEndTime ? static_cast<float>(FMath::Max(0.0, *CooldownEndTime - SharedAbilityTime)) : 0.0f;
 }
 
 void UHSSharedAbilitySystem::TickSharedAbilities(float DeltaTime)
 {
-    // 캐시 무효화 타이머 업데이트
-    CacheInvalidationTimer += DeltaTime;
-    if (CacheInvalidationTimer >= SYNERGY_CACHE_LIFETIME)
-    {
-        SynergyBonusCache.Empty();
-        CacheInvalidationTimer = 0.0f;
-    }
-    
-    // 활성 능력 업데이트
-    TArray<FName> AbilitiesToDeactivate;
+    SharedAbilityTime += DeltaTime;
     
-    for (auto& Pair : ActiveAbilities)
+    // 지속 시간 만료 처리 (가장 이른 만료 시각이 지나지 않았으면 바로 끝남)
+    while (DurationExpiryHeap.Num() > 0 && DurationExpiryHeap.HeapTop().ExpireTime <= SharedAbilityTime)
     {
-        FActiveSharedAbility& ActiveAbility = Pair.Value;
+        FAbilityExpiry Expiry;
+        DurationExpiryHeap.HeapPop(Expiry, false);
         
-        if (!ActiveAbility.bIsActive)
-            continue;
-            
-        // 지속 시간 업데이트
-        if (ActiveAbility.RemainingDuration > 0.0f)
+        // 수동 비활성화로 이미 반환된 슬롯은 핸들 세대가 달라 무시됨
+        if (ResolveAbilityHandle(Expiry.Handle))
         {
-            ActiveAbility.RemainingDuration -= DeltaTime;
-            
-            if (ActiveAbility.RemainingDuration <= 0.0f)
-            {
-                AbilitiesToDeactivate.Add(Pair.Key);
-            }
+            DeactivateAbility(Expiry.AbilityID);
         }
     }
     
-    // 쿨다운 업데이트
-    TArray<FName> CooldownsToRemove;
-    
-    for (auto& Pair : AbilityCooldowns)
+    // 쿨다운 만료 처리
+    while (CooldownExpiryHeap.Num() > 0 && CooldownExpiryHeap.HeapTop().ExpireTime <= SharedAbilityTime)
     {
-        Pair.Value -= DeltaTime;
+        FAbilityExpiry Expiry;
+        CooldownExpiryHeap.HeapPop(Expiry, false);
         
-        if (Pair.Value <= 0.0f)
+        // 등록 해제 등으로 종료 시각이 바뀐 항목은 무시
+        const double* CooldownEndTime = AbilityCooldownEndTimes.Find(Expiry.AbilityID);
+        if (CooldownEndTime && *CooldownEndTime == Expiry.ExpireTime)
         {
-            CooldownsToRemove.Add(Pair.Key);
+            AbilityCooldownEndTimes.Remove(Expiry.AbilityID);
+            UE_LOG(LogTemp, Verbose, TEXT("공유 능력 쿨다운 완료: %s"), *Expiry.AbilityID.ToString());
         }
     }
-    
-    // 비활성화 처리
-    for (const FName& AbilityID : AbilitiesToDeactivate)
-    {
-        DeactivateAbility(AbilityID);
-    }
-    
-    // 쿨다운 제거
-    for (const FName& AbilityID : CooldownsToRemove)
-    {
-        AbilityCooldowns.Remove(AbilityID);
-        UE_LOG(LogTemp, Verbose, TEXT("공유 능력 쿨다운 완료: %s"), *AbilityID.ToString());
-    }
 }
 
 float UHSSharedAbilitySystem::CalculateSynergyBonus(const TArray<AHSCharacterBase*>& Players) const
@@ -313,12 +332,13 @@ float UHSSharedAbilitySystem::CalculateSynergyBonus(const TArray<AHSCharacterBas
     if (Players.Num() < 2)
         return 1.0f;
     
-    // 캐시 확인
-    uint32 CombinationHash = GetPlayerCombinationHash(Players);
-    const float* CachedBonus = SynergyBonusCache.Find(CombinationHash);
-    if (CachedBonus)
+    // 캐시 확인 (해시 충돌 시 정렬된 참가자 키로 구분)
+    TArray<uint64, TInlineAllocator<8>> MemberKeys;
+    const uint32 CombinationHash = GetPlayerCombinationHash(Players, MemberKeys);
+    const FSynergyCacheEntry* CachedEntry = SynergyBonusCache.Find(CombinationHash);
+    if (CachedEntry && CachedEntry->MemberKeys == MemberKeys)
     {
-        return *CachedBonus;
+        return CachedEntry->SynergyBonus;
     }
     
     // 시너지 보너스 계산
@@ -328,12 +348,12 @@ float UHSSharedAbilitySystem::CalculateSynergyBonus(const TArray<AHSCharacterBas
     SynergyBonus += (Players.Num() - 1) * 0.1f;
     
     // 클래스 다양성 보너스
-    TSet<FName> UniqueClasses;
+    TSet<uint32> UniqueClasses;
     for (const AHSCharacterBase* Player : Players)
     {
         if (Player)
         {
-            UniqueClasses.Add(Player->GetClass()->GetFName());
+            UniqueClasses.Add(GetSynergyClassKey(Player));
         }
     }
     
@@ -343,7 +363,9 @@ float UHSSharedAbilitySystem::CalculateSynergyBonus(const TArray<AHSCharacterBas
     }
     
     // 캐시에 저장
-    SynergyBonusCache.Add(CombinationHash, SynergyBonus);
+    FSynergyCacheEntry& NewEntry = SynergyBonusCache.Add(CombinationHash);
+    NewEntry.MemberKeys = MoveTemp(MemberKeys);
+    NewEntry.SynergyBonus = SynergyBonus;
     
     return SynergyBonus;
 }
@@ -413,19 +435,11 @@ void UHSSharedAbilitySystem::ActivateAbility(const FName& AbilityID, const TArra
     if (!AbilityData)
         return;
     
-    // 메모리 풀에서 능력 인스턴스 가져오기
-    FActiveSharedAbility* NewAbility = GetPooledAbility();
-    if (!NewAbility)
-    {
-        // 풀이 부족하면 새로 생성
-        ActiveAbilities.Add(AbilityID, FActiveSharedAbility());
-        NewAbility = ActiveAbilities.Find(AbilityID);
-    }
-    else
-    {
-        ActiveAbilities.Add(AbilityID, *NewAbility);
-        NewAbility = ActiveAbilities.Find(AbilityID);
-    }
+    // 메모리 풀에서 능력 인스턴스 가져오기 (슬롯 주소는 반환 전까지 유지됨)
+    const FHSSharedAbilityHandle Handle = GetPooledAbility();
+    FActiveSharedAbility* NewAbility = ResolveAbilityHandle(Handle);
+    check(NewAbility);
+    ActiveAbilities.Add(AbilityID, Handle);
     
     // 능력 정보 설정
     NewAbility->AbilityID = AbilityID;
@@ -434,11 +448,32 @@ void UHSSharedAbilitySystem::ActivateAbility(const FName& AbilityID, const TArra
     NewAbility->RemainingCooldown = 0.0f;
     NewAbility->bIsActive = true;
     
+    // 지속 시간 만료 예약 (지속 시간이 없으면 수동 비활성화 전까지 유지)
+    FAbilityPoolSlot& Slot = GetPoolSlot(Handle.SlotIndex);
+    Slot.DurationEndTime = 0.0;
+    if (AbilityData->Duration > 0.0f)
+    {
+        Slot.DurationEndTime = SharedAbilityTime + AbilityData->Duration;
+        
+        FAbilityExpiry DurationExpiry;
+        DurationExpiry.ExpireTime = Slot.DurationEndTime;
+        DurationExpiry.AbilityID = AbilityID;
+        DurationExpiry.Handle = Handle;
+        DurationExpiryHeap.HeapPush(DurationExpiry);
+    }
+    
     // 효과 적용
     ApplyAbilityEffects(*AbilityData, Participants);
     
     // 쿨다운 설정
-    AbilityCooldowns.Add(AbilityID, AbilityData->Cooldown);
+    if (AbilityData->Cooldown > 0.0f)
+    {
+        FAbilityExpiry CooldownExpiry;
+        CooldownExpiry.ExpireTime = SharedAbilityTime + AbilityData->Cooldown;
+        CooldownExpiry.AbilityID = AbilityID;
+        AbilityCooldownEndTimes.Add(AbilityID, CooldownExpiry.ExpireTime);
+        CooldownExpiryHeap.HeapPush(CooldownExpiry);
+    }
     
     // 이벤트 브로드캐스트
     OnSharedAbilityActivated.Broadcast(AbilityID, Participants);
@@ -448,7 +483,8 @@ void UHSSharedAbilitySystem::ActivateAbility(const FName& AbilityID, const TArra
 
 void UHSSharedAbilitySystem::DeactivateAbility(const FName& AbilityID)
 {
-    FActiveSharedAbility* ActiveAbility = ActiveAbilities.Find(AbilityID);
+    const FHSSharedAbilityHandle Handle = ActiveAbilities.FindRef(AbilityID);
+    FActiveSharedAbility* ActiveAbility = ResolveAbilityHandle(Handle);
     if (!ActiveAbility || !ActiveAbility->bIsActive)
         return;
     
@@ -458,8 +494,8 @@ void UHSSharedAbilitySystem::DeactivateAbility(const FName& AbilityID)
         RemoveAbilityEffects(*AbilityData, ActiveAbility->ParticipatingPlayers);
     }
     
-    // 능력을 풀로 반환
-    ReturnAbilityToPool(ActiveAbility);
+    // 능력을 풀로 반환 (기존 핸들은 세대가 바뀌어 무효가 됨)
+    ReturnAbilityToPool(Handle);
     ActiveAbilities.Remove(AbilityID);
     
     // 이벤트 브로드캐스트
@@ -903,31 +939,83 @@ void UHSSharedAbilitySystem::ProcessUltimateCombo(const FSharedAbilityData& Abil
     }
 }
 
-FActiveSharedAbility* UHSSharedAbilitySystem::GetPooledAbility()
+FHSSharedAbilityHandle UHSSharedAbilitySystem::GetPooledAbility()
 {
-    for (FActiveSharedAbility& Ability : AbilityPool)
+    // 자유 목록이 비었을 때만 새 청크 할당
+    if (FirstFreeSlotIndex == INDEX_NONE)
     {
-        if (!Ability.bIsActive)
-        {
-            return &Ability;
-        }
+        AllocateAbilityPoolChunk();
+    }
+    
+    const int32 SlotIndex = FirstFreeSlotIndex;
+    FAbilityPoolSlot& Slot = GetPoolSlot(SlotIndex);
+    FirstFreeSlotIndex = Slot.NextFreeSlotIndex;
+    Slot.NextFreeSlotIndex = INDEX_NONE;
+    Slot.bInUse = true;
+    
+    ++PooledAbilityInUseCount;
+    SET_DWORD_STAT(STAT_HSSharedAbilitiesInUse, PooledAbilityInUseCount);
+    
+    FHSSharedAbilityHandle Handle;
+    Handle.SlotIndex = SlotIndex;
+    Handle.Generation = Slot.Generation;
+    return Handle;
+}
+
+void UHSSharedAbilitySystem::ReturnAbilityToPool(const FHSSharedAbilityHandle& Handle)
+{
+    if (!ResolveAbilityHandle(Handle))
+    {
+        return;
+    }
+    
+    FAbilityPoolSlot& Slot = GetPoolSlot(Handle.SlotIndex);
+    Slot.Ability.AbilityID = NAME_None;
+    Slot.Ability.ParticipatingPlayers.Reset();
+    Slot.Ability.RemainingDuration = 0.0f;
+    Slot.Ability.RemainingCooldown = 0.0f;
+    Slot.Ability.bIsActive = false;
+    
+    // 세대를 올려 남아 있는 핸들을 무효화하고 자유 목록 앞에 연결
+    ++Slot.Generation;
+    Slot.bInUse = false;
+    Slot.NextFreeSlotIndex = FirstFreeSlotIndex;
+    FirstFreeSlotIndex = Handle.SlotIndex;
+    
+    --PooledAbilityInUseCount;
+    SET_DWORD_STAT(STAT_HSSharedAbilitiesInUse, PooledAbilityInUseCount);
+}
+
+void UHSSharedAbilitySystem::AllocateAbilityPoolChunk()
+{
+    const int32 FirstSlotIndex = AbilityPoolChunks.Num() * AbilityPoolChunkSize;
+    FAbilityPoolChunk& Chunk = *AbilityPoolChunks.Add_GetRef(MakeUnique<FAbilityPoolChunk>());
+    
+    // 새 슬롯을 인덱스 순서대로 자유 목록 앞에 연결
+    for (int32 Offset = AbilityPoolChunkSize - 1; Offset >= 0; --Offset)
+    {
+        Chunk.Slots[Offset].NextFreeSlotIndex = FirstFreeSlotIndex;
+        FirstFreeSlotIndex = FirstSlotIndex + Offset;
     }
     
-    // 풀이 부족하면 확장
-    int32 NewIndex = AbilityPool.AddDefaulted();
-    return &AbilityPool[NewIndex];
+    INC_DWORD_STAT(STAT_HSSharedAbilityPoolChunks);
+    UE_LOG(LogTemp, Verbose, TEXT("HSSharedAbilitySystem: 능력 풀 청크 할당 (총 %d슬롯)"), GetPooledAbilityCapacity());
+}
+
+UHSSharedAbilitySystem::FAbilityPoolSlot& UHSSharedAbilitySystem::GetPoolSlot(int32 SlotIndex) const
+{
+    return AbilityPoolChunks[SlotIndex / AbilityPoolChunkSize]->Slots[SlotIndex % AbilityPoolChunkSize];
 }
 
-void UHSSharedAbilitySystem::ReturnAbilityToPool(FActiveSharedAbility* Ability)
+FActiveSharedAbility* UHSSharedAbilitySystem::ResolveAbilityHandle(const FHSSharedAbilityHandle& Handle) const
 {
-    if (Ability)
+    if (Handle.SlotIndex < 0 || Handle.SlotIndex >= GetPooledAbilityCapacity())
     {
-        Ability->AbilityID = NAME_None;
-        Ability->ParticipatingPlayers.Empty();
-        Ability->RemainingDuration = 0.0f;
-        Ability->RemainingCooldown = 0.0f;
-        Ability->bIsActive = false;
+        return nullptr;
     }
+    
+    FAbilityPoolSlot& Slot = GetPoolSlot(Handle.SlotIndex);
+    return (Slot.bInUse && Slot.Generation == Handle.Generation) ? &Slot.Ability : nullptr;
 }
 
 void UHSSharedAbilitySystem::UpdateSpatialHash(const TArray<AHSCharacterBase*>& Players)
@@ -951,17 +1039,51 @@ void UHSSharedAbilitySystem::UpdateSpatialHash(const TArray<AHSCharacterBase*>&
     }
 }
 
-uint32 UHSSharedAbilitySystem::GetPlayerCombinationHash(const TArray<AHSCharacterBase*>& Players) const
+uint32 UHSSharedAbilitySystem::GetPlayerCombinationHash(const TArray<AHSCharacterBase*>& Players, TArray<uint64, TInlineAllocator<8>>& OutMemberKeys) const
 {
-    uint32 Hash = 0;
-    
+    // 참가자별 (고유 ID, 클래스) 키를 정렬해 순서와 무관한 조합 키를 만듦 (클래스가 바뀌면 다른 조합)
+    OutMemberKeys.Reset(Players.Num());
     for (const AHSCharacterBase* Player : Players)
     {
-        if (Player)
-        {
-            Hash = HashCombine(Hash, GetTypeHash(Player->GetUniqueID()));
-        }
+        OutMemberKeys.Add(Player ? (static_cast<uint64>(Player->GetUniqueID()) << 32) | GetSynergyClassKey(Player) : 0);
+    }
+    OutMemberKeys.Sort();
+    
+    uint32 Hash = 0;
+    for (const uint64 MemberKey : OutMemberKeys)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(MemberKey));
     }
     
     return Hash;
 }
+
+uint32 UHSSharedAbilitySystem::GetSynergyClassKey(const AHSCharacterBase* Player)
+{
+    // 플레이어는 직업, 그 외 캐릭터는 액터 클래스로 구분
+    if (const AHSPlayerCharacter* PlayerCharacter = Cast<AHSPlayerCharacter>(Player))
+    {
+        return static_cast<uint32>(PlayerCharacter->GetPlayerClass());
+    }
+    return GetTypeHash(Player->GetClass()->GetFName());
+}
+
+void UHSSharedAbilitySystem::InvalidateSynergyCache()
+{
+    SynergyBonusCache.Reset();
+}
+
+void UHSSharedAbilitySystem::HandlePlayerJoinedTeam(int32 TeamID, APlayerState* PlayerState, const FHSTeamInfo& TeamInfo)
+{
+    InvalidateSynergyCache();
+}
+
+void UHSSharedAbilitySystem::HandlePlayerLeftTeam(int32 TeamID, APlayerState* PlayerState, const FHSTeamInfo& TeamInfo)
+{
+    InvalidateSynergyCache();
+}
+
+void UHSSharedAbilitySystem::HandleTeamDisbanded(int32 TeamID, const FHSTeamInfo& TeamInfo)
+{
+    InvalidateSynergyCache();
+}
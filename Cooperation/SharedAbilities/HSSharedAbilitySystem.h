@@ -125,6 +125,16 @@ struct FActiveSharedAbility
     }
 };
 
+// 능력 풀 슬롯 핸들 (슬롯이 반환·재사용되면 세대가 달라져 무효가 됨)
+struct FHSSharedAbilityHandle
+{
+    int32 SlotIndex = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return SlotIndex != INDEX_NONE; }
+    void Reset() { SlotIndex = INDEX_NONE; Generation = 0; }
+};
+
 // 공유 능력 시스템 델리게이트
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSharedAbilityActivated, const FName&, AbilityID, const TArray<AHSCharacterBase*>&, Participants);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSharedAbilityDeactivated, const FName&, AbilityID);
@@ -139,6 +149,10 @@ class HUNTINGSPIRIT_API UHSSharedAbilitySystem : public UObject
 {
     GENERATED_BODY()
 
+#if WITH_DEV_AUTOMATION_TESTS
+    friend class FHSSharedAbilityPoolStressTest;
+#endif
+
 public:
     UHSSharedAbilitySystem();
 
@@ -187,6 +201,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Shared Ability")
     float CalculateSynergyBonus(const TArray<AHSCharacterBase*>& Players) const;
 
+    // 시너지 캐시 무효화 (팀 구성 변경 시 호출됨)
+    UFUNCTION(BlueprintCallable, Category = "Shared Ability")
+    void InvalidateSynergyCache();
+
     // 클래스 조합 확인
     UFUNCTION(BlueprintCallable, Category = "Shared Ability")
     bool CheckClassCombination(const TArray<FName>& RequiredClasses, const TArray<AHSCharacterBase*>& Players) const;
@@ -205,6 +223,13 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Shared Ability")
     FOnSharedAbilityFailed OnSharedAbilityFailed;
 
+    // UObject 인터페이스 (풀 슬롯의 참가자 참조를 GC에 알림)
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+    // 능력 풀 통계
+    int32 GetPooledAbilityCapacity() const { return AbilityPoolChunks.Num() * AbilityPoolChunkSize; }
+    int32 GetPooledAbilityInUseCount() const { return PooledAbilityInUseCount; }
+
 protected:
     // 능력 활성화 처리
     void ActivateAbility(const FName& AbilityID, const TArray<AHSCharacterBase*>& Participants);
@@ -228,6 +253,16 @@ protected:
     void ProcessReviveAssist(const FSharedAbilityData& AbilityData, const TArray<AHSCharacterBase*>& Participants);
     void ProcessUltimateCombo(const FSharedAbilityData& AbilityData, const TArray<AHSCharacterBase*>& Participants);
 
+    // 팀 구성 변경 이벤트 핸들러
+    UFUNCTION()
+    void HandlePlayerJoinedTeam(int32 TeamID, APlayerState* PlayerState, const FHSTeamInfo& TeamInfo);
+
+    UFUNCTION()
+    void HandlePlayerLeftTeam(int32 TeamID, APlayerState* PlayerState, const FHSTeamInfo& TeamInfo);
+
+    UFUNCTION()
+    void HandleTeamDisbanded(int32 TeamID, const FHSTeamInfo& TeamInfo);
+
 private:
     // 팀 매니저 참조
     UPROPERTY()
@@ -237,29 +272,74 @@ private:
     UPROPERTY()
     TMap<FName, FSharedAbilityData> RegisteredAbilities;
 
-    // 활성화된 공유 능력
-    UPROPERTY()
-    TMap<FName, FActiveSharedAbility> ActiveAbilities;
+    // 활성화된 공유 능력 (능력 풀 슬롯 핸들)
+    TMap<FName, FHSSharedAbilityHandle> ActiveAbilities;
 
-    // 쿨다운 관리
+    // 쿨다운 관리 (능력별 쿨다운 종료 시각)
     UPROPERTY()
-    TMap<FName, float> AbilityCooldowns;
+    TMap<FName, double> AbilityCooldownEndTimes;
+
+    // 만료 시각 기준 최소 힙 항목 (지속 시간/쿨다운 공용)
+    struct FAbilityExpiry
+    {
+        double ExpireTime = 0.0;
+        FName AbilityID;
+        FHSSharedAbilityHandle Handle;
+
+        bool operator<(const FAbilityExpiry& Other) const { return ExpireTime < Other.ExpireTime; }
+    };
+
+    // 지속 시간 만료 힙 (핸들이 무효가 된 항목은 꺼낼 때 무시)
+    TArray<FAbilityExpiry> DurationExpiryHeap;
+
+    // 쿨다운 만료 힙 (종료 시각이 바뀐 항목은 꺼낼 때 무시)
+    TArray<FAbilityExpiry> CooldownExpiryHeap;
+
+    // 시스템 시계 (TickSharedAbilities 누적 시간)
+    double SharedAbilityTime;
 
     // 메모리 풀링을 위한 능력 인스턴스 풀
-    TArray<FActiveSharedAbility> AbilityPool;
-    int32 AbilityPoolSize;
+    // 고정 크기 청크 단위로 늘려 기존 슬롯 주소가 바뀌지 않으며, 빈 슬롯은 슬롯 내부 링크로 연결된 자유 목록으로 관리
+    static constexpr int32 AbilityPoolChunkSize = 64;
+
+    struct FAbilityPoolSlot
+    {
+        FActiveSharedAbility Ability;
+        uint32 Generation = 1;
+        int32 NextFreeSlotIndex = INDEX_NONE;
+        double DurationEndTime = 0.0;
+        bool bInUse = false;
+    };
+
+    struct FAbilityPoolChunk
+    {
+        FAbilityPoolSlot Slots[AbilityPoolChunkSize];
+    };
+
+    TArray<TUniquePtr<FAbilityPoolChunk>> AbilityPoolChunks;
+    int32 FirstFreeSlotIndex;
+    int32 PooledAbilityInUseCount;
 
     // 성능 최적화를 위한 캐시
-    mutable TMap<uint32, float> SynergyBonusCache;
-    mutable float CacheInvalidationTimer;
+    // 참가자 (ID, 클래스) 키를 정렬한 조합 단위로 저장해 참가자 순서와 무관하게 적중
+    struct FSynergyCacheEntry
+    {
+        TArray<uint64, TInlineAllocator<8>> MemberKeys;
+        float SynergyBonus = 1.0f;
+    };
+    mutable TMap<uint32, FSynergyCacheEntry> SynergyBonusCache;
 
     // 최적화된 거리 계산을 위한 공간 해시
     TMap<int32, TArray<AHSCharacterBase*>> SpatialHash;
     float SpatialHashCellSize;
 
     // 헬퍼 함수
-    FActiveSharedAbility* GetPooledAbility();
-    void ReturnAbilityToPool(FActiveSharedAbility* Ability);
+    FHSSharedAbilityHandle GetPooledAbility();
+    void ReturnAbilityToPool(const FHSSharedAbilityHandle& Handle);
+    void AllocateAbilityPoolChunk();
+    FAbilityPoolSlot& GetPoolSlot(int32 SlotIndex) const;
+    FActiveSharedAbility* ResolveAbilityHandle(const FHSSharedAbilityHandle& Handle) const;
     void UpdateSpatialHash(const TArray<AHSCharacterBase*>& Players);
-    uint32 GetPlayerCombinationHash(const TArray<AHSCharacterBase*>& Players) const;
+    uint32 GetPlayerCombinationHash(const TArray<AHSCharacterBase*>& Players, TArray<uint64, TInlineAllocator<8>>& OutMemberKeys) const;
+    static uint32 GetSynergyClassKey(const AHSCharacterBase* Player);
 };
@@ -6,6 +6,9 @@
 #include "HuntingSpirit/Characters/Stats/HSStatsComponent.h"
 #include "HuntingSpirit/Enemies/Bosses/HSBossBase.h"
 #include "HuntingSpirit/Optimization/HSPerformanceOptimizer.h"
+#include "HuntingSpirit/Optimization/HSGarbageCollectionManager.h"
+#include "HuntingSpirit/RoguelikeSystem/RunManagement/HSRunManager.h"
+#include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "TimerManager.h"
@@ -58,9 +61,21 @@ AHSGameStateBase::AHSGameStateBase()
     PrimaryActorTick.bCanEverTick = true;
     PrimaryActorTick.TickInterval = 0.1f; // 10FPS로 제한하여 성능 최적화
 
-    // 메모리 풀 초기화
-    FPSSamples.Reserve(FPSSampleSize);
-    PingSamples.Reserve(PingSampleSize);
+    // 샘플 창 초기화
+    FPSSamples.Initialize(FPSSampleSize);
+    PingSamples.Initialize(PingSampleSize);
+}
+
+// 컴포넌트 초기화 후 호출 (클라이언트는 첫 복제 전에 팀 관리자를 연결해야 FastArray 콜백을 받음)
+void AHSGameStateBase::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    UGameInstance* GameInstance = GetGameInstance();
+    if (UHSTeamManager* GameTeamManager = GameInstance ? GameInstance->GetSubsystem<UHSTeamManager>() : nullptr)
+    {
+        GameTeamManager->BindTeamDatabase(TeamDatabase);
+    }
 }
 
 // 게임 시작 시 호출
@@ -121,6 +136,30 @@ void AHSGameStateBase::Tick(float DeltaTime)
     }
 }
 
+// 플레이어 상태 추가 (서버는 로그인 시, 클라이언트는 복제 시)
+void AHSGameStateBase::AddPlayerState(APlayerState* PlayerState)
+{
+    Super::AddPlayerState(PlayerState);
+
+    UGameInstance* GameInstance = GetGameInstance();
+    if (UHSRunManager* RunManager = GameInstance ? GameInstance->GetSubsystem<UHSRunManager>() : nullptr)
+    {
+        RunManager->NotifyPlayerStateAdded(PlayerState);
+    }
+}
+
+// 플레이어 상태 제거
+void AHSGameStateBase::RemovePlayerState(APlayerState* PlayerState)
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    if (UHSRunManager* RunManager = GameInstance ? GameInstance->GetSubsystem<UHSRunManager>() : nullptr)
+    {
+        RunManager->NotifyPlayerStateRemoved(PlayerState);
+    }
+
+    Super::RemovePlayerState(PlayerState);
+}
+
 // 게임 종료 시 호출
 void AHSGameStateBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
@@ -134,9 +173,21 @@ void AHSGameStateBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
         TimerManager.ClearTimer(BossHealthUpdateTimer);
     }
 
+    // 플레이어 사망 이벤트 바인딩 해제
+    for (auto& CensusPair : PlayerCensus)
+    {
+        AHSCharacterBase* Player = CensusPair.Value.Player.Get();
+        if (UHSStatsComponent* StatsComp = Player ? Player->GetStatsComponent() : nullptr)
+        {
+            StatsComp->OnDeath.Remove(CensusPair.Value.DeathHandle);
+        }
+    }
+    PlayerCensus.Empty();
+
     // 시스템 정리
     if (CoopMechanics)
     {
+        CoopMechanics->OnRevivalCompleted.RemoveDynamic(this, &AHSGameStateBase::HandleCoopRevivalCompleted);
         CoopMechanics->Shutdown();
     }
 
@@ -145,6 +196,12 @@ void AHSGameStateBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
         SharedAbilitySystem->Shutdown();
     }
 
+    UGameInstance* GameInstance = GetGameInstance();
+    if (UHSTeamManager* GameTeamManager = GameInstance ? GameInstance->GetSubsystem<UHSTeamManager>() : nullptr)
+    {
+        GameTeamManager->UnbindTeamDatabase(TeamDatabase);
+    }
+
     UE_LOG(LogTemp, Log, TEXT("HSGameStateBase: 게임 상태 정리 완료"));
 
     Super::EndPlay(EndPlayReason);
@@ -159,6 +216,7 @@ void AHSGameStateBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
     DOREPLIFETIME(AHSGameStateBase, CurrentGamePhase);
     DOREPLIFETIME(AHSGameStateBase, GameStatistics);
     DOREPLIFETIME(AHSGameStateBase, WorldState);
+    DOREPLIFETIME(AHSGameStateBase, TeamDatabase);
 }
 
 // === 게임 페이즈 관리 ===
@@ -183,6 +241,12 @@ void AHSGameStateBase::SetGamePhase(EHSGamePhase NewPhase, bool bForceChange)
     // 페이즈 전환 처리
     ProcessGamePhaseTransition(OldPhase, NewPhase);
 
+    // 가비지 컬렉션 정책에 페이즈 전환 알림 (전투 집중 구간 판단 및 휴지 구간)
+    if (UHSGarbageCollectionManager* GCManager = GetWorld()->GetSubsystem<UHSGarbageCollectionManager>())
+    {
+        GCManager->NotifyGamePhaseChanged(NewPhase);
+    }
+
     // 이벤트 브로드캐스트
     OnGamePhaseChanged.Broadcast(OldPhase, NewPhase);
 
@@ -218,8 +282,28 @@ void AHSGameStateBase::OnPlayerJoined(AHSCharacterBase* JoiningPlayer)
     // 스레드 안전성을 위한 뮤텍스 락
     FScopeLock StatisticsLock(&StatisticsMutex);
 
+    // 같은 플레이어의 중복 참여는 무시
+    const TObjectKey<AHSCharacterBase> PlayerKey(JoiningPlayer);
+    if (PlayerCensus.Contains(PlayerKey))
+    {
+        return;
+    }
+
+    FPlayerCensusEntry& CensusEntry = PlayerCensus.Add(PlayerKey);
+    CensusEntry.Player = JoiningPlayer;
+
+    UHSStatsComponent* StatsComp = JoiningPlayer->GetStatsComponent();
+    CensusEntry.bAlive = !StatsComp || !StatsComp->IsDead();
+    if (StatsComp)
+    {
+        CensusEntry.DeathHandle = StatsComp->OnDeath.AddUObject(this, &AHSGameStateBase::HandleCensusPlayerDeath);
+    }
+
     GameStatistics.TotalPlayers++;
-    GameStatistics.AlivePlayers++;
+    if (CensusEntry.bAlive)
+    {
+        GameStatistics.AlivePlayers++;
+    }
 
     // 이벤트 브로드캐스트
     OnPlayerCountChanged.Broadcast(GameStatistics.TotalPlayers);
@@ -245,8 +329,22 @@ void AHSGameStateBase::OnPlayerLeft(AHSCharacterBase* LeavingPlayer)
 
     FScopeLock StatisticsLock(&StatisticsMutex);
 
+    FPlayerCensusEntry CensusEntry;
+    if (!PlayerCensus.RemoveAndCopyValue(LeavingPlayer, CensusEntry))
+    {
+        return;
+    }
+
+    if (UHSStatsComponent* StatsComp = LeavingPlayer->GetStatsComponent())
+    {
+        StatsComp->OnDeath.Remove(CensusEntry.DeathHandle);
+    }
+
     GameStatistics.TotalPlayers = FMath::Max(0, GameStatistics.TotalPlayers - 1);
-    GameStatistics.AlivePlayers = FMath::Max(0, GameStatistics.AlivePlayers - 1);
+    if (CensusEntry.bAlive)
+    {
+        GameStatistics.AlivePlayers = FMath::Max(0, GameStatistics.AlivePlayers - 1);
+    }
 
     OnPlayerCountChanged.Broadcast(GameStatistics.TotalPlayers);
 
@@ -264,6 +362,14 @@ void AHSGameStateBase::OnPlayerDied(AHSCharacterBase* DeadPlayer, AActor* Killer
 
     FScopeLock StatisticsLock(&StatisticsMutex);
 
+    // 참여하지 않았거나 이미 사망 처리된 플레이어는 무시
+    FPlayerCensusEntry* CensusEntry = PlayerCensus.Find(DeadPlayer);
+    if (!CensusEntry || !CensusEntry->bAlive)
+    {
+        return;
+    }
+
+    CensusEntry->bAlive = false;
     GameStatistics.AlivePlayers = FMath::Max(0, GameStatistics.AlivePlayers - 1);
 
     // 이벤트 브로드캐스트
@@ -283,6 +389,14 @@ void AHSGameStateBase::HandlePlayerRevived(AHSCharacterBase* RevivedPlayer, AHSC
 
     FScopeLock StatisticsLock(&StatisticsMutex);
 
+    // 사망 상태인 참여 플레이어만 부활 처리
+    FPlayerCensusEntry* CensusEntry = PlayerCensus.Find(RevivedPlayer);
+    if (!CensusEntry || CensusEntry->bAlive)
+    {
+        return;
+    }
+
+    CensusEntry->bAlive = true;
     GameStatistics.AlivePlayers++;
     GameStatistics.RevivalCount++;
 
@@ -511,6 +625,12 @@ void AHSGameStateBase::InitializeSystems()
         }
     }
 
+    // 부활 완료 시 생존 인원 갱신
+    if (CoopMechanics)
+    {
+        CoopMechanics->OnRevivalCompleted.AddDynamic(this, &AHSGameStateBase::HandleCoopRevivalCompleted);
+    }
+
     // 성능 최적화 시스템 생성
     PerformanceOptimizer = NewObject<UHSPerformanceOptimizer>(this);
 
@@ -526,12 +646,9 @@ void AHSGameStateBase::InitializePerformanceMonitoring()
         return;
     }
 
-    // FPS 및 핑 샘플 배열 초기화
-    FPSSamples.Empty();
-    FPSSamples.Reserve(FPSSampleSize);
-
-    PingSamples.Empty();
-    PingSamples.Reserve(PingSampleSize);
+    // FPS 및 핑 샘플 창 초기화
+    FPSSamples.Initialize(FPSSampleSize);
+    PingSamples.Initialize(PingSampleSize);
 
     UE_LOG(LogTemp, Log, TEXT("HSGameStateBase: 성능 모니터링 초기화 완료"));
 }
@@ -635,19 +752,8 @@ void AHSGameStateBase::UpdatePerformanceMonitoring()
         float CurrentFrameRate = 1.0f / DeltaTime;
         FPSSamples.Add(CurrentFrameRate);
 
-        // 샘플 크기 제한
-        if (FPSSamples.Num() > FPSSampleSize)
-        {
-            FPSSamples.RemoveAt(0);
-        }
-
-        // 평균 FPS 계산
-        float TotalFPS = 0.0f;
-        for (float Sample : FPSSamples)
-        {
-            TotalFPS += Sample;
-        }
-        CurrentFPS = FPSSamples.Num() > 0 ? TotalFPS / FPSSamples.Num() : 60.0f;
+        // 평균 FPS (누적 합 기반)
+        CurrentFPS = FPSSamples.GetAverage(60.0f);
     }
 
     // 메모리 사용량 계산
@@ -673,18 +779,7 @@ void AHSGameStateBase::UpdatePerformanceMonitoring()
         {
             float CurrentPing = TotalPing / ClientCount;
             PingSamples.Add(CurrentPing);
-
-            if (PingSamples.Num() > PingSampleSize)
-            {
-                PingSamples.RemoveAt(0);
-            }
-
-            float TotalPingSample = 0.0f;
-            for (float Sample : PingSamples)
-            {
-                TotalPingSample += Sample;
-            }
-            AverageNetworkPing = PingSamples.Num() > 0 ? TotalPingSample / PingSamples.Num() : 0.0f;
+            AverageNetworkPing = PingSamples.GetAverage(0.0f);
         }
     }
 }
@@ -692,47 +787,26 @@ void AHSGameStateBase::UpdatePerformanceMonitoring()
 // 통계 업데이트
 void AHSGameStateBase::UpdateStatistics()
 {
-    // 플레이어 수 재계산 (정확성을 위해)
-    TArray<AHSCharacterBase*> AllPlayers;
-    for (TActorIterator<AHSCharacterBase> ActorItr(GetWorld()); ActorItr; ++ActorItr)
-    {
-        if (AHSCharacterBase* Player = *ActorItr)
-        {
-            AllPlayers.Add(Player);
-        }
-    }
-
+    // 플레이어 수는 참여/이탈/사망/부활 이벤트에서 갱신되므로 월드 순회 없이 브로드캐스트만 수행
     FScopeLock StatisticsLock(&StatisticsMutex);
-    
-    GameStatistics.TotalPlayers = AllPlayers.Num();
-    
-    // 생존 플레이어 수 계산
-    int32 AliveCount = 0;
-    for (AHSCharacterBase* Player : AllPlayers)
-    {
-        if (Player && IsValid(Player))
-        {
-            // 체력이 0보다 크면 생존으로 간주
-            if (UHSStatsComponent* StatsComp = Player->FindComponentByClass<UHSStatsComponent>())
-            {
-                if (StatsComp->GetCurrentHealth() > 0.0f)
-                {
-                    AliveCount++;
-                }
-            }
-            else
-            {
-                // StatsComponent가 없으면 기본적으로 생존으로 간주
-                AliveCount++;
-            }
-        }
-    }
-    GameStatistics.AlivePlayers = AliveCount;
 
     // 통계 업데이트 이벤트 브로드캐스트
     OnGameStatisticsUpdated.Broadcast(GameStatistics);
 }
 
+// 스탯 컴포넌트 사망 이벤트 처리
+void AHSGameStateBase::HandleCensusPlayerDeath(AActor* DeadActor)
+{
+    OnPlayerDied(Cast<AHSCharacterBase>(DeadActor));
+}
+
+// 협동 부활 완료 이벤트 처리
+void AHSGameStateBase::HandleCoopRevivalCompleted(AHSCharacterBase* RevivedPlayer)
+{
+    // 부활 쌍은 브로드캐스트 이후에 제거되므로 여기서 부활시킨 플레이어를 조회할 수 있음
+    HandlePlayerRevived(RevivedPlayer, CoopMechanics ? CoopMechanics->GetReviver(RevivedPlayer) : nullptr);
+}
+
 // 가비지 컬렉션 실행
 void AHSGameStateBase::PerformGarbageCollection()
 {
@@ -745,10 +819,13 @@ void AHSGameStateBase::PerformGarbageCollection()
     // 오브젝트 풀 최적화
     OptimizeObjectPools();
 
-    // 강제 가비지 컬렉션 (주의: 성능에 영향을 줄 수 있음)
-    GEngine->ForceGarbageCollection(true);
+    // 가비지 컬렉션은 정책 관리자에 요청만 하고, 전투 구간을 피해 점진적으로 수행
+    if (UHSGarbageCollectionManager* GCManager = GetWorld()->GetSubsystem<UHSGarbageCollectionManager>())
+    {
+        GCManager->RequestCollection(false, TEXT("HSGameStateBase"));
+    }
 
-    UE_LOG(LogTemp, Verbose, TEXT("HSGameStateBase: 가비지 컬렉션 수행 완료"));
+    UE_LOG(LogTemp, Verbose, TEXT("HSGameStateBase: 정리 작업 완료, 가비지 컬렉션 요청"));
 }
 
 // 보스 체력 업데이트
@@ -825,6 +902,23 @@ void AHSGameStateBase::LogPerformanceStats() const
 // 사용하지 않는 참조 정리
 void AHSGameStateBase::CleanupUnusedReferences()
 {
+    // 이탈 알림 없이 사라진 플레이어를 인구 조사에서 제거
+    {
+        FScopeLock StatisticsLock(&StatisticsMutex);
+        for (auto It = PlayerCensus.CreateIterator(); It; ++It)
+        {
+            if (!It->Value.Player.IsValid())
+            {
+                GameStatistics.TotalPlayers = FMath::Max(0, GameStatistics.TotalPlayers - 1);
+                if (It->Value.bAlive)
+                {
+                    GameStatistics.AlivePlayers = FMath::Max(0, GameStatistics.AlivePlayers - 1);
+                }
+                It.RemoveCurrent();
+            }
+        }
+    }
+
     // 무효한 보스 참조 정리
     if (WorldState.CurrentBoss.IsValid() && !IsValid(WorldState.CurrentBoss.Get()))
     {
@@ -851,19 +945,8 @@ void AHSGameStateBase::CleanupUnusedReferences()
 // 메모리 풀 관리
 void AHSGameStateBase::ManageMemoryPools()
 {
-    // FPS 샘플 메모리 관리
-    if (FPSSamples.Num() > FPSSampleSize * 2)
-    {
-        FPSSamples.RemoveAt(0, FPSSamples.Num() - FPSSampleSize);
-        FPSSamples.Shrink();
-    }
-
-    // 핑 샘플 메모리 관리
-    if (PingSamples.Num() > PingSampleSize * 2)
-    {
-        PingSamples.RemoveAt(0, PingSamples.Num() - PingSampleSize);
-        PingSamples.Shrink();
-    }
+    // 샘플 창은 고정 크기이므로 정리할 메모리가 없음
+    PlayerCensus.Compact();
 }
 
 // 오브젝트 풀 최적화
@@ -882,7 +965,4 @@ void AHSGameStateBase::OptimizeObjectPools()
     {
         UHSAdvancedMemoryManager::CleanupAllPools();
     }
-
-    FPSSamples.Shrink();
-    PingSamples.Shrink();
 }
@@ -8,6 +8,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "UObject/ObjectKey.h"
 #include "HuntingSpirit/Cooperation/HSTeamManager.h"
 #include "HuntingSpirit/Cooperation/HSCoopMechanics.h"
 #include "HuntingSpirit/Cooperation/SharedAbilities/HSSharedAbilitySystem.h"
@@ -144,6 +145,63 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlayerRevived, AHSCharacterBase*
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlayerEliminated, AHSCharacterBase*, EliminatedPlayer, AActor*, Killer);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGameStatisticsUpdated, const FHSGameStateStatistics&, NewStatistics);
 
+// 고정 크기 샘플 창 (링 버퍼 + 누적 합으로 평균을 O(1)에 계산)
+struct FHSSampleWindow
+{
+    void Initialize(int32 InCapacity)
+    {
+        Samples.Reset();
+        Samples.SetNumZeroed(FMath::Max(1, InCapacity));
+        NextIndex = 0;
+        Count = 0;
+        RunningSum = 0.0;
+    }
+
+    void Add(float Value)
+    {
+        if (Samples.Num() == 0)
+        {
+            Initialize(1);
+        }
+
+        if (Count == Samples.Num())
+        {
+            RunningSum -= Samples[NextIndex];
+        }
+        else
+        {
+            ++Count;
+        }
+
+        Samples[NextIndex] = Value;
+        RunningSum += Value;
+        NextIndex = (NextIndex + 1) % Samples.Num();
+
+        // 한 바퀴마다 다시 합산해 누적 오차 제거
+        if (NextIndex == 0)
+        {
+            RunningSum = 0.0;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                RunningSum += Samples[Index];
+            }
+        }
+    }
+
+    float GetAverage(float DefaultValue) const
+    {
+        return Count > 0 ? static_cast<float>(RunningSum / Count) : DefaultValue;
+    }
+
+    int32 Num() const { return Count; }
+
+private:
+    TArray<float> Samples;
+    int32 NextIndex = 0;
+    int32 Count = 0;
+    double RunningSum = 0.0;
+};
+
 /**
  * 사냥의 영혼 게임 상태 클래스
  * 
@@ -166,10 +224,15 @@ public:
     AHSGameStateBase();
 
     // AActor interface
+    virtual void PostInitializeComponents() override;
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+    // AGameStateBase interface (런 참가자 추적에 플레이어 추가/제거를 알림)
+    virtual void AddPlayerState(APlayerState* PlayerState) override;
+    virtual void RemovePlayerState(APlayerState* PlayerState) override;
+
     // 네트워크 복제 설정
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -451,6 +514,10 @@ protected:
     UPROPERTY(Replicated, BlueprintReadOnly, Category = "Game State")
     FHSWorldState WorldState;
 
+    // 팀 데이터베이스 (FastArray로 변경된 팀만 복제, 팀 관리자가 연결해 읽고 씀)
+    UPROPERTY(Replicated)
+    FHSTeamDatabase TeamDatabase;
+
     // === 시스템 컴포넌트들 ===
 
     // 팀 매니저 참조
@@ -483,13 +550,22 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Performance Monitoring")
     float AverageNetworkPing;
 
-    // FPS 샘플링을 위한 배열
-    UPROPERTY()
-    TArray<float> FPSSamples;
+    // FPS 샘플 창
+    FHSSampleWindow FPSSamples;
+
+    // 핑 샘플 창
+    FHSSampleWindow PingSamples;
 
-    // 핑 샘플링을 위한 배열
-    UPROPERTY()
-    TArray<float> PingSamples;
+    // === 플레이어 인구 조사 (참여/이탈/사망/부활 이벤트로 갱신) ===
+
+    struct FPlayerCensusEntry
+    {
+        TWeakObjectPtr<AHSCharacterBase> Player;
+        FDelegateHandle DeathHandle;
+        bool bAlive = true;
+    };
+
+    TMap<TObjectKey<AHSCharacterBase>, FPlayerCensusEntry> PlayerCensus;
 
     // === 타이머 핸들들 ===
 
@@ -562,14 +638,21 @@ private:
     UFUNCTION()
     void UpdatePerformanceMonitoring();
 
-    // 통계 업데이트
+    // 통계 브로드캐스트 (플레이어 수는 이벤트로 갱신되어 있음)
     UFUNCTION()
     void UpdateStatistics();
 
-    // 가비지 컬렉션 실행
+    // 참조 정리 후 가비지 컬렉션 요청
     UFUNCTION()
     void PerformGarbageCollection();
 
+    // 스탯 컴포넌트 사망 이벤트 처리
+    void HandleCensusPlayerDeath(AActor* DeadActor);
+
+    // 협동 부활 완료 이벤트 처리
+    UFUNCTION()
+    void HandleCoopRevivalCompleted(AHSCharacterBase* RevivedPlayer);
+
     // 보스 체력 업데이트
     UFUNCTION()
     void UpdateBossHealth();
@@ -11,6 +11,10 @@
 #include "GameFramework/PlayerController.h"
 #include "Engine/NetConnection.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "GameFramework/GameStateBase.h"
+#include "Stats/Stats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("PlayerState Statistics Replicated Bytes (Est.)"), STAT_HSPlayerStatisticsReplicatedBytes, STATGROUP_Game);
 
 // 생성자
 AHSPlayerState::AHSPlayerState()
@@ -23,6 +27,8 @@ AHSPlayerState::AHSPlayerState()
     
     // 구조체 기본값 초기화
     PlayerStatistics = FHSPlayerSessionStatistics();
+    CombatStatistics = FHSPlayerCombatStatistics();
+    LifeStartServerTime = -1.0f; // 생존 시작 전
     LevelInfo = FHSPlayerLevelInfo();
     InventoryState = FHSPlayerInventoryState();
 
@@ -37,6 +43,7 @@ AHSPlayerState::AHSPlayerState()
     ExperienceScalingFactor = 1.2f;
     MaxLevel = 50;
     StatisticsUpdateInterval = 10.0f; // 10초마다
+    StatisticsReplicationInterval = 0.5f; // 전투 누계는 0.5초마다 반영
     NetworkStatusCheckInterval = 5.0f; // 5초마다
 
     // 플래그 초기화
@@ -45,8 +52,7 @@ AHSPlayerState::AHSPlayerState()
     // 네트워크 복제 설정
     bReplicates = true;
     bAlwaysRelevant = true;
-    PrimaryActorTick.bCanEverTick = true;
-    PrimaryActorTick.TickInterval = 1.0f; // 1초마다 틱 (성능 최적화)
+    PrimaryActorTick.bCanEverTick = false; // 생존 시간은 복제된 시작 시각으로 계산하므로 틱 불필요
 
     // 레벨 정보 기본값 설정
     LevelInfo.ExperienceToNextLevel = CalculateExperienceForNextLevel(1);
@@ -64,6 +70,7 @@ void AHSPlayerState::BeginPlay()
     // 서버에서만 타이머 설정
     if (HasAuthority())
     {
+        StatisticsReplicationStartTime = PlayStartTime;
         SetupTimers();
     }
 
@@ -77,25 +84,6 @@ void AHSPlayerState::BeginPlay()
     UE_LOG(LogTemp, Log, TEXT("HSPlayerState: 플레이어 상태 초기화 완료 - %s"), *GetPlayerName());
 }
 
-// 매 프레임 호출
-void AHSPlayerState::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-
-    // 서버에서만 실행
-    if (!HasAuthority() || !bInitialized)
-    {
-        return;
-    }
-
-    // 생존 시간 업데이트 (생존 상태인 경우만)
-    if (PlayerStatus == EHSPlayerStatus::PS_Alive)
-    {
-        float CurrentTime = GetWorld()->GetTimeSeconds();
-        PlayerStatistics.SurvivalTime = CurrentTime - CurrentLifeStartTime;
-    }
-}
-
 // 게임 종료 시 호출
 void AHSPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
@@ -103,7 +91,7 @@ void AHSPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
     if (UWorld* World = GetWorld())
     {
         FTimerManager& TimerManager = World->GetTimerManager();
-        TimerManager.ClearTimer(SurvivalTimeUpdateTimer);
+        TimerManager.ClearTimer(StatisticsFlushTimer);
         TimerManager.ClearTimer(StatisticsUpdateTimer);
         TimerManager.ClearTimer(NetworkStatusTimer);
     }
@@ -123,7 +111,12 @@ void AHSPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
     DOREPLIFETIME(AHSPlayerState, PlayerClass);
     DOREPLIFETIME(AHSPlayerState, PlayerRole);
     DOREPLIFETIME(AHSPlayerState, TeamID);
-    DOREPLIFETIME(AHSPlayerState, PlayerStatistics);
+
+    // 통계는 서버에서 변경 시점/반영 주기에만 값이 바뀌므로 속성 비교만 남고 전송은 변경 시에만 발생
+    // (푸시 모델은 NetCore 모듈 의존성과 net.IsPushModelEnabled 설정이 필요해 사용하지 않음)
+    DOREPLIFETIME_CONDITION_NOTIFY(AHSPlayerState, PlayerStatistics, COND_None, REPNOTIFY_OnChanged);
+    DOREPLIFETIME_CONDITION_NOTIFY(AHSPlayerState, CombatStatistics, COND_None, REPNOTIFY_OnChanged);
+    DOREPLIFETIME_CONDITION(AHSPlayerState, LifeStartServerTime, COND_None);
     DOREPLIFETIME(AHSPlayerState, LevelInfo);
     DOREPLIFETIME(AHSPlayerState, InventoryState);
 }
@@ -151,12 +144,19 @@ void AHSPlayerState::SetPlayerStatus(EHSPlayerStatus NewStatus)
     switch (NewStatus)
     {
         case EHSPlayerStatus::PS_Alive:
-            // 생존 시작 시간 기록
+            // 생존 시작 시간 기록 (클라이언트는 복제된 시작 시각으로 생존 시간 계산)
             CurrentLifeStartTime = GetWorld()->GetTimeSeconds();
+            LifeStartServerTime = CurrentLifeStartTime;
+            EstimatedStatisticsReplicatedBytes += sizeof(LifeStartServerTime);
+            INC_DWORD_STAT_BY(STAT_HSPlayerStatisticsReplicatedBytes, sizeof(LifeStartServerTime));
             break;
 
         case EHSPlayerStatus::PS_Dead:
-            // 데스 카운트 증가
+            // 마지막 생존 시간을 고정한 뒤 데스 카운트 증가 (같은 더티 표시로 함께 전송)
+            if (OldStatus == EHSPlayerStatus::PS_Alive)
+            {
+                PlayerStatistics.SurvivalTime = GetWorld()->GetTimeSeconds() - CurrentLifeStartTime;
+            }
             IncrementDeaths();
             break;
 
@@ -339,7 +339,7 @@ void AHSPlayerState::IncrementKills(int32 KillCount)
     FScopeLock StatisticsLock(&StatisticsMutex);
     
     PlayerStatistics.Kills += KillCount;
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    MarkPlayerStatisticsDirty();
 
     UE_LOG(LogTemp, Log, TEXT("HSPlayerState: 킬 수 증가 - %s: +%d (총 %d)"), 
            *GetPlayerName(), KillCount, PlayerStatistics.Kills);
@@ -356,7 +356,7 @@ void AHSPlayerState::IncrementDeaths()
     FScopeLock StatisticsLock(&StatisticsMutex);
     
     PlayerStatistics.Deaths++;
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    MarkPlayerStatisticsDirty();
 
     UE_LOG(LogTemp, Log, TEXT("HSPlayerState: 데스 수 증가 - %s: %d"), 
            *GetPlayerName(), PlayerStatistics.Deaths);
@@ -373,7 +373,7 @@ void AHSPlayerState::IncrementAssists(int32 AssistCount)
     FScopeLock StatisticsLock(&StatisticsMutex);
     
     PlayerStatistics.Assists += AssistCount;
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    MarkPlayerStatisticsDirty();
 
     UE_LOG(LogTemp, Log, TEXT("HSPlayerState: 어시스트 수 증가 - %s: +%d (총 %d)"), 
            *GetPlayerName(), AssistCount, PlayerStatistics.Assists);
@@ -387,28 +387,9 @@ void AHSPlayerState::UpdateDamageStatistics(float DamageDealt, float DamageTaken
         return;
     }
 
-    bool bUpdated = false;
-    
-    {
-        FScopeLock StatisticsLock(&StatisticsMutex);
-        
-        if (DamageDealt > 0.0f)
-        {
-            PlayerStatistics.TotalDamageDealt += DamageDealt;
-            bUpdated = true;
-        }
-        
-        if (DamageTaken > 0.0f)
-        {
-            PlayerStatistics.TotalDamageTaken += DamageTaken;
-            bUpdated = true;
-        }
-    }
-
-    if (bUpdated)
-    {
-        OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
-    }
+    // 게임 스레드에서 서버 전용 누계에만 더하고, 복제와 이벤트는 FlushCombatStatistics에서 일괄 처리
+    PendingCombatStatistics.TotalDamageDealt += FMath::Max(0.0f, DamageDealt);
+    PendingCombatStatistics.TotalDamageTaken += FMath::Max(0.0f, DamageTaken);
 }
 
 // 힐링 통계 업데이트
@@ -419,28 +400,67 @@ void AHSPlayerState::UpdateHealingStatistics(float HealingDone, float HealingRec
         return;
     }
 
-    bool bUpdated = false;
-    
+    PendingCombatStatistics.TotalHealingDone += FMath::Max(0.0f, HealingDone);
+    PendingCombatStatistics.TotalHealingReceived += FMath::Max(0.0f, HealingReceived);
+}
+
+// 모아 둔 전투 누계를 복제 값에 반영
+void AHSPlayerState::FlushCombatStatistics()
+{
+    if (PendingCombatStatistics.IsZero())
     {
-        FScopeLock StatisticsLock(&StatisticsMutex);
-        
-        if (HealingDone > 0.0f)
-        {
-            PlayerStatistics.TotalHealingDone += HealingDone;
-            bUpdated = true;
-        }
-        
-        if (HealingReceived > 0.0f)
-        {
-            PlayerStatistics.TotalHealingReceived += HealingReceived;
-            bUpdated = true;
-        }
+        return;
     }
 
-    if (bUpdated)
+    CombatStatistics += PendingCombatStatistics;
+    PendingCombatStatistics = FHSPlayerCombatStatistics();
+
+    EstimatedStatisticsReplicatedBytes += sizeof(FHSPlayerCombatStatistics);
+    INC_DWORD_STAT_BY(STAT_HSPlayerStatisticsReplicatedBytes, sizeof(FHSPlayerCombatStatistics));
+
+    OnPlayerStatisticsUpdated.Broadcast(GetPlayerStatistics());
+}
+
+// 통계 변경 알림
+void AHSPlayerState::MarkPlayerStatisticsDirty()
+{
+    EstimatedStatisticsReplicatedBytes += sizeof(FHSPlayerSessionStatistics);
+    INC_DWORD_STAT_BY(STAT_HSPlayerStatisticsReplicatedBytes, sizeof(FHSPlayerSessionStatistics));
+
+    OnPlayerStatisticsUpdated.Broadcast(GetPlayerStatistics());
+}
+
+// 플레이어 통계 반환
+FHSPlayerSessionStatistics AHSPlayerState::GetPlayerStatistics() const
+{
+    FHSPlayerSessionStatistics Statistics = PlayerStatistics;
+
+    // 서버는 아직 반영하지 않은 누계까지 포함
+    FHSPlayerCombatStatistics Combat = CombatStatistics;
+    if (HasAuthority())
     {
-        OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+        Combat += PendingCombatStatistics;
     }
+
+    Statistics.TotalDamageDealt = Combat.TotalDamageDealt;
+    Statistics.TotalDamageTaken = Combat.TotalDamageTaken;
+    Statistics.TotalHealingDone = Combat.TotalHealingDone;
+    Statistics.TotalHealingReceived = Combat.TotalHealingReceived;
+
+    if (PlayerStatus == EHSPlayerStatus::PS_Alive)
+    {
+        Statistics.SurvivalTime = GetCurrentSurvivalTime();
+    }
+
+    return Statistics;
+}
+
+// 통계 복제량 추정치 반환
+float AHSPlayerState::GetEstimatedStatisticsReplicationBytesPerSecond() const
+{
+    const UWorld* World = GetWorld();
+    const float Elapsed = World ? World->GetTimeSeconds() - StatisticsReplicationStartTime : 0.0f;
+    return Elapsed > 0.0f ? static_cast<float>(EstimatedStatisticsReplicatedBytes) / Elapsed : 0.0f;
 }
 
 // 자원 수집 통계 업데이트
@@ -454,7 +474,7 @@ void AHSPlayerState::UpdateResourceStatistics(int32 ResourceAmount)
     FScopeLock StatisticsLock(&StatisticsMutex);
     
     PlayerStatistics.ResourcesGathered += ResourceAmount;
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    MarkPlayerStatisticsDirty();
 }
 
 // 협동 액션 통계 업데이트
@@ -474,7 +494,7 @@ void AHSPlayerState::UpdateCoopActionStatistics(bool bSuccess)
         PlayerStatistics.SuccessfulCoopActions++;
     }
     
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    MarkPlayerStatisticsDirty();
 
     UE_LOG(LogTemp, Log, TEXT("HSPlayerState: 협동 액션 참여 - %s: %s"), 
            *GetPlayerName(), bSuccess ? TEXT("성공") : TEXT("실패"));
@@ -499,7 +519,7 @@ void AHSPlayerState::UpdateRevivalStatistics(bool bRevived)
         PlayerStatistics.PlayersRevived++;
     }
     
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    MarkPlayerStatisticsDirty();
 
     UE_LOG(LogTemp, Log, TEXT("HSPlayerState: 부활 통계 업데이트 - %s: %s"), 
            *GetPlayerName(), bRevived ? TEXT("부활당함") : TEXT("부활시킴"));
@@ -521,7 +541,7 @@ float AHSPlayerState::GetDamagePerMinute() const
         return 0.0f;
     }
     
-    return PlayerStatistics.TotalDamageDealt / PlayTimeMinutes;
+    return GetPlayerStatistics().TotalDamageDealt / PlayTimeMinutes;
 }
 
 // === 인벤토리 상태 관리 ===
@@ -646,12 +666,15 @@ float AHSPlayerState::GetTotalPlayTime() const
 // 현재 생존 시간 반환
 float AHSPlayerState::GetCurrentSurvivalTime() const
 {
-    if (PlayerStatus != EHSPlayerStatus::PS_Alive || CurrentLifeStartTime <= 0.0f)
+    if (PlayerStatus != EHSPlayerStatus::PS_Alive || LifeStartServerTime < 0.0f)
     {
         return 0.0f;
     }
     
-    return GetWorld()->GetTimeSeconds() - CurrentLifeStartTime;
+    // 클라이언트에서도 같은 값이 나오도록 서버 월드 시간 기준으로 계산
+    const AGameStateBase* GameState = GetWorld()->GetGameState();
+    const float ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+    return FMath::Max(0.0f, ServerTime - LifeStartServerTime);
 }
 
 // 플레이어 정보 문자열 반환
@@ -722,9 +745,10 @@ void AHSPlayerState::SetupTimers()
 
     FTimerManager& TimerManager = GetWorld()->GetTimerManager();
 
-    // 생존 시간 업데이트 타이머 (더 자주 업데이트)
-    TimerManager.SetTimer(SurvivalTimeUpdateTimer, this, 
-                        &AHSPlayerState::UpdateSurvivalTime, 1.0f, true);
+    // 전투 누계 복제 반영 타이머
+    TimerManager.SetTimer(StatisticsFlushTimer, this, 
+                        &AHSPlayerState::FlushCombatStatistics, 
+                        FMath::Max(0.05f, StatisticsReplicationInterval), true);
 
     // 통계 자동 업데이트 타이머
     TimerManager.SetTimer(StatisticsUpdateTimer, this, 
@@ -741,23 +765,16 @@ void AHSPlayerState::SetupTimers()
 
 // === 타이머 콜백 함수들 ===
 
-// 생존 시간 업데이트
-void AHSPlayerState::UpdateSurvivalTime()
-{
-    if (PlayerStatus == EHSPlayerStatus::PS_Alive && CurrentLifeStartTime > 0.0f)
-    {
-        FScopeLock StatisticsLock(&StatisticsMutex);
-        PlayerStatistics.SurvivalTime = GetWorld()->GetTimeSeconds() - CurrentLifeStartTime;
-    }
-}
-
 // 통계 자동 업데이트
 void AHSPlayerState::AutoUpdateStatistics()
 {
     // 자동으로 업데이트할 통계들 처리
     // 예: 보스 전투 시간 체크, 비활성 시간 체크 등
     
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    OnPlayerStatisticsUpdated.Broadcast(GetPlayerStatistics());
+
+    UE_LOG(LogTemp, Verbose, TEXT("HSPlayerState: 통계 복제량 추정 - %s: %.1f bytes/s (누적 %lld bytes)"), 
+           *GetPlayerName(), GetEstimatedStatisticsReplicationBytesPerSecond(), EstimatedStatisticsReplicatedBytes);
 }
 
 // 네트워크 상태 체크
@@ -806,7 +823,12 @@ void AHSPlayerState::OnRep_TeamID()
 
 void AHSPlayerState::OnRep_PlayerStatistics()
 {
-    OnPlayerStatisticsUpdated.Broadcast(PlayerStatistics);
+    OnPlayerStatisticsUpdated.Broadcast(GetPlayerStatistics());
+}
+
+void AHSPlayerState::OnRep_CombatStatistics()
+{
+    OnPlayerStatisticsUpdated.Broadcast(GetPlayerStatistics());
 }
 
 void AHSPlayerState::OnRep_LevelInfo()
@@ -837,17 +859,18 @@ void AHSPlayerState::LogPlayerState() const
 // 플레이어 통계 로그 출력
 void AHSPlayerState::LogPlayerStatistics() const
 {
+    const FHSPlayerSessionStatistics Statistics = GetPlayerStatistics();
     UE_LOG(LogTemp, Warning, TEXT("=== 플레이어 통계: %s ==="), *GetPlayerName());
     UE_LOG(LogTemp, Warning, TEXT("K/D/A: %d/%d/%d (KDA: %.2f)"), 
-           PlayerStatistics.Kills, PlayerStatistics.Deaths, PlayerStatistics.Assists, GetKDARate());
+           Statistics.Kills, Statistics.Deaths, Statistics.Assists, GetKDARate());
     UE_LOG(LogTemp, Warning, TEXT("데미지: %.1f (분당 %.1f)"), 
-           PlayerStatistics.TotalDamageDealt, GetDamagePerMinute());
-    UE_LOG(LogTemp, Warning, TEXT("힐링: %.1f"), PlayerStatistics.TotalHealingDone);
-    UE_LOG(LogTemp, Warning, TEXT("자원 수집: %d"), PlayerStatistics.ResourcesGathered);
+           Statistics.TotalDamageDealt, GetDamagePerMinute());
+    UE_LOG(LogTemp, Warning, TEXT("힐링: %.1f"), Statistics.TotalHealingDone);
+    UE_LOG(LogTemp, Warning, TEXT("자원 수집: %d"), Statistics.ResourcesGathered);
     UE_LOG(LogTemp, Warning, TEXT("협동 액션: %d/%d"), 
-           PlayerStatistics.SuccessfulCoopActions, PlayerStatistics.CoopActionsParticipated);
+           Statistics.SuccessfulCoopActions, Statistics.CoopActionsParticipated);
     UE_LOG(LogTemp, Warning, TEXT("부활: %d회 받음, %d명 살림"), 
-           PlayerStatistics.TimesRevived, PlayerStatistics.PlayersRevived);
+           Statistics.TimesRevived, Statistics.PlayersRevived);
 }
 
 // === 메모리 최적화 관련 ===
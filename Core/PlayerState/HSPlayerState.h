@@ -40,6 +40,8 @@ enum class EHSPlayerRole : uint8
 };
 
 // 플레이어 세션 통계 구조체 (게임 세션 중 통계)
+// 복제 시에는 자주 바뀌지 않는 항목만 이 구조체로 보내고, 데미지/힐링 누계는 FHSPlayerCombatStatistics로,
+// 생존 중인 생존 시간은 복제된 생존 시작 시각으로 계산 (GetPlayerStatistics에서 합쳐 반환)
 USTRUCT(BlueprintType)
 struct FHSPlayerSessionStatistics
 {
@@ -93,7 +95,7 @@ struct FHSPlayerSessionStatistics
     UPROPERTY(BlueprintReadOnly, Category = "Player Statistics")
     int32 TimesRevived;
 
-    // 생존 시간 (초)
+    // 생존 시간 (초, 복제 값은 마지막 사망 시점의 생존 시간)
     UPROPERTY(BlueprintReadOnly, Category = "Player Statistics")
     float SurvivalTime;
 
@@ -121,6 +123,40 @@ struct FHSPlayerSessionStatistics
     }
 };
 
+// 플레이어 전투 누계 (자주 바뀌는 항목, 서버에서 모아 두었다가 일정 주기로 복제)
+USTRUCT(BlueprintType)
+struct FHSPlayerCombatStatistics
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Statistics")
+    float TotalDamageDealt = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Statistics")
+    float TotalDamageTaken = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Statistics")
+    float TotalHealingDone = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Statistics")
+    float TotalHealingReceived = 0.0f;
+
+    bool IsZero() const
+    {
+        return TotalDamageDealt == 0.0f && TotalDamageTaken == 0.0f &&
+               TotalHealingDone == 0.0f && TotalHealingReceived == 0.0f;
+    }
+
+    FHSPlayerCombatStatistics& operator+=(const FHSPlayerCombatStatistics& Other)
+    {
+        TotalDamageDealt += Other.TotalDamageDealt;
+        TotalDamageTaken += Other.TotalDamageTaken;
+        TotalHealingDone += Other.TotalHealingDone;
+        TotalHealingReceived += Other.TotalHealingReceived;
+        return *this;
+    }
+};
+
 // 플레이어 레벨 정보
 USTRUCT(BlueprintType)
 struct FHSPlayerLevelInfo
@@ -253,7 +289,6 @@ public:
 
     // AActor interface
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // 네트워크 복제 설정
@@ -468,11 +503,19 @@ public:
     void UpdateRevivalStatistics(bool bRevived = true);
 
     /**
-     * 플레이어 통계를 반환합니다
+     * 플레이어 통계를 반환합니다 (분리 복제된 항목과 현재 생존 시간을 합쳐서 반환)
      * @return 현재 플레이어 통계
      */
     UFUNCTION(BlueprintPure, Category = "Player Statistics")
-    FHSPlayerSessionStatistics GetPlayerStatistics() const { return PlayerStatistics; }
+    FHSPlayerSessionStatistics GetPlayerStatistics() const;
+
+    /**
+     * 통계 복제로 발생한 초당 바이트 추정치를 반환합니다
+     * 값이 바뀐 속성의 구조체 크기를 더한 값이라 실제 전송량(델타 직렬화, 헤더)과는 다르며, 정확한 값은 네트워크 프로파일러로 확인
+     * @return 초당 추정 복제 바이트
+     */
+    UFUNCTION(BlueprintPure, Category = "Player Statistics")
+    float GetEstimatedStatisticsReplicationBytesPerSecond() const;
 
     /**
      * KDA 비율을 계산합니다
@@ -603,10 +646,21 @@ protected:
     UPROPERTY(Replicated, BlueprintReadOnly, Category = "Player State")
     int32 TeamID;
 
-    // 플레이어 통계
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Player State")
+    // 플레이어 통계 (자주 바뀌지 않는 항목, 변경 시에만 값이 바뀜)
+    UPROPERTY(ReplicatedUsing = OnRep_PlayerStatistics, BlueprintReadOnly, Category = "Player State")
     FHSPlayerSessionStatistics PlayerStatistics;
 
+    // 전투 누계 (StatisticsReplicationInterval 주기로만 갱신)
+    UPROPERTY(ReplicatedUsing = OnRep_CombatStatistics, BlueprintReadOnly, Category = "Player State")
+    FHSPlayerCombatStatistics CombatStatistics;
+
+    // 현재 생존 시작 시각 (서버 월드 시간, 클라이언트는 이 값으로 생존 시간을 계산)
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Player State")
+    float LifeStartServerTime;
+
+    // 아직 복제 값에 반영하지 않은 전투 누계 (서버 전용)
+    FHSPlayerCombatStatistics PendingCombatStatistics;
+
     // 레벨 정보
     UPROPERTY(Replicated, BlueprintReadOnly, Category = "Player State")
     FHSPlayerLevelInfo LevelInfo;
@@ -631,12 +685,12 @@ protected:
 
     // === 타이머 핸들들 ===
 
-    // 생존 시간 업데이트 타이머
-    FTimerHandle SurvivalTimeUpdateTimer;
-
     // 통계 업데이트 타이머
     FTimerHandle StatisticsUpdateTimer;
 
+    // 전투 누계 복제 반영 타이머
+    FTimerHandle StatisticsFlushTimer;
+
     // 네트워크 상태 체크 타이머
     FTimerHandle NetworkStatusTimer;
 
@@ -662,6 +716,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance Configuration")
     float StatisticsUpdateInterval;
 
+    // 데미지/힐링 누계를 복제 값에 반영하는 주기 (초)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance Configuration", meta = (ClampMin = "0.05"))
+    float StatisticsReplicationInterval;
+
     // 네트워크 상태 체크 주기 (초)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance Configuration")
     float NetworkStatusCheckInterval;
@@ -675,9 +733,12 @@ private:
     // 레벨업 처리
     void ProcessLevelUp(int32 NewLevel);
 
-    // 생존 시간 업데이트
+    // 모아 둔 전투 누계를 복제 값에 반영
     UFUNCTION()
-    void UpdateSurvivalTime();
+    void FlushCombatStatistics();
+
+    // 통계 변경 알림 (서버: 복제량 추정치 집계)
+    void MarkPlayerStatisticsDirty();
 
     // 통계 자동 업데이트
     UFUNCTION()
@@ -707,6 +768,9 @@ private:
     UFUNCTION()
     void OnRep_PlayerStatistics();
 
+    UFUNCTION()
+    void OnRep_CombatStatistics();
+
     UFUNCTION()
     void OnRep_LevelInfo();
 
@@ -728,6 +792,10 @@ private:
     // 사용하지 않는 데이터 정리
     void CleanupUnusedData();
 
+    // 통계 복제량 집계 (추정치)
+    int64 EstimatedStatisticsReplicatedBytes = 0;
+    float StatisticsReplicationStartTime = 0.0f;
+
     // 초기화 완료 플래그
     bool bInitialized;
 
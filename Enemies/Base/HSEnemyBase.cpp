@@ -5,6 +5,7 @@
 #include "HuntingSpirit/Combat/HSHitReactionComponent.h"
 #include "HuntingSpirit/AI/HSAIControllerBase.h"
 #include "HuntingSpirit/Characters/Player/HSPlayerCharacter.h"
+#include "HuntingSpirit/Optimization/HSSignificanceManager.h"
 #include "Perception/PawnSensingComponent.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
@@ -75,6 +76,24 @@ void AHSEnemyBase::BeginPlay()
 
     // 적 초기화
     InitializeEnemy();
+
+    // 플레이어와의 관련도에 따라 틱/애니메이션/감지 빈도 조절
+    if (UHSSignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UHSSignificanceManager>())
+    {
+        SignificanceManager->RegisterActor(this, EHSSignificanceCategory::Enemy);
+    }
+}
+
+// 게임 종료/파괴 시 호출
+void AHSEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 중요도 관리 대상에서 즉시 제외
+    if (UHSSignificanceManager* SignificanceManager = GetWorld() ? GetWorld()->GetSubsystem<UHSSignificanceManager>() : nullptr)
+    {
+        SignificanceManager->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 // 매 프레임 호출
@@ -233,6 +233,12 @@ protected:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief 게임 종료/파괴 시 정리
+     * @details 중요도 관리 대상에서 제외합니다
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     // 적 기본 정보
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Info")
     EHSEnemyType EnemyType = EHSEnemyType::Melee;
@@ -3,6 +3,7 @@
 
 #include "HSBossAbilitySystem.h"
 #include "HSBossBase.h"
+#include "HuntingSpirit/Optimization/HSThrottledTaskScheduler.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/DamageEvents.h"
@@ -30,6 +31,7 @@
 DECLARE_STATS_GROUP(TEXT("HSBossAbilitySystem"), STATGROUP_HSBossAbilitySystem, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("ExecuteAbility"), STAT_ExecuteAbility, STATGROUP_HSBossAbilitySystem);
 DECLARE_CYCLE_STAT(TEXT("FindTargets"), STAT_FindTargets, STATGROUP_HSBossAbilitySystem);
+DECLARE_CYCLE_STAT(TEXT("OptimalTargetLocation"), STAT_OptimalTargetLocation, STATGROUP_HSBossAbilitySystem);
 DECLARE_CYCLE_STAT(TEXT("UpdateCooldowns"), STAT_UpdateCooldowns, STATGROUP_HSBossAbilitySystem);
 DECLARE_CYCLE_STAT(TEXT("CacheOptimization"), STAT_CacheOptimization, STATGROUP_HSBossAbilitySystem);
 
@@ -109,6 +111,109 @@ namespace HSAbilitySystemOptimization
             Array.Sort(Predicate);
         }
     }
+
+    // 위치 사전순 비교 (동률 판정을 입력 순서와 무관하게 만들기 위함)
+    static bool IsLexicographicallyLess(const FVector& A, const FVector& B)
+    {
+        if (A.X != B.X)
+        {
+            return A.X < B.X;
+        }
+        if (A.Y != B.Y)
+        {
+            return A.Y < B.Y;
+        }
+        return A.Z < B.Z;
+    }
+
+    // 격자 분할 기반 AoE 중심 탐색
+    // 셀 크기를 반경과 같게 두면 한 점의 반경 내 이웃은 인접 3x3 셀에만 존재하므로
+    // 밀집도가 고르다면 전체 비용이 O(n)에 가깝다
+    static FVector FindDensestAreaCenter(const TArray<FVector>& Positions, float Radius, int32& OutCoveredCount)
+    {
+        OutCoveredCount = 0;
+        if (Positions.Num() == 0 || Radius <= 0.0f)
+        {
+            return FVector::ZeroVector;
+        }
+
+        const float RadiusSquared = FMath::Square(Radius);
+        const float InvCellSize = 1.0f / Radius;
+
+        auto GetCell = [InvCellSize](const FVector& Position)
+        {
+            return FIntPoint(FMath::FloorToInt(Position.X * InvCellSize), FMath::FloorToInt(Position.Y * InvCellSize));
+        };
+
+        TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Cells;
+        Cells.Reserve(Positions.Num());
+        for (int32 Index = 0; Index < Positions.Num(); ++Index)
+        {
+            Cells.FindOrAdd(GetCell(Positions[Index])).Add(Index);
+        }
+
+        // 주어진 중심의 반경 안에 들어오는 타겟 수와 위치 합을 계산
+        auto CountCovered = [&](const FVector& Center, FVector& OutPositionSum)
+        {
+            const FIntPoint CenterCell = GetCell(Center);
+            int32 Count = 0;
+            OutPositionSum = FVector::ZeroVector;
+
+            for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+            {
+                for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+                {
+                    const auto* CellIndices = Cells.Find(FIntPoint(CenterCell.X + OffsetX, CenterCell.Y + OffsetY));
+                    if (!CellIndices)
+                    {
+                        continue;
+                    }
+
+                    for (int32 Index : *CellIndices)
+                    {
+                        if (FVector::DistSquared(Center, Positions[Index]) <= RadiusSquared)
+                        {
+                            ++Count;
+                            OutPositionSum += Positions[Index];
+                        }
+                    }
+                }
+            }
+
+            return Count;
+        };
+
+        FVector BestCenter = Positions[0];
+        FVector BestPositionSum = FVector::ZeroVector;
+        int32 BestCount = 0;
+
+        // 각 타겟 위치를 후보 중심으로 평가, 동률이면 사전순으로 작은 위치 선택
+        for (const FVector& Candidate : Positions)
+        {
+            FVector PositionSum;
+            const int32 Count = CountCovered(Candidate, PositionSum);
+            if (Count > BestCount || (Count == BestCount && IsLexicographicallyLess(Candidate, BestCenter)))
+            {
+                BestCount = Count;
+                BestCenter = Candidate;
+                BestPositionSum = PositionSum;
+            }
+        }
+
+        // 포함된 타겟들의 중심으로 이동해도 포함 수가 줄지 않으면 더 안정적인 중심으로 사용
+        if (BestCount > 1)
+        {
+            const FVector ClusterCentroid = BestPositionSum / static_cast<float>(BestCount);
+            FVector UnusedSum;
+            if (CountCovered(ClusterCentroid, UnusedSum) >= BestCount)
+            {
+                BestCenter = ClusterCentroid;
+            }
+        }
+
+        OutCoveredCount = BestCount;
+        return BestCenter;
+    }
 }
 
 // 생성자 - 초기화 최적화
@@ -128,6 +233,9 @@ UHSBossAbilitySystem::UHSBossAbilitySystem()
     // 캐시 초기화
     LastCachedPhase = EHSBossPhase::Phase1;
     LastCacheTime = 0.0f;
+    CachedCandidateCenter = FVector::ZeroVector;
+    CachedCandidateRadius = -1.0f;
+    CachedCandidateFrame = MAX_uint64;
     
     // 메모리 풀 예약 (성능 최적화)
     AbilitiesMap.Reserve(32);
@@ -151,6 +259,26 @@ void UHSBossAbilitySystem::BeginPlay()
     }
     
     InitializeAbilitySystem();
+    
+    // 주기 유지보수 작업 등록 (보스 인스턴스 간 위상 분산)
+    if (UWorld* World = GetWorld())
+    {
+        if (UHSThrottledTaskScheduler* Scheduler = World->GetSubsystem<UHSThrottledTaskScheduler>())
+        {
+            // 캐시 최적화 (1초마다)
+            Scheduler->RegisterTask(this, 1.0f, FHSThrottledTaskDelegate::CreateWeakLambda(this, [this](float)
+            {
+                OptimizeAbilityCache();
+            }));
+            
+            // 메모리 정리 (5초마다)
+            Scheduler->RegisterTask(this, 5.0f, FHSThrottledTaskDelegate::CreateWeakLambda(this, [this](float)
+            {
+                CleanupExpiredReferences();
+                OptimizeMemoryUsage();
+            }));
+        }
+    }
 }
 
 void UHSBossAbilitySystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -171,25 +299,6 @@ void UHSBossAbilitySystem::TickComponent(float DeltaTime, ELevelTick TickType, F
     
     // 큐에 있는 능력 처리
     ProcessQueuedAbilities();
-    
-    // 캐시 최적화 (주기적으로 실행)
-    static float CacheOptimizationTimer = 0.0f;
-    CacheOptimizationTimer += DeltaTime;
-    if (CacheOptimizationTimer >= 1.0f) // 1초마다 실행
-    {
-        OptimizeAbilityCache();
-        CacheOptimizationTimer = 0.0f;
-    }
-    
-    // 메모리 정리 (5초마다)
-    static float MemoryCleanupTimer = 0.0f;
-    MemoryCleanupTimer += DeltaTime;
-    if (MemoryCleanupTimer >= 5.0f)
-    {
-        CleanupExpiredReferences();
-        OptimizeMemoryUsage();
-        MemoryCleanupTimer = 0.0f;
-    }
 }
 
 void UHSBossAbilitySystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -209,6 +318,11 @@ void UHSBossAbilitySystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
         {
             TimerManager.ClearTimer(Timer.Value);
         }
+        
+        if (UHSThrottledTaskScheduler* Scheduler = World->GetSubsystem<UHSThrottledTaskScheduler>())
+        {
+            Scheduler->UnregisterAllTasks(this);
+        }
     }
     
     // 풀된 컴포넌트 정리
@@ -1112,55 +1226,117 @@ void UHSBossAbilitySystem::ApplyAbilityEffects(const FHSBossAbility& Ability, co
     }
 }
 
-// 단일 타겟 찾기
-TArray<AActor*> UHSBossAbilitySystem::FindSingleTarget(const FHSBossAbility& Ability, const FVector& TargetLocation) const
+// 타겟 후보 수집 - 같은 프레임 안에서 이미 조회한 구체가 요청 구체를 포함하면 재사용
+void UHSBossAbilitySystem::GatherTargetCandidates(const FVector& Center, float Radius, TArray<AActor*>& OutCandidates) const
 {
-    TArray<AActor*> FoundTargets;
+    OutCandidates.Reset();
     
-    if (UWorld* World = GetWorld())
+    UWorld* World = GetWorld();
+    if (!World || Radius <= 0.0f)
+    {
+        return;
+    }
+    
+    const bool bCacheCoversQuery = CachedCandidateFrame == GFrameCounter &&
+        CachedCandidateRadius >= Radius &&
+        FVector::Dist(Center, CachedCandidateCenter) + Radius <= CachedCandidateRadius;
+    
+    if (!bCacheCoversQuery)
     {
-        // 범위 내 플레이어 검색
         TArray<FOverlapResult> OverlapResults;
         FCollisionQueryParams QueryParams;
         QueryParams.AddIgnoredActor(OwnerBoss.Get());
         
-        bool bHit = World->OverlapMultiByChannel(
+        World->OverlapMultiByChannel(
             OverlapResults,
-            TargetLocation,
+            Center,
             FQuat::Identity,
             ECollisionChannel::ECC_Pawn,
-            FCollisionShape::MakeSphere(Ability.Range),
+            FCollisionShape::MakeSphere(Radius),
             QueryParams
         );
         
-        if (bHit)
-        {
-            float ClosestDistance = FLT_MAX;
-            AActor* ClosestTarget = nullptr;
-            
-            for (const FOverlapResult& Result : OverlapResults)
+        // 새로 조회한 경우 오버랩 결과가 곧 정답이므로 중복만 제거해 그대로 반환
+        // (한 액터의 여러 컴포넌트가 겹칠 수 있으므로 집합으로 중복 제거, 겹침 수에 선형)
+        TSet<AActor*, DefaultKeyFuncs<AActor*>, TInlineSetAllocator<32>> SeenActors;
+        SeenActors.Reserve(OverlapResults.Num());
+        CachedTargetCandidates.Reset(OverlapResults.Num());
+        OutCandidates.Reserve(OverlapResults.Num());
+        for (const FOverlapResult& Result : OverlapResults)
+        {
+            AActor* Actor = Result.GetActor();
+            bool bAlreadySeen = false;
+            if (Actor)
             {
-                if (AActor* Actor = Result.GetActor())
+                SeenActors.Add(Actor, &bAlreadySeen);
+                if (!bAlreadySeen)
                 {
-                    if (IsValidTarget(Ability, Actor))
-                    {
-                        float Distance = FVector::Dist(Actor->GetActorLocation(), TargetLocation);
-                        if (Distance < ClosestDistance)
-                        {
-                            ClosestDistance = Distance;
-                            ClosestTarget = Actor;
-                        }
-                    }
+                    CachedTargetCandidates.Add(Actor);
+                    OutCandidates.Add(Actor);
                 }
             }
-            
-            if (ClosestTarget)
+        }
+        
+        CachedCandidateCenter = Center;
+        CachedCandidateRadius = Radius;
+        CachedCandidateFrame = GFrameCounter;
+        return;
+    }
+    
+    // 캐시된 더 큰 구체의 후보 중 요청 구체와 겹치는 액터만 반환
+    // 오버랩과 같은 기준이 되도록 액터 원점이 아닌 충돌 컴포넌트 바운드와 구체 중심의 거리로 판정
+    const float RadiusSquared = FMath::Square(Radius);
+    OutCandidates.Reserve(CachedTargetCandidates.Num());
+    for (const TWeakObjectPtr<AActor>& CandidatePtr : CachedTargetCandidates)
+    {
+        AActor* Candidate = CandidatePtr.Get();
+        if (!Candidate)
+        {
+            continue;
+        }
+        
+        const FBox CandidateBounds = Candidate->GetComponentsBoundingBox();
+        const float DistanceSquared = CandidateBounds.IsValid
+            ? CandidateBounds.ComputeSquaredDistanceToPoint(Center)
+            : FVector::DistSquared(Candidate->GetActorLocation(), Center);
+        
+        if (DistanceSquared <= RadiusSquared)
+        {
+            OutCandidates.Add(Candidate);
+        }
+    }
+}
+
+// 단일 타겟 찾기
+TArray<AActor*> UHSBossAbilitySystem::FindSingleTarget(const FHSBossAbility& Ability, const FVector& TargetLocation) const
+{
+    TArray<AActor*> FoundTargets;
+    
+    // 범위 내 플레이어 검색
+    TArray<AActor*> Candidates;
+    GatherTargetCandidates(TargetLocation, Ability.Range, Candidates);
+    
+    float ClosestDistanceSquared = FLT_MAX;
+    AActor* ClosestTarget = nullptr;
+    
+    for (AActor* Actor : Candidates)
+    {
+        if (IsValidTarget(Ability, Actor))
+        {
+            const float DistanceSquared = FVector::DistSquared(Actor->GetActorLocation(), TargetLocation);
+            if (DistanceSquared < ClosestDistanceSquared)
             {
-                FoundTargets.Add(ClosestTarget);
+                ClosestDistanceSquared = DistanceSquared;
+                ClosestTarget = Actor;
             }
         }
     }
     
+    if (ClosestTarget)
+    {
+        FoundTargets.Add(ClosestTarget);
+    }
+    
     return FoundTargets;
 }
 
@@ -1169,33 +1345,14 @@ TArray<AActor*> UHSBossAbilitySystem::FindMultipleTargets(const FHSBossAbility&
 {
     TArray<AActor*> FoundTargets;
     
-    if (UWorld* World = GetWorld())
+    TArray<AActor*> Candidates;
+    GatherTargetCandidates(TargetLocation, Ability.Range, Candidates);
+    
+    for (AActor* Actor : Candidates)
     {
-        TArray<FOverlapResult> OverlapResults;
-        FCollisionQueryParams QueryParams;
-        QueryParams.AddIgnoredActor(OwnerBoss.Get());
-        
-        bool bHit = World->OverlapMultiByChannel(
-            OverlapResults,
-            TargetLocation,
-            FQuat::Identity,
-            ECollisionChannel::ECC_Pawn,
-            FCollisionShape::MakeSphere(Ability.Range),
-            QueryParams
-        );
-        
-        if (bHit)
+        if (IsValidTarget(Ability, Actor))
         {
-            for (const FOverlapResult& Result : OverlapResults)
-            {
-                if (AActor* Actor = Result.GetActor())
-                {
-                    if (IsValidTarget(Ability, Actor))
-                    {
-                        FoundTargets.Add(Actor);
-                    }
-                }
-            }
+            FoundTargets.Add(Actor);
         }
     }
     
@@ -1207,33 +1364,14 @@ TArray<AActor*> UHSBossAbilitySystem::FindAreaTargets(const FHSBossAbility& Abil
 {
     TArray<AActor*> FoundTargets;
     
-    if (UWorld* World = GetWorld())
+    TArray<AActor*> Candidates;
+    GatherTargetCandidates(TargetLocation, Ability.AreaRadius, Candidates);
+    
+    for (AActor* Actor : Candidates)
     {
-        TArray<FOverlapResult> OverlapResults;
-        FCollisionQueryParams QueryParams;
-        QueryParams.AddIgnoredActor(OwnerBoss.Get());
-        
-        bool bHit = World->OverlapMultiByChannel(
-            OverlapResults,
-            TargetLocation,
-            FQuat::Identity,
-            ECollisionChannel::ECC_Pawn,
-            FCollisionShape::MakeSphere(Ability.AreaRadius),
-            QueryParams
-        );
-        
-        if (bHit)
+        if (IsValidTarget(Ability, Actor))
         {
-            for (const FOverlapResult& Result : OverlapResults)
-            {
-                if (AActor* Actor = Result.GetActor())
-                {
-                    if (IsValidTarget(Ability, Actor))
-                    {
-                        FoundTargets.Add(Actor);
-                    }
-                }
-            }
+            FoundTargets.Add(Actor);
         }
     }
     
@@ -1907,6 +2045,8 @@ FHSBossAbility UHSBossAbilitySystem::GetBestAbilityForSituation(const FHSAbility
 // 최적 타겟 위치 계산 - SIMD 최적화 적용
 FVector UHSBossAbilitySystem::GetOptimalTargetLocation(const FHSBossAbility& Ability, const TArray<AActor*>& PotentialTargets) const
 {
+    SCOPE_CYCLE_COUNTER(STAT_OptimalTargetLocation);
+    
     // 자가검증: 능력 유효성 확인
     if (!ValidateAbility(Ability))
     {
@@ -1985,33 +2125,11 @@ FVector UHSBossAbilitySystem::GetOptimalTargetLocation(const FHSBossAbility& Abi
                 }
                 CenterPoint /= static_cast<float>(Positions.Num());
                 
-                // 최대한 많은 타겟을 포함하는 위치 찾기
+                // 최대한 많은 타겟을 포함하는 위치 찾기 (격자 분할 클러스터링)
                 if (Ability.AreaRadius > 0.0f)
                 {
-                    FVector BestLocation = CenterPoint;
                     int32 MaxTargetsInRange = 0;
-                    
-                    // 각 타겟 위치를 중심으로 테스트
-                    for (const FVector& TestPos : Positions)
-                    {
-                        int32 TargetsInRange = 0;
-                        
-                        for (const FVector& TargetPos : Positions)
-                        {
-                            if (FVector::Dist(TestPos, TargetPos) <= Ability.AreaRadius)
-                            {
-                                TargetsInRange++;
-                            }
-                        }
-                        
-                        if (TargetsInRange > MaxTargetsInRange)
-                        {
-                            MaxTargetsInRange = TargetsInRange;
-                            BestLocation = TestPos;
-                        }
-                    }
-                    
-                    OptimalLocation = BestLocation;
+                    OptimalLocation = HSAbilitySystemOptimization::FindDensestAreaCenter(Positions, Ability.AreaRadius, MaxTargetsInRange);
                 }
                 else
                 {
@@ -495,6 +495,13 @@ private:
     TArray<AActor*> FindSingleTarget(const FHSBossAbility& Ability, const FVector& TargetLocation) const;
     TArray<AActor*> FindMultipleTargets(const FHSBossAbility& Ability, const FVector& TargetLocation) const;
     TArray<AActor*> FindAreaTargets(const FHSBossAbility& Ability, const FVector& TargetLocation) const;
+    void GatherTargetCandidates(const FVector& Center, float Radius, TArray<AActor*>& OutCandidates) const;
+
+    // 타겟 후보 캐시 (같은 프레임의 타겟 탐색이 하나의 공간 쿼리 결과를 공유)
+    mutable TArray<TWeakObjectPtr<AActor>> CachedTargetCandidates;
+    mutable FVector CachedCandidateCenter;
+    mutable float CachedCandidateRadius;
+    mutable uint64 CachedCandidateFrame;
     
     // 성능 최적화 함수들
     void OptimizeAbilityCache();
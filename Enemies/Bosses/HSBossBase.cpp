@@ -18,10 +18,15 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Animation/AnimInstance.h"
 #include "HuntingSpirit/Optimization/ObjectPool/HSObjectPool.h"
+#include "HuntingSpirit/Optimization/HSSignificanceManager.h"
 #include "HuntingSpirit/Characters/Player/HSPlayerCharacter.h"
 #include "HuntingSpirit/Enemies/Regular/HSBasicMeleeEnemy.h"
 #include "HuntingSpirit/Enemies/Regular/HSBasicRangedEnemy.h"
 #include "DrawDebugHelpers.h"
+#include "Stats/Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Boss Tick"), STAT_HSBossTick, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Boss Update Engaged Players"), STAT_HSBossUpdateEngagedPlayers, STATGROUP_Game);
 
 // Sets default values
 AHSBossBase::AHSBossBase()
@@ -87,21 +92,20 @@ AHSBossBase::AHSBossBase()
 // 매 프레임 호출
 void AHSBossBase::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_HSBossTick);
+
     Super::Tick(DeltaTime);
     
     // 보스 UI 업데이트
     UpdateBossUI();
     
-    // 협동 플레이어 업데이트
-    UpdateEngagedPlayers();
-    
-    // 페이즈 전환 체크
-    CheckPhaseTransition();
-    
-    // 분노 모드 자동 활성화 체크
-    if (!bIsEnraged && GetHealthPercent() <= EnrageHealthThreshold)
+    // 협동 플레이어 업데이트 (판정 주기마다)
+    // 페이즈 전환과 분노 모드 체크는 체력이 바뀔 때 SetHealth에서 처리
+    TimeSinceEngagementUpdate += DeltaTime;
+    if (TimeSinceEngagementUpdate >= EngagementUpdateInterval)
     {
-        EnterEnrageMode();
+        TimeSinceEngagementUpdate = 0.0f;
+        UpdateEngagedPlayers();
     }
 }
 
@@ -585,7 +589,12 @@ void AHSBossBase::OnPatternCooldownComplete()
 void AHSBossBase::OnMultiplePlayersDetected(const TArray<AActor*>& Players)
 {
     // 협동 메커니즘 활성화
-    EngagedPlayers = Players;
+    EngagedPlayers.Reset();
+    EngagedPlayerKeys.Reset();
+    for (AActor* Player : Players)
+    {
+        AddEngagedPlayer(Player);
+    }
     
     // 협동 필수 패턴 활성화
     TriggerCoopMechanic();
@@ -642,68 +651,114 @@ int32 AHSBossBase::GetActivePlayerCount() const
 // 교전 중인 플레이어 업데이트
 void AHSBossBase::UpdateEngagedPlayers()
 {
-    // 유효하지 않은 플레이어 제거
-    EngagedPlayers.RemoveAll([this](AActor* Player) {
+    SCOPE_CYCLE_COUNTER(STAT_HSBossUpdateEngagedPlayers);
+
+    const FVector BossLocation = GetActorLocation();
+    const float ExitRangeSquared = FMath::Square(AggroRange * FMath::Max(1.0f, EngagementExitRangeMultiplier));
+
+    // 이탈 거리 밖이거나 사망/파괴된 플레이어 제거 (진입 거리보다 넓게 잡아 경계에서의 잦은 전환 방지)
+    bool bHasDestroyedPlayer = false;
+    for (int32 PlayerIndex = EngagedPlayers.Num() - 1; PlayerIndex >= 0; --PlayerIndex)
+    {
+        AActor* Player = EngagedPlayers[PlayerIndex];
         if (!IsValid(Player))
-            return true;
-            
-        // 거리 체크
-        float Distance = FVector::Dist(GetActorLocation(), Player->GetActorLocation());
-        if (Distance > AggroRange)
-            return true;
-            
-        // 사망 체크 (플레이어는 일단 살아있다고 가정)
-        if (AHSEnemyBase* Enemy = Cast<AHSEnemyBase>(Player))
         {
-            if (Enemy->IsDead())
-                return true;
+            bHasDestroyedPlayer = true;
+            EngagedPlayers.RemoveAtSwap(PlayerIndex, 1, false);
+            continue;
         }
-        
-        return false;
-    });
-    
-    // 범위 내 새로운 플레이어 추가
-    TArray<AActor*> NearbyPlayers = FindNearbyPlayers();
-    for (AActor* Player : NearbyPlayers)
-    {
-        if (!EngagedPlayers.Contains(Player))
+
+        if (FVector::DistSquared(BossLocation, Player->GetActorLocation()) > ExitRangeSquared || IsEngagedPlayerDead(Player))
         {
-            EngagedPlayers.Add(Player);
+            EngagedPlayerKeys.Remove(Player);
+            EngagedPlayers.RemoveAtSwap(PlayerIndex, 1, false);
         }
     }
+
+    // 파괴된 액터는 키를 직접 지울 수 없으므로 목록 기준으로 다시 구성
+    if (bHasDestroyedPlayer)
+    {
+        RebuildEngagedPlayerKeys();
+    }
+
+    // 진입 거리 안의 새로운 플레이어 추가
+    for (AActor* Player : FindNearbyPlayers())
+    {
+        AddEngagedPlayer(Player);
+    }
 }
 
-// 근처 플레이어 찾기
+// 근처 플레이어 찾기 (물리 스윕 대신 공유 플레이어 위치 색인 사용)
 TArray<AActor*> AHSBossBase::FindNearbyPlayers() const
 {
     TArray<AActor*> Players;
-    TArray<FHitResult> HitResults;
-    
-    FCollisionShape SphereShape = FCollisionShape::MakeSphere(AggroRange);
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(this);
-    
-    GetWorld()->SweepMultiByChannel(
-        HitResults,
-        GetActorLocation(),
-        GetActorLocation(),
-        FQuat::Identity,
-        ECC_Pawn,
-        SphereShape,
-        QueryParams
-    );
-    
-    for (const FHitResult& Hit : HitResults)
+
+    UHSSignificanceManager* SignificanceManager = GetWorld() ? GetWorld()->GetSubsystem<UHSSignificanceManager>() : nullptr;
+    if (!SignificanceManager)
     {
-        if (AHSPlayerCharacter* Player = Cast<AHSPlayerCharacter>(Hit.GetActor()))
+        return Players;
+    }
+
+    const FVector BossLocation = GetActorLocation();
+    const float AggroRangeSquared = FMath::Square(AggroRange);
+
+    for (const FHSPlayerLocationEntry& PlayerEntry : SignificanceManager->GetPlayerLocations())
+    {
+        if (FVector::DistSquared(BossLocation, PlayerEntry.Location) > AggroRangeSquared)
+        {
+            continue;
+        }
+
+        AHSPlayerCharacter* Player = Cast<AHSPlayerCharacter>(PlayerEntry.Pawn.Get());
+        if (Player && !Player->IsDead())
         {
             Players.Add(Player);
         }
     }
-    
+
     return Players;
 }
 
+// 교전 플레이어 추가 (이미 교전 중이면 무시)
+void AHSBossBase::AddEngagedPlayer(AActor* Player)
+{
+    if (!IsValid(Player))
+    {
+        return;
+    }
+
+    bool bAlreadyEngaged = false;
+    EngagedPlayerKeys.Add(Player, &bAlreadyEngaged);
+    if (!bAlreadyEngaged)
+    {
+        EngagedPlayers.Add(Player);
+    }
+}
+
+// 교전 플레이어 집합 재구성
+void AHSBossBase::RebuildEngagedPlayerKeys()
+{
+    EngagedPlayerKeys.Reset();
+    for (AActor* Player : EngagedPlayers)
+    {
+        EngagedPlayerKeys.Add(Player);
+    }
+}
+
+// 교전 플레이어 사망 여부
+bool AHSBossBase::IsEngagedPlayerDead(const AActor* Player)
+{
+    if (const AHSEnemyBase* Enemy = Cast<AHSEnemyBase>(Player))
+    {
+        return Enemy->IsDead();
+    }
+    if (const AHSCharacterBase* Character = Cast<AHSCharacterBase>(Player))
+    {
+        return Character->IsDead();
+    }
+    return false;
+}
+
 // 특수 능력 활성화
 void AHSBossBase::ActivateSpecialAbility(FName AbilityName)
 {
@@ -1065,6 +1120,17 @@ void AHSBossBase::SetHealth(float NewHealth)
 {
     Super::SetHealth(NewHealth);
     
+    // 페이즈 전환과 분노 모드는 체력 변화 시에만 판정 (생성/초기화 중 설정은 제외)
+    if (HasActorBegunPlay() && !IsDead())
+    {
+        CheckPhaseTransition();
+        
+        if (!bIsEnraged && GetHealthPercent() <= EnrageHealthThreshold)
+        {
+            EnterEnrageMode();
+        }
+    }
+    
     // 보스 체력 변경 이벤트
     OnBossHealthChanged.Broadcast(GetHealth(), GetMaxHealth());
 }
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "HuntingSpirit/Enemies/Base/HSEnemyBase.h"
 #include "Engine/DataTable.h"
+#include "UObject/ObjectKey.h"
 #include "HuntingSpirit/Items/HSItemBase.h" // AHSItemBase 완전한 타입 정의를 위해 추가
 #include "HSBossBase.generated.h"
 
@@ -108,6 +109,10 @@ class HUNTINGSPIRIT_API AHSBossBase : public AHSEnemyBase
 {
     GENERATED_BODY()
 
+#if WITH_DEV_AUTOMATION_TESTS
+    friend class FHSBossEngagementMinionLoadTest;
+#endif
+
 public:
     // 생성자
     AHSBossBase();
@@ -260,6 +265,14 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Boss|Coop")
     TArray<AActor*> EngagedPlayers;
 
+    // 교전 판정 주기 (초, 매 프레임 대신 이 간격으로 플레이어 위치 색인을 조회)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss|Coop", meta = (ClampMin = "0.0"))
+    float EngagementUpdateInterval = 0.25f;
+
+    // 교전 이탈 거리 배율 (AggroRange 안에서 진입, AggroRange * 배율 밖에서 이탈)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss|Coop", meta = (ClampMin = "1.0"))
+    float EngagementExitRangeMultiplier = 1.2f;
+
     // 특수 능력
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss|Ability")
     TMap<FName, bool> SpecialAbilities;
@@ -399,6 +412,12 @@ private:
     // 플레이어 위협 수준 추적
     TMap<AActor*, float> PlayerThreatLevels;
     
+    // 교전 중인 플레이어 집합 (EngagedPlayers와 동일한 구성, 포함 여부 확인용)
+    TSet<TObjectKey<AActor>> EngagedPlayerKeys;
+    
+    // 마지막 교전 판정 이후 경과 시간
+    float TimeSinceEngagementUpdate = 0.0f;
+    
     // 내부 헬퍼 함수들
     void InitializePhaseThresholds();
     void InitializeAttackPatterns();
@@ -407,4 +426,7 @@ private:
     void UpdatePatternWeights();
     float CalculateThreatLevel(AActor* Player) const;
     void BroadcastBossEvents();
+    void AddEngagedPlayer(AActor* Player);
+    void RebuildEngagedPlayerKeys();
+    static bool IsEngagedPlayerDead(const AActor* Player);
 };
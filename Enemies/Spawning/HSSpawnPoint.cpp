@@ -4,6 +4,7 @@
 #include "HSSpawnPoint.h"
 #include "HuntingSpirit/Enemies/Base/HSEnemyBase.h"
 #include "HuntingSpirit/Enemies/Spawning/HSEnemySpawner.h"
+#include "HuntingSpirit/Optimization/HSThrottledTaskScheduler.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "Engine/Engine.h"
@@ -83,6 +84,29 @@ void AHSSpawnPoint::BeginPlay()
 	{
 		SetActorTickEnabled(true);
 	}
+
+	// 죽은 적 정리 (2초마다, 스폰 포인트 간 위상 분산)
+	if (UHSThrottledTaskScheduler* Scheduler = GetWorld()->GetSubsystem<UHSThrottledTaskScheduler>())
+	{
+		Scheduler->RegisterTask(this, 2.0f, FHSThrottledTaskDelegate::CreateWeakLambda(this, [this](float)
+		{
+			ClearDeadEnemies();
+		}));
+	}
+}
+
+// 게임 종료/제거 시 정리
+void AHSSpawnPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UHSThrottledTaskScheduler* Scheduler = World->GetSubsystem<UHSThrottledTaskScheduler>())
+		{
+			Scheduler->UnregisterAllTasks(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // 스폰 포인트 초기화
@@ -111,14 +135,6 @@ void AHSSpawnPoint::Tick(float DeltaTime)
 		DrawDebugInfo();
 	}
 
-	// 죽은 적들 정리 (성능 최적화를 위해 주기적으로)
-	static float CleanupTimer = 0.0f;
-	CleanupTimer += DeltaTime;
-	if (CleanupTimer >= 2.0f) // 2초마다 정리
-	{
-		ClearDeadEnemies();
-		CleanupTimer = 0.0f;
-	}
 }
 
 // 스폰 포인트 활성화
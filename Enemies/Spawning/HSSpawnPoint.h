@@ -188,6 +188,9 @@ protected:
 	// 게임 시작 시 호출
 	virtual void BeginPlay() override;
 
+	// 게임 종료/제거 시 호출
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// 컴포넌트들
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	USceneComponent* RootSceneComponent;
@@ -6,6 +6,7 @@
 #include "HuntingSpirit/Enemies/Regular/HSBasicMeleeEnemy.h"
 #include "HuntingSpirit/Enemies/Regular/HSBasicRangedEnemy.h"
 #include "HuntingSpirit/Characters/Player/HSPlayerCharacter.h"
+#include "HuntingSpirit/Optimization/HSGarbageCollectionManager.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -476,6 +477,17 @@ void AHSWaveManager::SetWaveState(EHSWaveState NewState)
 	if (CurrentWaveState != NewState)
 	{
 		CurrentWaveState = NewState;
+
+		// 웨이브 진행 중에는 가비지 컬렉션을 미루고, 웨이브 사이를 휴지 구간으로 알림
+		if (UHSGarbageCollectionManager* GCManager = GetWorld() ? GetWorld()->GetSubsystem<UHSGarbageCollectionManager>() : nullptr)
+		{
+			GCManager->SetCombatHold(this, NewState == EHSWaveState::InProgress);
+			if (NewState == EHSWaveState::Preparing || NewState == EHSWaveState::Completed)
+			{
+				GCManager->NotifyNaturalPause();
+			}
+		}
+
 		OnWaveStateChanged.Broadcast(NewState);
 	}
 }
@@ -2,6 +2,7 @@
 #include "../../Items/HSItemBase.h"
 #include "../Inventory/HSInventoryComponent.h"
 #include "HuntingSpirit/RoguelikeSystem/Progression/HSUnlockSystem.h"
+#include "HuntingSpirit/Optimization/HSAssetPreloadManager.h"
 #include "Engine/World.h"
 #include "Engine/DataTable.h"
 #include "Engine/Engine.h"
@@ -68,6 +69,12 @@ void UHSCraftingSystem::Deinitialize()
         World->GetTimerManager().ClearTimer(MemoryOptimizationTimerHandle);
     }
 
+    // 레시피 에셋 선로딩 해제
+    if (UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get())
+    {
+        PreloadManager->ReleasePreload(RecipePreloadGroup);
+    }
+
     // 캐시 정리
     CachedRecipes.Empty();
     ActiveJobs.Empty();
@@ -116,10 +123,48 @@ bool UHSCraftingSystem::LoadRecipesFromDataTable()
     // 카테고리 캐시 구축
     BuildCategoryCache();
 
+    // 레시피 재료/결과 아이템을 제작 요청 전에 미리 비동기 로드
+    PreloadRecipeAssets();
+
     UE_LOG(LogTemp, Log, TEXT("HSCraftingSystem::LoadRecipesFromDataTable - %d개 레시피 로드 완료"), CachedRecipes.Num());
     return true;
 }
 
+void UHSCraftingSystem::PreloadRecipeAssets()
+{
+    UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get();
+    if (!PreloadManager)
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> AssetPaths;
+    for (const auto& RecipePair : CachedRecipes)
+    {
+        const FHSCraftingRecipe& Recipe = RecipePair.Value;
+        if (!Recipe.ResultItem.IsNull())
+        {
+            AssetPaths.Add(Recipe.ResultItem.ToSoftObjectPath());
+        }
+
+        for (const FHSCraftingMaterial& Material : Recipe.RequiredMaterials)
+        {
+            if (!Material.RequiredItem.IsNull())
+            {
+                AssetPaths.Add(Material.RequiredItem.ToSoftObjectPath());
+            }
+        }
+    }
+
+    // 레시피를 다시 읽었으면 이전 세트를 해제하고 새로 요청
+    if (!RecipePreloadGroup.IsNone())
+    {
+        PreloadManager->ReleasePreload(RecipePreloadGroup);
+    }
+    RecipePreloadGroup = FName(*FString::Printf(TEXT("%s.Recipes"), *GetName()));
+    PreloadManager->RequestPreload(RecipePreloadGroup, AssetPaths);
+}
+
 TArray<FHSCraftingRecipe> UHSCraftingSystem::GetAllRecipes() const
 {
     TArray<FHSCraftingRecipe> Recipes;
@@ -220,7 +265,7 @@ bool UHSCraftingSystem::HasRequiredMaterials(UHSInventoryComponent* Inventory, c
             continue;
         }
 
-        UHSItemInstance* RequiredItem = Material.RequiredItem.LoadSynchronous();
+        UHSItemInstance* RequiredItem = UHSAssetPreloadManager::ResolveSoftObject(Material.RequiredItem, TEXT("UHSCraftingSystem::HasRequiredMaterials"));
         if (!RequiredItem)
         {
             UE_LOG(LogTemp, Warning, TEXT("HSCraftingSystem::HasRequiredMaterials - 아이템 로드 실패"));
@@ -464,7 +509,7 @@ bool UHSCraftingSystem::CancelCrafting(int32 JobID)
             {
                 if (Material.bIsConsumed)
                 {
-                    UHSItemInstance* Item = Material.RequiredItem.LoadSynchronous();
+                    UHSItemInstance* Item = UHSAssetPreloadManager::ResolveSoftObject(Material.RequiredItem, TEXT("UHSCraftingSystem::CancelCrafting"));
                     if (Item)
                     {
                         int32 ReturnQuantity = FMath::FloorToInt(Material.RequiredQuantity * Job->CraftingQuantity * 0.7f);
@@ -751,7 +796,7 @@ bool UHSCraftingSystem::ConsumeMaterials(UHSInventoryComponent* Inventory, const
     {
         if (Material.bIsConsumed)
         {
-            UHSItemInstance* Item = Material.RequiredItem.LoadSynchronous();
+            UHSItemInstance* Item = UHSAssetPreloadManager::ResolveSoftObject(Material.RequiredItem, TEXT("UHSCraftingSystem::ConsumeMaterials"));
             if (Item)
             {
                 int32 ConsumeQuantity = Material.RequiredQuantity * Quantity;
@@ -775,7 +820,7 @@ void UHSCraftingSystem::GiveResultItems(UHSInventoryComponent* Inventory, const
         return;
     }
 
-    UHSItemInstance* ResultItem = Recipe.ResultItem.LoadSynchronous();
+    UHSItemInstance* ResultItem = UHSAssetPreloadManager::ResolveSoftObject(Recipe.ResultItem, TEXT("UHSCraftingSystem::GiveResultItems"));
     if (ResultItem)
     {
         int32 TotalQuantity = Recipe.ResultQuantity * Quantity;
@@ -826,7 +871,7 @@ void UHSCraftingSystem::CompleteCraftingJob(int32 JobID)
         Job->State = EHSCraftingState::Completed;
 
         // 이벤트 브로드캐스트
-        UHSItemInstance* ResultItem = Job->Recipe.ResultItem.LoadSynchronous();
+        UHSItemInstance* ResultItem = UHSAssetPreloadManager::ResolveSoftObject(Job->Recipe.ResultItem, TEXT("UHSCraftingSystem::CompleteCraftingJob"));
         int32 TotalQuantity = Job->Recipe.ResultQuantity * Job->CraftingQuantity;
         OnCraftingCompleted.Broadcast(JobID, ResultItem, TotalQuantity);
 
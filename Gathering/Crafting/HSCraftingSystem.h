@@ -345,6 +345,9 @@ protected:
     void RemoveFromCrafterJobsCache(AActor* Crafter, int32 JobID);
     void BuildCategoryCache();
 
+    // 레시피 아이템 에셋 선로딩 (제작 중 동기 로딩 방지)
+    void PreloadRecipeAssets();
+
     // 성능 최적화
     void OptimizeMemoryUsage();
     void ClearExpiredJobs();
@@ -357,4 +360,7 @@ private:
     // 타이머 핸들
     FTimerHandle JobUpdateTimerHandle;
     FTimerHandle MemoryOptimizationTimerHandle;
+
+    // 레시피 아이템 선로딩 그룹
+    FName RecipePreloadGroup;
 };
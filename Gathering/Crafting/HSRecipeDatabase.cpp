@@ -4,6 +4,7 @@
 #include "Engine/World.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "HuntingSpirit/Optimization/HSAssetPreloadManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/DateTime.h"
 #include "Dom/JsonObject.h"
@@ -43,6 +44,12 @@ bool UHSRecipeDatabase::LoadAllData()
         // 자주 사용되는 데이터 캐시
         CacheFrequentlyAccessedData();
 
+        // 나머지 레시피 아이템도 검색/조회 전에 백그라운드로 로드
+        TArray<FName> AllRecipeIDs;
+        CachedRecipes.GetKeys(AllRecipeIDs);
+        PreloadRecipeAssets(FName(*FString::Printf(TEXT("%s.Recipes"), *GetName())), AllRecipeIDs,
+                            FStreamableManager::DefaultAsyncLoadPriority);
+
         bDataLoaded = true;
         UE_LOG(LogTemp, Log, TEXT("HSRecipeDatabase::LoadAllData - 데이터베이스 로딩 완료"));
         return true;
@@ -56,6 +63,7 @@ bool UHSRecipeDatabase::LoadAllData()
 
 void UHSRecipeDatabase::ClearCache()
 {
+    ReleaseRecipePreloads();
     CachedRecipes.Empty();
     CachedCategories.Empty();
     CachedGroups.Empty();
@@ -158,7 +166,7 @@ TArray<FHSCraftingRecipe> UHSRecipeDatabase::SearchRecipes(const FString& Search
         }
 
         // 결과 아이템 이름에서 검색
-        if (UHSItemInstance* ResultItem = Recipe.ResultItem.LoadSynchronous())
+        if (UHSItemInstance* ResultItem = UHSAssetPreloadManager::ResolveSoftObject(Recipe.ResultItem, TEXT("UHSRecipeDatabase::SearchRecipes")))
         {
             if (ResultItem->GetItemName().ToLower().Contains(LowerSearchTerm))
             {
@@ -291,7 +299,7 @@ TArray<FName> UHSRecipeDatabase::GetRecipeIDsByResultItem(UHSItemInstance* Resul
     for (const auto& RecipePair : CachedRecipes)
     {
         const FHSCraftingRecipe& Recipe = RecipePair.Value;
-        UHSItemInstance* RecipeResultItem = Recipe.ResultItem.LoadSynchronous();
+        UHSItemInstance* RecipeResultItem = UHSAssetPreloadManager::ResolveSoftObject(Recipe.ResultItem, TEXT("UHSRecipeDatabase::GetRecipeIDsByResultItem"));
         
         if (RecipeResultItem && RecipeResultItem->GetClass() == ResultItem->GetClass())
         {
@@ -317,7 +325,7 @@ TArray<FName> UHSRecipeDatabase::GetRecipeIDsByMaterial(UHSItemInstance* Materia
         
         for (const FHSCraftingMaterial& RecipeMaterial : Recipe.RequiredMaterials)
         {
-            UHSItemInstance* RequiredItem = RecipeMaterial.RequiredItem.LoadSynchronous();
+            UHSItemInstance* RequiredItem = UHSAssetPreloadManager::ResolveSoftObject(RecipeMaterial.RequiredItem, TEXT("UHSRecipeDatabase::GetRecipeIDsByMaterial"));
             if (RequiredItem && RequiredItem->GetClass() == Material->GetClass())
             {
                 RecipeIDs.Add(Recipe.RecipeID);
@@ -569,29 +577,61 @@ bool UHSRecipeDatabase::ImportFromJSON(const FString& FilePath)
 
 void UHSRecipeDatabase::PreloadFrequentlyUsedRecipes(const TArray<FName>& RecipeIDs)
 {
+    // 레시피별 그룹으로 요청해 같은 레시피의 반복 요청은 하나로 합쳐지게 함
+    for (const FName& RecipeID : RecipeIDs)
+    {
+        PreloadRecipeAssets(FName(*FString::Printf(TEXT("%s.Recipe.%s"), *GetName(), *RecipeID.ToString())),
+                            { RecipeID }, FStreamableManager::AsyncLoadHighPriority);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("HSRecipeDatabase::PreloadFrequentlyUsedRecipes - %d개 레시피 비동기 선로딩 요청"), 
+           RecipeIDs.Num());
+}
+
+void UHSRecipeDatabase::PreloadRecipeAssets(FName GroupName, const TArray<FName>& RecipeIDs, TAsyncLoadPriority Priority)
+{
+    UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get();
+    if (!PreloadManager || PreloadManager->IsPreloadRequested(GroupName))
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> AssetPaths;
     for (const FName& RecipeID : RecipeIDs)
     {
         if (const FHSCraftingRecipe* Recipe = CachedRecipes.Find(RecipeID))
         {
-            // 결과 아이템 미리 로드
+            // 결과 아이템
             if (!Recipe->ResultItem.IsNull())
             {
-                Recipe->ResultItem.LoadSynchronous();
+                AssetPaths.Add(Recipe->ResultItem.ToSoftObjectPath());
             }
 
-            // 재료 아이템들 미리 로드
+            // 재료 아이템들
             for (const FHSCraftingMaterial& Material : Recipe->RequiredMaterials)
             {
                 if (!Material.RequiredItem.IsNull())
                 {
-                    Material.RequiredItem.LoadSynchronous();
+                    AssetPaths.Add(Material.RequiredItem.ToSoftObjectPath());
                 }
             }
         }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("HSRecipeDatabase::PreloadFrequentlyUsedRecipes - %d개 레시피 미리 로드 완료"), 
-           RecipeIDs.Num());
+    RecipePreloadGroups.Add(GroupName);
+    PreloadManager->RequestPreload(GroupName, AssetPaths, FStreamableDelegate(), Priority);
+}
+
+void UHSRecipeDatabase::ReleaseRecipePreloads()
+{
+    if (UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get())
+    {
+        for (const FName& GroupName : RecipePreloadGroups)
+        {
+            PreloadManager->ReleasePreload(GroupName);
+        }
+    }
+    RecipePreloadGroups.Empty();
 }
 
 void UHSRecipeDatabase::OptimizeMemoryUsage()
@@ -257,12 +257,19 @@ protected:
     void AsyncLoadRecipeData();
     void CacheFrequentlyAccessedData();
 
+    // 레시피 아이템 에셋을 비동기로 선로딩 (검색/조회 중 동기 로딩 방지)
+    void PreloadRecipeAssets(FName GroupName, const TArray<FName>& RecipeIDs, TAsyncLoadPriority Priority);
+    void ReleaseRecipePreloads();
+
 private:
     // 성능 최적화를 위한 정적 캐시
     static TMap<FName, TWeakObjectPtr<UHSRecipeDatabase>> DatabaseCache;
     
     // 메모리 관리
     void CleanupUnusedReferences();
+
+    // 요청한 선로딩 그룹 (캐시 클리어 시 해제)
+    TArray<FName> RecipePreloadGroups;
 };
 
 /**
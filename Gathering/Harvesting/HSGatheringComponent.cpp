@@ -1,6 +1,7 @@
 // HSGatheringComponent.cpp
 #include "HSGatheringComponent.h"
 #include "HuntingSpirit/World/Resources/HSResourceNode.h"
+#include "HuntingSpirit/World/Resources/HSResourceNodeRegistry.h"
 #include "GameFramework/Character.h"
 #include "Components/AudioComponent.h"
 #include "Particles/ParticleSystemComponent.h"
@@ -16,7 +17,6 @@
 #include "Animation/AnimInstance.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/KismetSystemLibrary.h"
 
 UHSGatheringComponent::UHSGatheringComponent()
 {
@@ -78,46 +78,29 @@ void UHSGatheringComponent::ScanForResourceNodes()
     if (!OwnerCharacter)
         return;
 
-    // 이전 감지 목록 초기화
-    DetectedResourceNodes.Empty();
+    UHSResourceNodeRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UHSResourceNodeRegistry>() : nullptr;
+    if (!Registry)
+        return;
+
+    // 이전 감지 목록 보관 (신규 감지 이벤트 판별용)
+    TSet<TWeakObjectPtr<AHSResourceNode>> PreviouslyDetected(DetectedResourceNodes);
+    DetectedResourceNodes.Reset();
 
-    // 구체 오버랩으로 주변 액터 검색 - 대안적인 구현 방식
+    // 물리 오버랩 대신 공간 레지스트리 그리드 조회 (등록된 노드만 검사)
     FVector OwnerLocation = OwnerCharacter->GetActorLocation();
-    
-    // TArray<AActor*>를 사용하여 범위 내 모든 액터 찾기
-    TArray<AActor*> FoundActors;
-    TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_WorldDynamic));
-    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_WorldStatic));
-    
-    // 스위프 구체 트레이스 대신 액터 오버랩 사용
-    TArray<AActor*> ActorsToIgnore;
-    ActorsToIgnore.Add(GetOwner());
-    
-    UKismetSystemLibrary::SphereOverlapActors(
-        GetWorld(),
-        OwnerLocation,
-        DetectionRange,
-        ObjectTypes,
-        AHSResourceNode::StaticClass(),
-        ActorsToIgnore,
-        FoundActors
-    );
+    TArray<AHSResourceNode*> FoundNodes;
+    Registry->QueryNodesInRadius(OwnerLocation, DetectionRange, ScanResourceTypeFilter, FoundNodes);
 
-    // 자원 노드만 필터링
-    for (AActor* Actor : FoundActors)
+    for (AHSResourceNode* ResourceNode : FoundNodes)
     {
-        if (Actor && Actor->IsA<AHSResourceNode>())
+        if (ResourceNode->CanBeGathered())
         {
-            if (AHSResourceNode* ResourceNode = Cast<AHSResourceNode>(Actor))
+            DetectedResourceNodes.Add(ResourceNode);
+
+            // 새로 감지된 노드 이벤트 발생
+            if (!PreviouslyDetected.Contains(ResourceNode))
             {
-                if (ResourceNode->CanBeGathered())
-                {
-                    DetectedResourceNodes.Add(ResourceNode);
-                    
-                    // 새로 감지된 노드 이벤트 발생
-                    OnResourceNodeDetected.Broadcast(ResourceNode);
-                }
+                OnResourceNodeDetected.Broadcast(ResourceNode);
             }
         }
     }
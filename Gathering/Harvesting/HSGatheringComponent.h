@@ -131,6 +131,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gathering", meta = (ClampMin = "50.0"))
     float GatheringRange = 150.0f;
 
+    // 주기 스캔 시 감지할 자원 타입 (None이면 전체)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gathering")
+    EResourceType ScanResourceTypeFilter = EResourceType::None;
+
     // 자원 노드 스캔 주기 (초)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gathering", meta = (ClampMin = "0.1"))
     float ScanInterval = 0.5f;
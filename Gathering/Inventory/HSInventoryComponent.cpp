@@ -3,6 +3,37 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+    // 정렬된 슬롯 목록에 중복 없이 삽입
+    void InsertSortedSlot(TArray<int32>& Slots, int32 SlotIndex)
+    {
+        const int32 InsertAt = Algo::LowerBound(Slots, SlotIndex);
+        if (!Slots.IsValidIndex(InsertAt) || Slots[InsertAt] != SlotIndex)
+        {
+            Slots.Insert(SlotIndex, InsertAt);
+        }
+    }
+
+    // 정렬된 슬롯 목록에서 제거, 목록이 비면 맵 엔트리도 제거
+    void RemoveSortedSlot(TMap<FName, TArray<int32>>& SlotMap, FName ItemID, int32 SlotIndex)
+    {
+        if (TArray<int32>* Slots = SlotMap.Find(ItemID))
+        {
+            const int32 FoundAt = Algo::BinarySearch(*Slots, SlotIndex);
+            if (FoundAt != INDEX_NONE)
+            {
+                Slots->RemoveAt(FoundAt, 1, false);
+            }
+            if (Slots->Num() == 0)
+            {
+                SlotMap.Remove(ItemID);
+            }
+        }
+    }
+}
 
 bool FHSInventorySlot::CanStack(UHSItemInstance* InItem) const
 {
@@ -12,7 +43,7 @@ bool FHSInventorySlot::CanStack(UHSItemInstance* InItem) const
     }
 
     // 동일한 아이템인지 확인
-    if (Item->GetClass() != InItem->GetClass())
+    if (Item->GetClass() != InItem->GetClass() || Item->GetItemID() != InItem->GetItemID())
     {
         return false;
     }
@@ -39,20 +70,146 @@ void FHSInventorySlot::Clear()
     bIsLocked = false;
 }
 
-void FHSInventorySlotFastArray::SyncFromLegacyArray(const TArray<FHSInventorySlot>& SourceSlots, bool bMarkDirty)
+bool FHSInventorySlot::HasSameContents(const FHSInventorySlot& Other) const
+{
+    if (bIsEmpty && Other.bIsEmpty)
+    {
+        return bIsLocked == Other.bIsLocked;
+    }
+
+    return Item == Other.Item
+        && Quantity == Other.Quantity
+        && MaxStackSize == Other.MaxStackSize
+        && bIsLocked == Other.bIsLocked
+        && bIsEmpty == Other.bIsEmpty;
+}
+
+int32 FHSInventorySlotFastArray::SyncFromLegacyArray(const TArray<FHSInventorySlot>& SourceSlots, bool bMarkDirty)
 {
-    Items.Reset(SourceSlots.Num());
+    int32 ChangedCount = 0;
+    bool bStructureChanged = false;
+
+    // 슬롯 수가 줄어든 경우 초과 항목 제거
+    if (Items.Num() > SourceSlots.Num())
+    {
+        Items.SetNum(SourceSlots.Num());
+        bStructureChanged = true;
+    }
+
     for (int32 Index = 0; Index < SourceSlots.Num(); ++Index)
     {
-        FHSInventorySlotFastArrayItem& NewItem = Items.AddDefaulted_GetRef();
-        NewItem.SlotIndex = Index;
-        NewItem.Slot = SourceSlots[Index];
+        if (!Items.IsValidIndex(Index))
+        {
+            FHSInventorySlotFastArrayItem& NewItem = Items.AddDefaulted_GetRef();
+            NewItem.SlotIndex = Index;
+            NewItem.Slot = SourceSlots[Index];
+            if (bMarkDirty)
+            {
+                MarkItemDirty(NewItem);
+            }
+            ++ChangedCount;
+            continue;
+        }
+
+        // 내용이 실제로 바뀐 슬롯만 더티 처리
+        FHSInventorySlotFastArrayItem& ExistingItem = Items[Index];
+        if (!ExistingItem.Slot.HasSameContents(SourceSlots[Index]))
+        {
+            ExistingItem.Slot = SourceSlots[Index];
+            if (bMarkDirty)
+            {
+                MarkItemDirty(ExistingItem);
+            }
+            ++ChangedCount;
+        }
     }
 
-    if (bMarkDirty)
+    if (bStructureChanged && bMarkDirty)
     {
         MarkArrayDirty();
     }
+
+    return ChangedCount;
+}
+
+int32 FHSInventorySlotFastArray::SyncDirtySlots(const TArray<FHSInventorySlot>& SourceSlots, const TSet<int32>& DirtySlots, bool bMarkDirty, TArray<int32>& OutChangedSlots)
+{
+    OutChangedSlots.Reset();
+
+    // 슬롯 수가 달라졌으면 전체 비교로 대체
+    if (Items.Num() != SourceSlots.Num())
+    {
+        TArray<FHSInventorySlot> PreviousSlots;
+        PreviousSlots.Reserve(Items.Num());
+        for (const FHSInventorySlotFastArrayItem& ExistingItem : Items)
+        {
+            PreviousSlots.Add(ExistingItem.Slot);
+        }
+
+        const int32 ChangedCount = SyncFromLegacyArray(SourceSlots, bMarkDirty);
+        for (int32 Index = 0; Index < SourceSlots.Num(); ++Index)
+        {
+            if (!PreviousSlots.IsValidIndex(Index) || !PreviousSlots[Index].HasSameContents(SourceSlots[Index]))
+            {
+                OutChangedSlots.Add(Index);
+            }
+        }
+        return ChangedCount;
+    }
+
+    for (const int32 SlotIndex : DirtySlots)
+    {
+        if (!SourceSlots.IsValidIndex(SlotIndex))
+        {
+            continue;
+        }
+
+        FHSInventorySlotFastArrayItem& ExistingItem = Items[SlotIndex];
+        if (!ExistingItem.Slot.HasSameContents(SourceSlots[SlotIndex]))
+        {
+            ExistingItem.Slot = SourceSlots[SlotIndex];
+            if (bMarkDirty)
+            {
+                MarkItemDirty(ExistingItem);
+            }
+            OutChangedSlots.Add(SlotIndex);
+        }
+    }
+
+    OutChangedSlots.Sort();
+    return OutChangedSlots.Num();
+}
+
+void FHSInventorySlotFastArrayItem::PreReplicatedRemove(const FHSInventorySlotFastArray& InArraySerializer)
+{
+    if (InArraySerializer.OwnerComponent)
+    {
+        InArraySerializer.OwnerComponent->HandleReplicatedSlot(*this, /*bRemoved=*/true);
+    }
+}
+
+void FHSInventorySlotFastArrayItem::PostReplicatedAdd(const FHSInventorySlotFastArray& InArraySerializer)
+{
+    if (InArraySerializer.OwnerComponent)
+    {
+        InArraySerializer.OwnerComponent->HandleReplicatedSlot(*this, /*bRemoved=*/false);
+    }
+}
+
+void FHSInventorySlotFastArrayItem::PostReplicatedChange(const FHSInventorySlotFastArray& InArraySerializer)
+{
+    if (InArraySerializer.OwnerComponent)
+    {
+        InArraySerializer.OwnerComponent->HandleReplicatedSlot(*this, /*bRemoved=*/false);
+    }
+}
+
+void FHSInventorySlotFastArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (OwnerComponent)
+    {
+        OwnerComponent->HandleReplicatedSlotsReceived();
+    }
 }
 
 UHSInventoryComponent::UHSInventoryComponent()
@@ -65,6 +222,7 @@ UHSInventoryComponent::UHSInventoryComponent()
     bAutoSort = false;
     bStackSimilarItems = true;
     LastNetworkUpdate = 0.0f;
+    EmptySlotCount = 0;
 
     // 슬롯 초기화
     InventorySlots.SetNum(MaxSlots);
@@ -73,16 +231,18 @@ UHSInventoryComponent::UHSInventoryComponent()
         InventorySlots[i] = FHSInventorySlot();
     }
 
-    ReplicatedFastSlots.SyncFromLegacyArray(InventorySlots, /*bMarkDirty=*/false);
+    RebuildSlotIndex();
+
+    // FastArray 항목은 서버 BeginPlay에서 채움 (클라이언트는 복제된 항목만 보유해야 함)
+    ReplicatedFastSlots.OwnerComponent = this;
 }
 
 void UHSInventoryComponent::BeginPlay()
 {
     Super::BeginPlay();
 
-    // 캐시 초기화
-    UpdateItemCache();
-    UpdateEmptySlotCache();
+    // 슬롯 인덱스 초기화
+    RebuildSlotIndex();
     SyncFastArrayState();
 
     // 네트워크 최적화 타이머 설정
@@ -102,8 +262,8 @@ void UHSInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     
-    // 조건부 복제로 네트워크 트래픽 최적화
-    DOREPLIFETIME_CONDITION(UHSInventoryComponent, InventorySlots, COND_OwnerOnly);
+    // 조건부 복제로 네트워크 트래픽 최적화 (슬롯 단위 델타)
+    DOREPLIFETIME_CONDITION(UHSInventoryComponent, ReplicatedFastSlots, COND_OwnerOnly);
 }
 
 bool UHSInventoryComponent::AddItem(UHSItemInstance* Item, int32 Quantity, int32& OutSlotIndex)
@@ -124,16 +284,21 @@ bool UHSInventoryComponent::AddItem(UHSItemInstance* Item, int32 Quantity, int32
     int32 RemainingQuantity = Quantity;
     OutSlotIndex = -1;
 
-    // 1. 기존 스택에 추가 시도
-    if (bStackSimilarItems && Item->CanStack())
+    // 1. 기존 스택에 추가 시도 (여유 스택 인덱스만 순회)
+    const TArray<int32>* PartialStacks = PartialStacksByID.Find(Item->GetItemID());
+    if (bStackSimilarItems && Item->CanStack() && PartialStacks)
     {
-        for (int32 i = 0; i < InventorySlots.Num(); ++i)
+        // 스택이 가득 차면 인덱스에서 빠지므로 복사본을 순회
+        const TArray<int32> CandidateSlots = *PartialStacks;
+        for (const int32 i : CandidateSlots)
         {
             FHSInventorySlot& Slot = InventorySlots[i];
             if (Slot.CanStack(Item))
             {
                 int32 CanAdd = FMath::Min(RemainingQuantity, Slot.MaxStackSize - Slot.Quantity);
+                UnindexSlot(i);
                 Slot.Quantity += CanAdd;
+                IndexSlot(i);
                 RemainingQuantity -= CanAdd;
 
                 if (OutSlotIndex == -1)
@@ -166,10 +331,12 @@ bool UHSInventoryComponent::AddItem(UHSItemInstance* Item, int32 Quantity, int32
         FHSInventorySlot& Slot = InventorySlots[EmptySlotIndex];
         int32 CanAdd = FMath::Min(RemainingQuantity, Item->GetMaxStackSize());
         
+        UnindexSlot(EmptySlotIndex);
         Slot.Item = Item;
         Slot.Quantity = CanAdd;
         Slot.MaxStackSize = Item->GetMaxStackSize();
         Slot.bIsEmpty = false;
+        IndexSlot(EmptySlotIndex);
 
         RemainingQuantity -= CanAdd;
 
@@ -182,10 +349,6 @@ bool UHSInventoryComponent::AddItem(UHSItemInstance* Item, int32 Quantity, int32
         OnItemAdded.Broadcast(Item, CanAdd, EmptySlotIndex);
     }
 
-    // 캐시 업데이트
-    UpdateItemCache();
-    UpdateEmptySlotCache();
-
     return true;
 }
 
@@ -205,13 +368,22 @@ bool UHSInventoryComponent::RemoveItem(UHSItemInstance* Item, int32 Quantity)
 
     int32 RemainingQuantity = Quantity;
 
-    // 뒤에서부터 제거 (LIFO 방식)
-    for (int32 i = InventorySlots.Num() - 1; i >= 0 && RemainingQuantity > 0; --i)
+    const TArray<int32>* OccupiedSlots = ItemSlotsByID.Find(Item->GetItemID());
+    if (!OccupiedSlots)
+    {
+        return false;
+    }
+
+    // 뒤에서부터 제거 (LIFO 방식), 슬롯이 비면 인덱스에서 빠지므로 복사본을 순회
+    const TArray<int32> CandidateSlots = *OccupiedSlots;
+    for (int32 CandidateIndex = CandidateSlots.Num() - 1; CandidateIndex >= 0 && RemainingQuantity > 0; --CandidateIndex)
     {
+        const int32 i = CandidateSlots[CandidateIndex];
         FHSInventorySlot& Slot = InventorySlots[i];
-        if (Slot.Item == Item && !Slot.bIsEmpty)
+        if (!Slot.bIsEmpty)
         {
             int32 CanRemove = FMath::Min(RemainingQuantity, Slot.Quantity);
+            UnindexSlot(i);
             Slot.Quantity -= CanRemove;
             RemainingQuantity -= CanRemove;
 
@@ -219,16 +391,13 @@ bool UHSInventoryComponent::RemoveItem(UHSItemInstance* Item, int32 Quantity)
             {
                 Slot.Clear();
             }
+            IndexSlot(i);
 
             BroadcastInventoryChanged(i, Slot.bIsEmpty ? nullptr : Slot.Item);
             OnItemRemoved.Broadcast(Item, CanRemove, i);
         }
     }
 
-    // 캐시 업데이트
-    UpdateItemCache();
-    UpdateEmptySlotCache();
-
     return RemainingQuantity == 0;
 }
 
@@ -248,18 +417,16 @@ bool UHSInventoryComponent::RemoveItemFromSlot(int32 SlotIndex, int32 Quantity)
     int32 CanRemove = FMath::Min(Quantity, Slot.Quantity);
     UHSItemInstance* Item = Slot.Item;
     
+    UnindexSlot(SlotIndex);
     Slot.Quantity -= CanRemove;
     if (Slot.Quantity <= 0)
     {
         Slot.Clear();
     }
+    IndexSlot(SlotIndex);
 
-        BroadcastInventoryChanged(SlotIndex, Slot.bIsEmpty ? nullptr : Slot.Item);
-        OnItemRemoved.Broadcast(Item, CanRemove, SlotIndex);
-
-    // 캐시 업데이트
-    UpdateItemCache();
-    UpdateEmptySlotCache();
+    BroadcastInventoryChanged(SlotIndex, Slot.bIsEmpty ? nullptr : Slot.Item);
+    OnItemRemoved.Broadcast(Item, CanRemove, SlotIndex);
 
     return true;
 }
@@ -286,6 +453,9 @@ bool UHSInventoryComponent::MoveItem(int32 FromSlot, int32 ToSlot)
         return false;
     }
 
+    UnindexSlot(FromSlot);
+    UnindexSlot(ToSlot);
+
     // 대상 슬롯이 비어있으면 단순 이동
     if (ToSlotRef.bIsEmpty)
     {
@@ -312,6 +482,9 @@ bool UHSInventoryComponent::MoveItem(int32 FromSlot, int32 ToSlot)
         ToSlotRef = TempSlot;
     }
 
+    IndexSlot(FromSlot);
+    IndexSlot(ToSlot);
+
     BroadcastInventoryChanged(FromSlot, FromSlotRef.bIsEmpty ? nullptr : FromSlotRef.Item);
     BroadcastInventoryChanged(ToSlot, ToSlotRef.bIsEmpty ? nullptr : ToSlotRef.Item);
 
@@ -334,9 +507,13 @@ bool UHSInventoryComponent::SwapItems(int32 SlotA, int32 SlotB)
     }
 
     // 스왑
+    UnindexSlot(SlotA);
+    UnindexSlot(SlotB);
     FHSInventorySlot TempSlot = SlotRefA;
     SlotRefA = SlotRefB;
     SlotRefB = TempSlot;
+    IndexSlot(SlotA);
+    IndexSlot(SlotB);
 
     BroadcastInventoryChanged(SlotA, SlotRefA.bIsEmpty ? nullptr : SlotRefA.Item);
     BroadcastInventoryChanged(SlotB, SlotRefB.bIsEmpty ? nullptr : SlotRefB.Item);
@@ -371,8 +548,8 @@ int32 UHSInventoryComponent::GetItemQuantity(UHSItemInstance* Item) const
         return 0;
     }
 
-    // 캐시 사용으로 성능 최적화
-    if (const int32* CachedQuantity = ItemQuantityCache.Find(Item))
+    // 아이템 ID별 집계 수량 O(1) 조회
+    if (const int32* CachedQuantity = ItemQuantityByID.Find(Item->GetItemID()))
     {
         return *CachedQuantity;
     }
@@ -394,11 +571,13 @@ bool UHSInventoryComponent::HasSpaceForItem(UHSItemInstance* Item, int32 Quantit
 
     int32 RemainingQuantity = Quantity;
 
-    // 기존 스택에 추가 가능한 공간 확인
-    if (Item->CanStack())
+    // 기존 스택에 추가 가능한 공간 확인 (여유 스택 인덱스만 확인)
+    const TArray<int32>* PartialStacks = PartialStacksByID.Find(Item->GetItemID());
+    if (Item->CanStack() && PartialStacks)
     {
-        for (const FHSInventorySlot& Slot : InventorySlots)
+        for (const int32 SlotIndex : *PartialStacks)
         {
+            const FHSInventorySlot& Slot = InventorySlots[SlotIndex];
             if (Slot.CanStack(Item))
             {
                 int32 CanAdd = Slot.MaxStackSize - Slot.Quantity;
@@ -420,7 +599,7 @@ bool UHSInventoryComponent::HasSpaceForItem(UHSItemInstance* Item, int32 Quantit
 
 int32 UHSInventoryComponent::GetEmptySlotCount() const
 {
-    return EmptySlotCache.Num();
+    return EmptySlotCount;
 }
 
 TArray<FHSInventorySlot> UHSInventoryComponent::GetFilteredItems(EHSInventoryFilter Filter) const
@@ -468,36 +647,57 @@ TArray<FHSInventorySlot> UHSInventoryComponent::GetFilteredItems(EHSInventoryFil
 void UHSInventoryComponent::SortInventory()
 {
     // 정렬 알고리즘: 아이템 타입별, 이름별 정렬
-    TArray<FHSInventorySlot> NonEmptySlots;
-    
-    for (FHSInventorySlot& Slot : InventorySlots)
+    // 슬롯 내용 대신 점유 슬롯 인덱스의 순열을 계산해 이미 제자리인 슬롯은 건드리지 않음
+    TArray<int32> SortedOrder;
+    SortedOrder.Reserve(InventorySlots.Num() - EmptySlotCount);
+
+    for (int32 i = 0; i < InventorySlots.Num(); ++i)
     {
-        if (!Slot.bIsEmpty)
+        if (!InventorySlots[i].bIsEmpty && InventorySlots[i].Item)
         {
-            NonEmptySlots.Add(Slot);
-            Slot.Clear();
+            SortedOrder.Add(i);
         }
     }
 
-    // 정렬
-    NonEmptySlots.Sort([](const FHSInventorySlot& A, const FHSInventorySlot& B)
+    // 안정 정렬로 동일 키 아이템의 상대 순서를 유지 (이미 정렬된 인벤토리는 변경 없음)
+    SortedOrder.StableSort([this](int32 A, int32 B)
     {
-        if (A.Item->GetItemType() != B.Item->GetItemType())
+        const UHSItemInstance* ItemA = InventorySlots[A].Item;
+        const UHSItemInstance* ItemB = InventorySlots[B].Item;
+        if (ItemA->GetItemType() != ItemB->GetItemType())
         {
-            return static_cast<int32>(A.Item->GetItemType()) < static_cast<int32>(B.Item->GetItemType());
+            return static_cast<int32>(ItemA->GetItemType()) < static_cast<int32>(ItemB->GetItemType());
         }
-        return A.Item->GetItemName().Compare(B.Item->GetItemName()) < 0;
+        return ItemA->GetItemName().Compare(ItemB->GetItemName()) < 0;
     });
 
-    // 정렬된 아이템들을 다시 배치
-    for (int32 i = 0; i < NonEmptySlots.Num() && i < MaxSlots; ++i)
+    // 순열을 적용한 목표 배치 구성 (빈 자리는 기존 슬롯을 비운 상태로 유지)
+    TArray<FHSInventorySlot> SortedSlots = InventorySlots;
+    for (FHSInventorySlot& Slot : SortedSlots)
+    {
+        Slot.Clear();
+    }
+    for (int32 i = 0; i < SortedOrder.Num() && i < MaxSlots; ++i)
+    {
+        SortedSlots[i] = InventorySlots[SortedOrder[i]];
+    }
+
+    // 내용이 바뀐 슬롯만 반영/브로드캐스트
+    bool bAnyChanged = false;
+    for (int32 i = 0; i < InventorySlots.Num(); ++i)
     {
-        InventorySlots[i] = NonEmptySlots[i];
-        BroadcastInventoryChanged(i, InventorySlots[i].Item);
+        if (!InventorySlots[i].HasSameContents(SortedSlots[i]))
+        {
+            InventorySlots[i] = SortedSlots[i];
+            BroadcastInventoryChanged(i, InventorySlots[i].bIsEmpty ? nullptr : InventorySlots[i].Item);
+            bAnyChanged = true;
+        }
     }
 
-    UpdateItemCache();
-    UpdateEmptySlotCache();
+    if (bAnyChanged)
+    {
+        RebuildSlotIndex();
+    }
 }
 
 void UHSInventoryComponent::ClearInventory()
@@ -506,13 +706,12 @@ void UHSInventoryComponent::ClearInventory()
     {
         if (!InventorySlots[i].bIsEmpty)
         {
+            UnindexSlot(i);
             InventorySlots[i].Clear();
+            IndexSlot(i);
             BroadcastInventoryChanged(i, nullptr);
         }
     }
-
-    UpdateItemCache();
-    UpdateEmptySlotCache();
 }
 
 void UHSInventoryComponent::ResizeInventory(int32 NewSize)
@@ -527,6 +726,7 @@ void UHSInventoryComponent::ResizeInventory(int32 NewSize)
         {
             InventorySlots.Add(FHSInventorySlot());
         }
+        RebuildSlotIndex();
     }
     else if (NewSize < MaxSlots)
     {
@@ -541,6 +741,7 @@ void UHSInventoryComponent::ResizeInventory(int32 NewSize)
         }
 
         InventorySlots.SetNum(NewSize);
+        RebuildSlotIndex();
 
         // 제거된 아이템들을 다시 추가 시도
         for (FHSInventorySlot& Item : ItemsToKeep)
@@ -553,8 +754,10 @@ void UHSInventoryComponent::ResizeInventory(int32 NewSize)
         }
     }
 
+    // 슬롯 수 변경은 더티 슬롯 병합 대상이 아니므로 FastArray 전체를 맞춤
+    SyncFastArrayState();
+
     MaxSlots = NewSize;
-    UpdateEmptySlotCache();
 }
 
 // 네트워크 함수들
@@ -574,121 +777,198 @@ void UHSInventoryComponent::ServerMoveItem_Implementation(int32 FromSlot, int32
     MoveItem(FromSlot, ToSlot);
 }
 
-void UHSInventoryComponent::MulticastInventoryUpdate_Implementation(int32 SlotIndex, UHSItemInstance* Item, int32 Quantity)
+void UHSInventoryComponent::HandleReplicatedSlot(const FHSInventorySlotFastArrayItem& ReplicatedItem, bool bRemoved)
 {
-    if (!IsValidSlotIndex(SlotIndex))
-    {
-        return;
-    }
-
-    if (GetOwner() && GetOwner()->HasAuthority())
+    // 제거는 슬롯 수 축소에서만 발생하므로 수신 완료 시 크기를 맞춤
+    if (bRemoved || ReplicatedItem.SlotIndex < 0)
     {
-        // 서버는 이미 최신 상태를 반영했으므로 추가 처리 불필요
         return;
     }
 
-    FHSInventorySlot& Slot = InventorySlots[SlotIndex];
-
-    if (!Item || Quantity <= 0)
+    const int32 SlotIndex = ReplicatedItem.SlotIndex;
+    if (!bReplicatedLayoutChanged && IsValidSlotIndex(SlotIndex))
     {
-        Slot.Clear();
+        UnindexSlot(SlotIndex);
+        InventorySlots[SlotIndex] = ReplicatedItem.Slot;
+        IndexSlot(SlotIndex);
     }
     else
     {
-        Slot.Item = Item;
-        Slot.Quantity = Quantity;
-        Slot.MaxStackSize = Item->GetMaxStackSize();
-        Slot.bIsEmpty = false;
+        // 슬롯 수가 늘어난 경우 인덱스는 수신 완료 후 한 번에 재구성
+        if (SlotIndex >= InventorySlots.Num())
+        {
+            InventorySlots.SetNum(SlotIndex + 1);
+        }
+        InventorySlots[SlotIndex] = ReplicatedItem.Slot;
+        bReplicatedLayoutChanged = true;
     }
 
-    UpdateItemCache();
-    UpdateEmptySlotCache();
-    SyncFastArrayState();
-
-    OnInventoryChanged.Broadcast(SlotIndex, Slot.bIsEmpty ? nullptr : Slot.Item);
+    ReplicatedChangedSlots.Add(SlotIndex);
 }
 
-void UHSInventoryComponent::OnRep_InventorySlots()
+void UHSInventoryComponent::HandleReplicatedSlotsReceived()
 {
-    // 클라이언트에서 인벤토리 변경 시 처리
-    UpdateItemCache();
-    UpdateEmptySlotCache();
-    
-    // UI 업데이트를 위한 델리게이트 호출
-    for (int32 i = 0; i < InventorySlots.Num(); ++i)
+    if (InventorySlots.Num() != ReplicatedFastSlots.Items.Num())
     {
-        OnInventoryChanged.Broadcast(i, InventorySlots[i].Item);
+        InventorySlots.SetNum(ReplicatedFastSlots.Items.Num());
+        bReplicatedLayoutChanged = true;
     }
 
-    SyncFastArrayState();
+    if (bReplicatedLayoutChanged)
+    {
+        RebuildSlotIndex();
+        bReplicatedLayoutChanged = false;
+    }
+
+    // UI 업데이트는 실제로 바뀐 슬롯만
+    for (const int32 SlotIndex : ReplicatedChangedSlots)
+    {
+        if (IsValidSlotIndex(SlotIndex))
+        {
+            const FHSInventorySlot& Slot = InventorySlots[SlotIndex];
+            OnInventoryChanged.Broadcast(SlotIndex, Slot.bIsEmpty ? nullptr : Slot.Item);
+        }
+    }
+    ReplicatedChangedSlots.Reset();
 }
 
 // 내부 헬퍼 함수들
-int32 UHSInventoryComponent::FindEmptySlot()
+int32 UHSInventoryComponent::FindEmptySlot() const
 {
-    if (EmptySlotCache.Num() == 0)
+    // 64슬롯 단위 워드 스캔 후 최하위 비트 탐색
+    for (int32 WordIndex = 0; WordIndex < FreeSlotBits.Num(); ++WordIndex)
     {
-        UpdateEmptySlotCache();
+        const uint64 Word = FreeSlotBits[WordIndex];
+        if (Word != 0)
+        {
+            const int32 SlotIndex = WordIndex * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+            return IsValidSlotIndex(SlotIndex) ? SlotIndex : -1;
+        }
     }
 
-    if (EmptySlotCache.Num() == 0)
+    return -1;
+}
+
+int32 UHSInventoryComponent::FindSlotWithItem(UHSItemInstance* Item) const
+{
+    if (!Item)
     {
         return -1;
     }
 
-    const int32 SlotIndex = EmptySlotCache[0];
-    EmptySlotCache.RemoveAt(0, 1, false);
-    return SlotIndex;
+    const TArray<int32>* OccupiedSlots = ItemSlotsByID.Find(Item->GetItemID());
+    return OccupiedSlots ? (*OccupiedSlots)[0] : -1;
 }
 
-int32 UHSInventoryComponent::FindSlotWithItem(UHSItemInstance* Item) const
+int32 UHSInventoryComponent::FindSlotWithSpace(UHSItemInstance* Item) const
 {
-    for (int32 i = 0; i < InventorySlots.Num(); ++i)
+    if (!Item)
+    {
+        return -1;
+    }
+
+    if (const TArray<int32>* PartialStacks = PartialStacksByID.Find(Item->GetItemID()))
     {
-        if (InventorySlots[i].Item == Item && !InventorySlots[i].bIsEmpty)
+        for (const int32 SlotIndex : *PartialStacks)
         {
-            return i;
+            if (InventorySlots[SlotIndex].CanStack(Item))
+            {
+                return SlotIndex;
+            }
         }
     }
     return -1;
 }
 
-int32 UHSInventoryComponent::FindSlotWithSpace(UHSItemInstance* Item) const
+void UHSInventoryComponent::IndexSlot(int32 SlotIndex)
 {
-    for (int32 i = 0; i < InventorySlots.Num(); ++i)
+    const FHSInventorySlot& Slot = InventorySlots[SlotIndex];
+    if (Slot.bIsEmpty || !Slot.Item)
     {
-        if (InventorySlots[i].CanStack(Item))
-        {
-            return i;
-        }
+        SetSlotFreeBit(SlotIndex, true);
+        return;
+    }
+
+    SetSlotFreeBit(SlotIndex, false);
+
+    FIndexedSlotKey& IndexedKey = IndexedSlotKeys[SlotIndex];
+    IndexedKey.ItemID = Slot.Item->GetItemID();
+    IndexedKey.Quantity = Slot.Quantity;
+    IndexedKey.bPartialStack = Slot.Item->CanStack() && Slot.Quantity < Slot.MaxStackSize;
+
+    ItemQuantityByID.FindOrAdd(IndexedKey.ItemID) += IndexedKey.Quantity;
+    InsertSortedSlot(ItemSlotsByID.FindOrAdd(IndexedKey.ItemID), SlotIndex);
+
+    if (IndexedKey.bPartialStack)
+    {
+        InsertSortedSlot(PartialStacksByID.FindOrAdd(IndexedKey.ItemID), SlotIndex);
     }
-    return -1;
 }
 
-void UHSInventoryComponent::UpdateItemCache()
+void UHSInventoryComponent::UnindexSlot(int32 SlotIndex)
 {
-    ItemQuantityCache.Empty();
-    
-    for (const FHSInventorySlot& Slot : InventorySlots)
+    SetSlotFreeBit(SlotIndex, false);
+
+    // 현재 아이템 데이터가 아니라 인덱싱 당시 저장한 키로 제거
+    if (!IndexedSlotKeys.IsValidIndex(SlotIndex) || IndexedSlotKeys[SlotIndex].ItemID.IsNone())
     {
-        if (!Slot.bIsEmpty && Slot.Item)
+        return;
+    }
+
+    const FIndexedSlotKey IndexedKey = IndexedSlotKeys[SlotIndex];
+    IndexedSlotKeys[SlotIndex] = FIndexedSlotKey();
+
+    if (int32* TotalQuantity = ItemQuantityByID.Find(IndexedKey.ItemID))
+    {
+        *TotalQuantity -= IndexedKey.Quantity;
+        if (*TotalQuantity <= 0)
         {
-            int32& TotalQuantity = ItemQuantityCache.FindOrAdd(Slot.Item);
-            TotalQuantity += Slot.Quantity;
+            ItemQuantityByID.Remove(IndexedKey.ItemID);
         }
     }
+
+    RemoveSortedSlot(ItemSlotsByID, IndexedKey.ItemID, SlotIndex);
+    if (IndexedKey.bPartialStack)
+    {
+        RemoveSortedSlot(PartialStacksByID, IndexedKey.ItemID, SlotIndex);
+    }
 }
 
-void UHSInventoryComponent::UpdateEmptySlotCache()
+void UHSInventoryComponent::RebuildSlotIndex()
 {
-    EmptySlotCache.Empty();
-    
+    ItemQuantityByID.Reset();
+    ItemSlotsByID.Reset();
+    PartialStacksByID.Reset();
+    FreeSlotBits.Init(0, FMath::DivideAndRoundUp(InventorySlots.Num(), 64));
+    EmptySlotCount = 0;
+    IndexedSlotKeys.Reset();
+    IndexedSlotKeys.SetNum(InventorySlots.Num());
+
     for (int32 i = 0; i < InventorySlots.Num(); ++i)
     {
-        if (InventorySlots[i].bIsEmpty)
-        {
-            EmptySlotCache.Add(i);
-        }
+        IndexSlot(i);
+    }
+}
+
+void UHSInventoryComponent::SetSlotFreeBit(int32 SlotIndex, bool bFree)
+{
+    uint64& Word = FreeSlotBits[SlotIndex / 64];
+    const uint64 Mask = 1ull << (SlotIndex % 64);
+    const bool bWasFree = (Word & Mask) != 0;
+    if (bWasFree == bFree)
+    {
+        return;
+    }
+
+    if (bFree)
+    {
+        Word |= Mask;
+        ++EmptySlotCount;
+    }
+    else
+    {
+        Word &= ~Mask;
+        --EmptySlotCount;
     }
 }
 
@@ -703,12 +983,57 @@ void UHSInventoryComponent::BroadcastInventoryChanged(int32 SlotIndex, UHSItemIn
     
     if (GetOwner() && GetOwner()->HasAuthority())
     {
-        const FHSInventorySlot& Slot = InventorySlots[SlotIndex];
-        MulticastInventoryUpdate(SlotIndex, Item, Slot.Quantity);
-        SyncFastArrayState();
+        MarkSlotDirty(SlotIndex);
     }
 }
 
+void UHSInventoryComponent::MarkSlotDirty(int32 SlotIndex)
+{
+    bool bAlreadyPending = false;
+    PendingDirtySlots.Add(SlotIndex, &bAlreadyPending);
+    if (bAlreadyPending)
+    {
+        ++NetStats.CoalescedMutations;
+    }
+
+    if (bDirtyFlushScheduled)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        FlushDirtySlots();
+        return;
+    }
+
+    // 같은 프레임의 모든 변경을 다음 틱에 한 번에 반영
+    bDirtyFlushScheduled = true;
+    World->GetTimerManager().SetTimerForNextTick(this, &UHSInventoryComponent::FlushDirtySlots);
+}
+
+void UHSInventoryComponent::FlushDirtySlots()
+{
+    bDirtyFlushScheduled = false;
+
+    if (PendingDirtySlots.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<int32> ChangedSlots;
+    ReplicatedFastSlots.SyncDirtySlots(InventorySlots, PendingDirtySlots, /*bMarkDirty=*/true, ChangedSlots);
+
+    NetStats.SkippedUnchangedSlots += FMath::Max(0, PendingDirtySlots.Num() - ChangedSlots.Num());
+    PendingDirtySlots.Reset();
+
+    // 바뀐 슬롯은 FastArray 델타로만 전송
+    NetStats.LastOperationDirtySlots = ChangedSlots.Num();
+    NetStats.EstimatedLastOperationBytes = ChangedSlots.Num() * EstimatedBytesPerSlotDelta;
+    NetStats.EstimatedTotalBytes += NetStats.EstimatedLastOperationBytes;
+}
+
 void UHSInventoryComponent::OptimizeNetworkUpdates()
 {
     // 주기적으로 네트워크 최적화 수행
@@ -716,18 +1041,36 @@ void UHSInventoryComponent::OptimizeNetworkUpdates()
     if (CurrentTime - LastNetworkUpdate > NetworkUpdateInterval)
     {
         LastNetworkUpdate = CurrentTime;
-        // 필요시 추가 최적화 로직
+
+        // 초당 복제 바이트 갱신 (1초 구간)
+        const float SampleElapsed = CurrentTime - LastRateSampleTime;
+        if (SampleElapsed >= 1.0f)
+        {
+            NetStats.EstimatedBytesPerSecond = static_cast<float>(NetStats.EstimatedTotalBytes - BytesAtLastRateSample) / SampleElapsed;
+            BytesAtLastRateSample = NetStats.EstimatedTotalBytes;
+            LastRateSampleTime = CurrentTime;
+
+            if (NetStats.EstimatedBytesPerSecond > 0.0f)
+            {
+                UE_LOG(LogTemp, Verbose, TEXT("HSInventoryComponent::OptimizeNetworkUpdates - 추정 %.0f B/s, 마지막 작업 %d슬롯/추정 %d바이트, 병합 %d회"),
+                    NetStats.EstimatedBytesPerSecond, NetStats.LastOperationDirtySlots, NetStats.EstimatedLastOperationBytes, NetStats.CoalescedMutations);
+            }
+        }
     }
 }
 
 void UHSInventoryComponent::CacheFrequentlyUsedData()
 {
-    UpdateItemCache();
-    UpdateEmptySlotCache();
+    RebuildSlotIndex();
 }
 
 void UHSInventoryComponent::SyncFastArrayState()
 {
-    const bool bShouldMarkDirty = GetOwner() && GetOwner()->HasAuthority();
-    ReplicatedFastSlots.SyncFromLegacyArray(InventorySlots, bShouldMarkDirty);
+    // 클라이언트의 FastArray는 복제로만 갱신 (로컬 수정 시 복제 ID가 어긋남)
+    if (!GetOwner() || !GetOwner()->HasAuthority())
+    {
+        return;
+    }
+
+    ReplicatedFastSlots.SyncFromLegacyArray(InventorySlots, /*bMarkDirty=*/true);
 }
@@ -9,6 +9,8 @@
 #include "HSInventoryComponent.generated.h"
 
 class UHSItemInstance;
+class UHSInventoryComponent;
+struct FHSInventorySlotFastArray;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryChanged, int32, SlotIndex, UHSItemInstance*, Item);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnItemAdded, UHSItemInstance*, Item, int32, Quantity, int32, SlotIndex);
@@ -57,11 +59,14 @@ struct HUNTINGSPIRIT_API FHSInventorySlot
     bool CanStack(UHSItemInstance* InItem) const;
     bool HasSpace(int32 InQuantity) const;
     void Clear();
+
+    // 복제 관점에서 내용이 동일한지 비교 (변경 슬롯만 더티 처리하기 위함)
+    bool HasSameContents(const FHSInventorySlot& Other) const;
 };
 
 /**
- * FastArraySerializer 기반 슬롯 래퍼
- * TODO: FFastArraySerializer를 통한 슬롯 델타 복제로 전환 시 본 구조를 사용
+ * FastArraySerializer 기반 슬롯 항목
+ * 슬롯 단위 델타 복제 - 바뀐 슬롯만 전송됨
  */
 USTRUCT()
 struct FHSInventorySlotFastArrayItem : public FFastArraySerializerItem
@@ -78,8 +83,18 @@ struct FHSInventorySlotFastArrayItem : public FFastArraySerializerItem
         : SlotIndex(INDEX_NONE)
     {
     }
+
+    // FastArray 복제 콜백 (클라이언트에서 항목 단위로 호출)
+    void PreReplicatedRemove(const FHSInventorySlotFastArray& InArraySerializer);
+    void PostReplicatedAdd(const FHSInventorySlotFastArray& InArraySerializer);
+    void PostReplicatedChange(const FHSInventorySlotFastArray& InArraySerializer);
 };
 
+/**
+ * 인벤토리 슬롯 FastArray 래퍼
+ * 서버에서는 InventorySlots와 1:1로 동기화되고, 클라이언트에서는 콜백으로 InventorySlots를 재구성
+ */
+
 USTRUCT()
 struct FHSInventorySlotFastArray : public FFastArraySerializer
 {
@@ -88,12 +103,22 @@ struct FHSInventorySlotFastArray : public FFastArraySerializer
     UPROPERTY()
     TArray<FHSInventorySlotFastArrayItem> Items;
 
-    void SyncFromLegacyArray(const TArray<FHSInventorySlot>& SourceSlots, bool bMarkDirty);
+    // 복제 콜백을 받을 소유 컴포넌트 (복제 대상 아님)
+    UHSInventoryComponent* OwnerComponent = nullptr;
+
+    // 전체 슬롯을 비교해 내용이 바뀐 항목만 갱신, 변경된 항목 수 반환
+    int32 SyncFromLegacyArray(const TArray<FHSInventorySlot>& SourceSlots, bool bMarkDirty);
+
+    // 지정된 슬롯만 비교/갱신하고 실제로 바뀐 슬롯을 OutChangedSlots에 기록
+    int32 SyncDirtySlots(const TArray<FHSInventorySlot>& SourceSlots, const TSet<int32>& DirtySlots, bool bMarkDirty, TArray<int32>& OutChangedSlots);
 
     bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
     {
-        return FFastArraySerializer::FastArrayDeltaSerialize(Items, DeltaParms, *this);
+        return FFastArraySerializer::FastArrayDeltaSerialize<FHSInventorySlotFastArrayItem, FHSInventorySlotFastArray>(Items, DeltaParms, *this);
     }
+
+    // 한 번의 수신에서 모든 항목 콜백이 끝난 뒤 호출
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
 };
 
 template<>
@@ -105,6 +130,40 @@ struct TStructOpsTypeTraits<FHSInventorySlotFastArray> : public TStructOpsTypeTr
     };
 };
 
+/**
+ * 인벤토리 복제 통계
+ * 한 프레임 동안 누적된 변경을 하나의 더티 세트로 묶어 전송한 결과
+ */
+USTRUCT(BlueprintType)
+struct HUNTINGSPIRIT_API FHSInventoryNetStats
+{
+    GENERATED_BODY()
+
+    // 마지막 작업(정렬/일괄 이동 등)에서 실제로 복제된 슬롯 수
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory Network")
+    int32 LastOperationDirtySlots = 0;
+
+    // 마지막 작업의 복제 바이트 추정치 (슬롯당 고정 크기 x 슬롯 수, 실제 번들 크기 아님)
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory Network")
+    int32 EstimatedLastOperationBytes = 0;
+
+    // 같은 프레임 내 중복 변경이 병합되어 생략된 횟수
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory Network")
+    int32 CoalescedMutations = 0;
+
+    // 더티 표시되었으나 내용이 같아 전송하지 않은 슬롯 수
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory Network")
+    int32 SkippedUnchangedSlots = 0;
+
+    // 누적 복제 바이트 추정치
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory Network")
+    int64 EstimatedTotalBytes = 0;
+
+    // 최근 측정 구간의 초당 복제 바이트 추정치
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory Network")
+    float EstimatedBytesPerSecond = 0.0f;
+};
+
 /**
  * 인벤토리 필터 타입
  */
@@ -136,8 +195,8 @@ protected:
     virtual void BeginPlay() override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-    // 인벤토리 슬롯 배열 (네트워크 복제)
-    UPROPERTY(ReplicatedUsing = OnRep_InventorySlots, BlueprintReadOnly, Category = "Inventory")
+    // 인벤토리 슬롯 배열 (직접 복제하지 않음 - 클라이언트는 ReplicatedFastSlots 콜백으로 재구성)
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
     TArray<FHSInventorySlot> InventorySlots;
 
 public:
@@ -153,9 +212,28 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory Settings")
     bool bStackSimilarItems;
 
-    // 성능 최적화를 위한 캐시 (네트워크 복제 불필요)
-    TMap<TObjectPtr<UHSItemInstance>, int32> ItemQuantityCache;
-    TArray<int32> EmptySlotCache;
+    // 성능 최적화를 위한 슬롯 인덱스 (네트워크 복제 불필요)
+    // 아이템 ID별 총 수량 - GetItemQuantity/HasItem O(1) 조회
+    TMap<FName, int32> ItemQuantityByID;
+
+    // 아이템 ID별 점유 슬롯 (오름차순 정렬)
+    TMap<FName, TArray<int32>> ItemSlotsByID;
+
+    // 아이템 ID별 여유 공간이 남은 스택 슬롯 (오름차순 정렬)
+    TMap<FName, TArray<int32>> PartialStacksByID;
+
+    // 빈 슬롯 비트맵 (비트 1 = 빈 슬롯), 64슬롯 단위 워드 스캔
+    TArray<uint64> FreeSlotBits;
+    int32 EmptySlotCount;
+
+    // 슬롯별로 인덱스에 반영한 키와 수량 (아이템 데이터가 바뀌어도 반영했던 키로 정확히 제거)
+    struct FIndexedSlotKey
+    {
+        FName ItemID;
+        int32 Quantity = 0;
+        bool bPartialStack = false;
+    };
+    TArray<FIndexedSlotKey> IndexedSlotKeys;
 
     // 마지막 업데이트 시간 (네트워크 최적화)
     UPROPERTY()
@@ -229,6 +307,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void ResizeInventory(int32 NewSize);
 
+    // 복제 통계
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Inventory Network")
+    const FHSInventoryNetStats& GetNetworkStats() const { return NetStats; }
+
     // 네트워크 함수
     UFUNCTION(Server, Reliable, Category = "Inventory Network")
     void ServerAddItem(UHSItemInstance* Item, int32 Quantity);
@@ -239,24 +321,31 @@ public:
     UFUNCTION(Server, Reliable, Category = "Inventory Network")
     void ServerMoveItem(int32 FromSlot, int32 ToSlot);
 
-    UFUNCTION(NetMulticast, Reliable, Category = "Inventory Network")
-    void MulticastInventoryUpdate(int32 SlotIndex, UHSItemInstance* Item, int32 Quantity);
-
 protected:
-    // 네트워크 복제 콜백
-    UFUNCTION()
-    void OnRep_InventorySlots();
+    // FastArray 복제 콜백 (클라이언트)
+    friend struct FHSInventorySlotFastArrayItem;
+    friend struct FHSInventorySlotFastArray;
+    void HandleReplicatedSlot(const FHSInventorySlotFastArrayItem& ReplicatedItem, bool bRemoved);
+    void HandleReplicatedSlotsReceived();
 
     // 내부 헬퍼 함수
-    int32 FindEmptySlot();
+    int32 FindEmptySlot() const;
     int32 FindSlotWithItem(UHSItemInstance* Item) const;
     int32 FindSlotWithSpace(UHSItemInstance* Item) const;
-    void UpdateItemCache();
-    void UpdateEmptySlotCache();
+
+    // 슬롯 인덱스 관리 - 슬롯 변경 전 UnindexSlot, 변경 후 IndexSlot 호출
+    void IndexSlot(int32 SlotIndex);
+    void UnindexSlot(int32 SlotIndex);
+    void RebuildSlotIndex();
+    void SetSlotFreeBit(int32 SlotIndex, bool bFree);
     bool IsValidSlotIndex(int32 SlotIndex) const;
     void BroadcastInventoryChanged(int32 SlotIndex, UHSItemInstance* Item);
     void SyncFastArrayState();
 
+    // 프레임 단위 더티 슬롯 병합 - 다음 틱에 한 번만 FastArray 반영
+    void MarkSlotDirty(int32 SlotIndex);
+    void FlushDirtySlots();
+
     // 성능 최적화 함수
     void OptimizeNetworkUpdates();
     void CacheFrequentlyUsedData();
@@ -265,7 +354,24 @@ private:
     // 네트워크 최적화를 위한 변수
     static constexpr float NetworkUpdateInterval = 0.1f;
 
-    // FFastArraySerializer 전환 준비용 내부 상태
-    UPROPERTY()
+    // 슬롯 하나의 FastArray 델타 크기 추정치 (항목 ID/키 + 슬롯 필드, 번들 헤더 제외)
+    // 측정값이 아니므로 실제 대역폭은 net.* 프로파일러/Network Insights로 확인
+    static constexpr int32 EstimatedBytesPerSlotDelta = 24;
+
+    // 다음 플러시까지 누적된 더티 슬롯
+    TSet<int32> PendingDirtySlots;
+    bool bDirtyFlushScheduled = false;
+
+    // 복제 통계 및 초당 바이트 측정 구간
+    FHSInventoryNetStats NetStats;
+    int64 BytesAtLastRateSample = 0;
+    float LastRateSampleTime = 0.0f;
+
+    // 슬롯 델타 복제 (소유 클라이언트 전용)
+    UPROPERTY(Replicated)
     FHSInventorySlotFastArray ReplicatedFastSlots;
+
+    // 클라이언트에서 이번 수신으로 바뀐 슬롯 (수신 완료 시 한 번에 인덱스 갱신/통지)
+    TArray<int32> ReplicatedChangedSlots;
+    bool bReplicatedLayoutChanged = false;
 };
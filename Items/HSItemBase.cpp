@@ -45,6 +45,18 @@ bool UHSItemInstance::CanStack() const
     return ItemData.bCanStack && ItemData.StackSize > 1;
 }
 
+FName UHSItemInstance::GetItemID() const
+{
+    if (!ItemData.ItemID.IsNone())
+    {
+        return ItemData.ItemID;
+    }
+
+    // ID 미지정 아이템은 객체 고유 번호로 구분 (이름 테이블 조회 없이 번호만 붙임)
+    static const FName UnidentifiedItemBaseName(TEXT("UnidentifiedItem"));
+    return FName(UnidentifiedItemBaseName, static_cast<int32>(GetUniqueID()) + 1);
+}
+
 // 생성자
 AHSItemBase::AHSItemBase()
 {
@@ -38,6 +38,10 @@ struct FHSItemData : public FTableRowBase
 {
     GENERATED_BODY()
 
+    // 표시 이름과 무관한 고정 식별자 (비어 있으면 데이터 테이블 행 이름으로 채움)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName ItemID;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString ItemName;
 
@@ -81,6 +85,14 @@ struct FHSItemData : public FTableRowBase
         ItemMesh = nullptr;
         bCanStack = false;
     }
+
+    virtual void OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName) override
+    {
+        if (ItemID.IsNone())
+        {
+            ItemID = InRowName;
+        }
+    }
 };
 
 // 인벤토리/제작 시스템 호환을 위한 UObject 기반 아이템 인스턴스 클래스
@@ -124,6 +136,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "Item")
     bool CanStack() const;
 
+    // 인벤토리 인덱싱용 아이템 식별자 (동일 ID끼리 수량 집계/스택)
+    // ItemData.ItemID를 그대로 사용하며, ID가 없는 아이템은 인스턴스마다 고유한 키를 받아 다른 아이템과 합쳐지지 않음
+    // (표시 이름은 대소문자 구분이 없는 FName 키로 쓰면 "Wood"/"wood"가 합쳐지므로 사용하지 않음)
+    UFUNCTION(BlueprintPure, Category = "Item")
+    FName GetItemID() const;
+
     // 아이템 설정
     UFUNCTION(BlueprintCallable, Category = "Item")
     void SetItemData(const FHSItemData& NewData) { ItemData = NewData; }
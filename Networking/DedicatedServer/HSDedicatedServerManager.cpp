@@ -1,4 +1,5 @@
 #include "HSDedicatedServerManager.h"
+#include "HuntingSpirit/Optimization/HSGarbageCollectionManager.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "Engine/NetDriver.h"
@@ -1112,12 +1113,14 @@ void UHSDedicatedServerManager::ProcessAutoPerformanceOptimization()
     // 메모리 사용률이 높을 때 가비지 컬렉션
     if (CurrentMetrics.MemoryUsageMB > 3072.0f) // 3GB 초과
     {
-        UE_LOG(LogTemp, Warning, TEXT("HSDedicatedServerManager: 높은 메모리 사용률 감지 (%.1fMB), 가비지 컬렉션 수행"), 
+        UE_LOG(LogTemp, Warning, TEXT("HSDedicatedServerManager: 높은 메모리 사용률 감지 (%.1fMB), 가비지 컬렉션 요청"), 
                CurrentMetrics.MemoryUsageMB);
         
-        if (GEngine)
+        // 긴급 요청: 전투 중이면 짧게 미루고, 시작 후에는 프레임 예산 안에서 점진 수행
+        UHSGarbageCollectionManager* GCManager = GetWorld() ? GetWorld()->GetSubsystem<UHSGarbageCollectionManager>() : nullptr;
+        if (GCManager)
         {
-            GEngine->ForceGarbageCollection(true);
+            GCManager->RequestCollection(true, TEXT("HSDedicatedServerManager 메모리 사용량"));
         }
     }
 }
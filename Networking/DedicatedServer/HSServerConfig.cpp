@@ -353,6 +353,17 @@ bool UHSServerConfig::ValidatePerformanceConfig(const FHSPerformanceConfig& Conf
         return false;
     }
     
+    // 중요도 등급 경계는 오름차순이어야 함
+    if (Config.SignificanceUpdateInterval <= 0.0f ||
+        Config.SignificanceHighDistance <= 0.0f ||
+        Config.SignificanceMediumDistance < Config.SignificanceHighDistance ||
+        Config.SignificanceLowDistance < Config.SignificanceMediumDistance ||
+        Config.SignificanceHysteresis < 0.0f ||
+        Config.MaxHighSignificanceActors < 0)
+    {
+        return false;
+    }
+    
     return true;
 }
 
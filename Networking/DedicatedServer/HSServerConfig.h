@@ -121,6 +121,85 @@ struct FHSPerformanceConfig
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     float SessionCleanupInterval = 300.0f;
 
+    // 중요도 기반 틱 관리
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    bool bEnableSignificanceTicking = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float SignificanceUpdateInterval = 0.25f;
+
+    // 가장 가까운 플레이어까지의 거리 기준 등급 경계 (High/Medium/Low, 그 이상은 Dormant)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float SignificanceHighDistance = 2500.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float SignificanceMediumDistance = 6000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float SignificanceLowDistance = 12000.0f;
+
+    // 등급 하향 시 경계에 더하는 비율 (경계 부근에서의 잦은 전환 방지)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float SignificanceHysteresis = 0.15f;
+
+    // High 등급 최대 액터 수 (초과분은 Medium으로 하향, 0이면 제한 없음)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    int32 MaxHighSignificanceActors = 48;
+
+    // 등급별 액터 틱 간격 (High는 액터 기본값 유지)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float MediumTickInterval = 0.1f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float LowTickInterval = 0.25f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float DormantTickInterval = 1.0f;
+
+    // 등급별 애니메이션(스켈레탈 메시) 업데이트 간격
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float MediumAnimationInterval = 0.05f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float LowAnimationInterval = 0.15f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float DormantAnimationInterval = 0.5f;
+
+    // 등급별 감지 간격 (Dormant 등급은 AI 시야 감지를 끔)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float MediumPerceptionInterval = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float LowPerceptionInterval = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float DormantPerceptionInterval = 2.0f;
+
+    // 절감 시간 추정에 쓰는 액터 틱 1회 평균 비용 (ms, 가정값 - 프로파일 결과에 맞춰 조정)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Significance")
+    float EstimatedTickCostMs = 0.02f;
+
+    // 가비지 컬렉션 정책 (점진 수집의 프레임당 시간 예산, ms)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|GarbageCollection")
+    float GCFrameBudgetMs = 2.0f;
+
+    // 전투 중 수집을 미룰 수 있는 최대 시간 (초, 초과하면 전투 중에도 수집)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|GarbageCollection")
+    float GCMaxCombatDeferral = 180.0f;
+
+    // 메모리 부족 등 긴급 요청을 미룰 수 있는 최대 시간 (초)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|GarbageCollection")
+    float GCUrgentMaxDeferral = 15.0f;
+
+    // 비전투 중 자연스러운 휴지 구간(웨이브 사이, 페이즈 전환)을 기다리는 최대 시간 (초)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|GarbageCollection")
+    float GCNaturalPauseWait = 20.0f;
+
+    // 휴지 구간 알림 후 수집 시작을 허용하는 시간 창 (초)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|GarbageCollection")
+    float GCNaturalPauseWindow = 3.0f;
+
     FHSPerformanceConfig()
     {
         MaxCPUUsage = 80.0f;
@@ -133,6 +212,28 @@ struct FHSPerformanceConfig
         CullingDistance = 5000.0f;
         MaxConcurrentSessions = 50;
         SessionCleanupInterval = 300.0f;
+        bEnableSignificanceTicking = true;
+        SignificanceUpdateInterval = 0.25f;
+        SignificanceHighDistance = 2500.0f;
+        SignificanceMediumDistance = 6000.0f;
+        SignificanceLowDistance = 12000.0f;
+        SignificanceHysteresis = 0.15f;
+        MaxHighSignificanceActors = 48;
+        MediumTickInterval = 0.1f;
+        LowTickInterval = 0.25f;
+        DormantTickInterval = 1.0f;
+        MediumAnimationInterval = 0.05f;
+        LowAnimationInterval = 0.15f;
+        DormantAnimationInterval = 0.5f;
+        MediumPerceptionInterval = 0.5f;
+        LowPerceptionInterval = 1.0f;
+        DormantPerceptionInterval = 2.0f;
+        EstimatedTickCostMs = 0.02f;
+        GCFrameBudgetMs = 2.0f;
+        GCMaxCombatDeferral = 180.0f;
+        GCUrgentMaxDeferral = 15.0f;
+        GCNaturalPauseWait = 20.0f;
+        GCNaturalPauseWindow = 3.0f;
     }
 };
 
@@ -3,6 +3,7 @@
 
 #include "HSReplicationComponent.h"
 #include "HuntingSpirit/Characters/Base/HSCharacterBase.h"
+#include "HuntingSpirit/Optimization/HSThrottledTaskScheduler.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "TimerManager.h"
@@ -43,7 +44,10 @@ UHSReplicationComponent::UHSReplicationComponent()
 
     // 런타임 변수 초기화
     NextPacketID = 1;
-    LastStatsUpdateTime = 0.0f;
+    LastBandwidthSampleBytes = 0;
+    LastBandwidthSampleTime = 0.0f;
+    LastRateSamplePackets = 0;
+    LastRateSampleTime = 0.0f;
     LastPriorityUpdateTime = 0.0f;
     bInitialized = false;
 
@@ -123,13 +127,6 @@ void UHSReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType
             AdjustQualityBasedOnBandwidth();
         }
 
-        // 실시간 통계 업데이트
-        float CurrentTime = GetWorld()->GetTimeSeconds();
-        if (CurrentTime - LastStatsUpdateTime >= StatsUpdateInterval)
-        {
-            UpdateStatistics();
-            LastStatsUpdateTime = CurrentTime;
-        }
     }
 }
 
@@ -140,10 +137,14 @@ void UHSReplicationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     if (UWorld* World = GetWorld())
     {
         FTimerManager& TimerManager = World->GetTimerManager();
-        TimerManager.ClearTimer(StatsUpdateTimer);
         TimerManager.ClearTimer(BatchProcessTimer);
         TimerManager.ClearTimer(PriorityUpdateTimer);
         TimerManager.ClearTimer(QualityAdjustmentTimer);
+
+        if (UHSThrottledTaskScheduler* Scheduler = World->GetSubsystem<UHSThrottledTaskScheduler>())
+        {
+            Scheduler->UnregisterAllTasks(this);
+        }
     }
 
     // 남은 패킷 처리
@@ -636,10 +637,14 @@ void UHSReplicationComponent::SetupTimers()
 {
     FTimerManager& TimerManager = GetWorld()->GetTimerManager();
 
-    // 통계 업데이트 타이머
-    TimerManager.SetTimer(StatsUpdateTimer, this, 
-                        &UHSReplicationComponent::UpdateStatistics, 
-                        StatsUpdateInterval, true);
+    // 통계 업데이트 (복제 액터 간 위상 분산)
+    if (UHSThrottledTaskScheduler* Scheduler = GetWorld()->GetSubsystem<UHSThrottledTaskScheduler>())
+    {
+        Scheduler->RegisterTask(this, StatsUpdateInterval, FHSThrottledTaskDelegate::CreateWeakLambda(this, [this](float)
+        {
+            UpdateStatistics();
+        }));
+    }
 
     // 배치 처리 타이머
     if (bBatchProcessingEnabled)
@@ -799,33 +804,27 @@ void UHSReplicationComponent::UpdateStatistics()
         }
     }
 
-    // 대역폭 사용률 계산
-    static int64 LastTotalBytes = 0;
-    static float LastUpdateTime = 0.0f;
-    
+    // 대역폭 사용률 계산 (인스턴스별 샘플 기준)
     float CurrentTime = GetWorld()->GetTimeSeconds();
-    float TimeDelta = CurrentTime - LastUpdateTime;
+    float TimeDelta = CurrentTime - LastBandwidthSampleTime;
     
     if (TimeDelta > 0.0f)
     {
-        int64 BytesDelta = ReplicationStats.TotalBytesSent - LastTotalBytes;
+        int64 BytesDelta = ReplicationStats.TotalBytesSent - LastBandwidthSampleBytes;
         ReplicationStats.BandwidthUsage = (BytesDelta / TimeDelta) / 1024.0f; // KB/s
         
-        LastTotalBytes = ReplicationStats.TotalBytesSent;
-        LastUpdateTime = CurrentTime;
+        LastBandwidthSampleBytes = ReplicationStats.TotalBytesSent;
+        LastBandwidthSampleTime = CurrentTime;
     }
 
     // 복제 빈도 계산
-    static int32 LastPacketCount = 0;
-    static float LastRateUpdate = 0.0f;
-    
-    if (CurrentTime - LastRateUpdate >= 1.0f) // 1초마다 업데이트
+    if (CurrentTime - LastRateSampleTime >= 1.0f) // 1초마다 업데이트
     {
-        int32 PacketDelta = ReplicationStats.PacketsSent - LastPacketCount;
+        int32 PacketDelta = ReplicationStats.PacketsSent - LastRateSamplePackets;
         ReplicationStats.ReplicationRate = PacketDelta;
         
-        LastPacketCount = ReplicationStats.PacketsSent;
-        LastRateUpdate = CurrentTime;
+        LastRateSamplePackets = ReplicationStats.PacketsSent;
+        LastRateSampleTime = CurrentTime;
     }
 
     // 이벤트 브로드캐스트
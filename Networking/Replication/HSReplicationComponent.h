@@ -565,17 +565,19 @@ protected:
     // 다음 패킷 ID
     int32 NextPacketID;
 
-    // 마지막 통계 업데이트 시간
-    float LastStatsUpdateTime;
+    // 대역폭 통계 샘플 (인스턴스별)
+    int64 LastBandwidthSampleBytes;
+    float LastBandwidthSampleTime;
+
+    // 복제 빈도 통계 샘플 (인스턴스별)
+    int32 LastRateSamplePackets;
+    float LastRateSampleTime;
 
     // 마지막 우선순위 업데이트 시간
     float LastPriorityUpdateTime;
 
     // === 타이머 핸들들 ===
 
-    // 통계 업데이트 타이머
-    FTimerHandle StatsUpdateTimer;
-
     // 배치 처리 타이머
     FTimerHandle BatchProcessTimer;
 
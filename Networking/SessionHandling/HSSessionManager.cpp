@@ -36,6 +36,7 @@ UHSSessionManager::UHSSessionManager()
     MaxReconnectRetries = 3;
     SessionHeartbeatInterval = 30.0f; // 30초마다
     ConnectionTimeout = 60.0f; // 60초 타임아웃
+    SearchResultCacheTTL = 15.0f; // 15초 동안 같은 필터 결과 재사용
 
     // 런타임 변수 초기화
     OnlineSubsystem = nullptr;
@@ -48,6 +49,11 @@ UHSSessionManager::UHSSessionManager()
     PendingReconnectSessionName.Empty();
     PendingReconnectSessionId.Empty();
     LastSearchResultsTimestamp = FDateTime::MinValue();
+    LastSearchFilterKey = 0;
+    ActiveSearchFilterKey = 0;
+    SearchResultIndicesByPingBucket.SetNum(PingBucketCount);
+    SearchCacheHitCount = 0;
+    ReusedSearchResultCount = 0;
 }
 
 // 초기화
@@ -262,6 +268,30 @@ bool UHSSessionManager::EndSession()
 
 // 세션 검색
 bool UHSSessionManager::SearchSessions(const FHSSessionSearchFilter& SearchFilter)
+{
+    return StartSessionSearch(SearchFilter, true);
+}
+
+// 마지막 필터로 재검색
+bool UHSSessionManager::RefreshSearchResults()
+{
+    if (LastSearchFilterKey == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 갱신할 이전 검색 결과가 없습니다"));
+        return false;
+    }
+
+    return StartSessionSearch(LastSearchFilter, false);
+}
+
+// 검색 캐시 무효화
+void UHSSessionManager::InvalidateSearchCache()
+{
+    LastSearchFilterKey = 0;
+}
+
+// 필터로 세션 검색 시작
+bool UHSSessionManager::StartSessionSearch(const FHSSessionSearchFilter& SearchFilter, bool bAllowCachedResults)
 {
     if (!SessionInterface.IsValid())
     {
@@ -275,7 +305,23 @@ bool UHSSessionManager::SearchSessions(const FHSSessionSearchFilter& SearchFilte
         return false;
     }
 
+    const uint32 FilterKey = GetSearchFilterKey(SearchFilter);
+
+    // 같은 필터의 최근 결과가 유효하면 온라인 검색 없이 바로 완료 처리
+    if (bAllowCachedResults && FilterKey == LastSearchFilterKey && SearchResultCacheTTL > 0.0f &&
+        (FDateTime::UtcNow() - LastSearchResultsTimestamp).GetTotalSeconds() <= SearchResultCacheTTL)
+    {
+        ++SearchCacheHitCount;
+        UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 캐시된 세션 검색 결과 사용 - %d개"), LastSearchResults.Num());
+
+        OnSessionSearchCompleted.Broadcast(true, LastSearchResults);
+        ProcessPendingSearchRequests();
+        return true;
+    }
+
     ChangeSessionState(EHSSessionState::SS_Searching);
+    ActiveSearchFilter = SearchFilter;
+    ActiveSearchFilterKey = FilterKey;
 
     // 세션 검색 설정 생성
     CurrentSessionSearch = MakeShareable(new FOnlineSessionSearch());
@@ -344,8 +390,12 @@ bool UHSSessionManager::JoinSession(const FHSSessionInfo& SessionInfo)
         return false;
     }
 
-    // 현재 세션 정보 업데이트
+    // 현재 세션 정보 업데이트 (검색 결과의 세션 설정은 여기서 처음 변환)
     CurrentSessionInfo = SessionInfo;
+    if (CurrentSessionInfo.SessionSettings.Num() == 0)
+    {
+        ExtractSessionSettings(*SessionInfo.SearchResult, CurrentSessionInfo.SessionSettings);
+    }
     bIsSessionHost = false;
 
     UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 세션 참여 시작 - %s"), *SessionInfo.SessionName);
@@ -367,20 +417,56 @@ bool UHSSessionManager::JoinSessionByIndex(int32 SessionIndex)
 // 빠른 매칭
 bool UHSSessionManager::QuickMatch(const FHSSessionSearchFilter& SearchFilter)
 {
-    if (!SearchSessions(SearchFilter))
+    if (CurrentSessionState == EHSSessionState::SS_Searching)
     {
+        UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 이미 검색 중입니다"));
         return false;
     }
 
+    // 캐시된 결과로 검색이 바로 완료될 수 있으므로 대기 상태를 먼저 설정
     PendingQuickMatchFilter = SearchFilter;
     bPendingQuickMatchJoin = true;
 
+    if (!SearchSessions(SearchFilter))
+    {
+        bPendingQuickMatchJoin = false;
+        return false;
+    }
+
     UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 빠른 매칭 시작"));
     return true;
 }
 
 // === 세션 정보 조회 ===
 
+// 검색 결과 세션 설정 가져오기
+TMap<FString, FString> UHSSessionManager::GetSearchResultSettings(int32 SessionIndex) const
+{
+    TMap<FString, FString> Settings;
+
+    if (LastSearchResults.IsValidIndex(SessionIndex))
+    {
+        const FHSSessionInfo& SessionInfo = LastSearchResults[SessionIndex];
+        if (SessionInfo.SessionSettings.Num() > 0)
+        {
+            Settings = SessionInfo.SessionSettings;
+        }
+        else if (SessionInfo.SearchResult.IsValid())
+        {
+            ExtractSessionSettings(*SessionInfo.SearchResult, Settings);
+        }
+    }
+
+    return Settings;
+}
+
+// 세션 ID로 검색 결과 인덱스 찾기
+int32 UHSSessionManager::FindSearchResultIndexBySessionId(const FString& SessionId) const
+{
+    const int32* ResultIndex = SearchResultIndexBySessionId.Find(SessionId);
+    return ResultIndex ? *ResultIndex : INDEX_NONE;
+}
+
 // 세션 플레이어 수 가져오기
 int32 UHSSessionManager::GetSessionPlayerCount() const
 {
@@ -726,12 +812,14 @@ void UHSSessionManager::SetAutoReconnect(bool bEnable, int32 MaxRetries)
 // 세션 매니저 상태 문자열 가져오기
 FString UHSSessionManager::GetSessionManagerStatusString() const
 {
-    return FString::Printf(TEXT("State: %d | Host: %s | Players: %d | Reconnects: %d/%d"),
+    return FString::Printf(TEXT("State: %d | Host: %s | Players: %d | Reconnects: %d/%d | SearchCache: %d hits, %d reused"),
         (int32)CurrentSessionState,
         bIsSessionHost ? TEXT("Yes") : TEXT("No"),
         GetSessionPlayerCount(),
         CurrentReconnectAttempts,
-        MaxReconnectRetries
+        MaxReconnectRetries,
+        SearchCacheHitCount,
+        ReusedSearchResultCount
     );
 }
 
@@ -883,14 +971,8 @@ FHSSessionInfo UHSSessionManager::ConvertFromSearchResult(const FOnlineSessionSe
     FHSSessionInfo SessionInfo;
     
     // 기본 정보 설정
-    int32 MaxConnections = SearchResult.Session.SessionSettings.NumPublicConnections + SearchResult.Session.SessionSettings.NumPrivateConnections;
-    // UE5에서는 세션 설정에서 사용 중인 연결 수를 계산
-    int32 UsedConnections = MaxConnections - (SearchResult.Session.NumOpenPublicConnections + SearchResult.Session.NumOpenPrivateConnections);
-    SessionInfo.CurrentPlayers = FMath::Max(0, UsedConnections);
-    SessionInfo.MaxPlayers = MaxConnections;
-    SessionInfo.Ping = SearchResult.PingInMs;
-    TSharedPtr<FOnlineSessionSearchResult> SearchResultCopy = MakeShared<FOnlineSessionSearchResult>(SearchResult);
-    SessionInfo.SearchResult = SearchResultCopy;
+    UpdateSessionAvailability(SessionInfo, SearchResult);
+    SessionInfo.SessionId = GetSearchResultSessionId(SearchResult);
 
     // 세션 설정에서 정보 추출
     FString SessionName, MapName, GameMode;
@@ -931,15 +1013,240 @@ FHSSessionInfo UHSSessionManager::ConvertFromSearchResult(const FOnlineSessionSe
         SessionInfo.HostName = HostName;
     }
 
-    // 세션 설정 저장
+    // 전체 세션 설정은 참여하거나 요청할 때만 변환 (ExtractSessionSettings)
+    return SessionInfo;
+}
+
+// 인원/핑 갱신
+void UHSSessionManager::UpdateSessionAvailability(FHSSessionInfo& SessionInfo, const FOnlineSessionSearchResult& SearchResult)
+{
+    const int32 MaxConnections = SearchResult.Session.SessionSettings.NumPublicConnections + SearchResult.Session.SessionSettings.NumPrivateConnections;
+    // UE5에서는 세션 설정에서 사용 중인 연결 수를 계산
+    const int32 UsedConnections = MaxConnections - (SearchResult.Session.NumOpenPublicConnections + SearchResult.Session.NumOpenPrivateConnections);
+    SessionInfo.CurrentPlayers = FMath::Max(0, UsedConnections);
+    SessionInfo.MaxPlayers = MaxConnections;
+    SessionInfo.Ping = SearchResult.PingInMs;
+}
+
+// 세션 설정 변환
+void UHSSessionManager::ExtractSessionSettings(const FOnlineSessionSearchResult& SearchResult, TMap<FString, FString>& OutSettings)
+{
+    OutSettings.Reserve(SearchResult.Session.SessionSettings.Settings.Num());
+
     for (const auto& Setting : SearchResult.Session.SessionSettings.Settings)
     {
         FString Value;
         Setting.Value.Data.GetValue(Value);
-        SessionInfo.SessionSettings.Add(Setting.Key.ToString(), Value);
+        OutSettings.Add(Setting.Key.ToString(), Value);
     }
+}
 
-    return SessionInfo;
+// 세션 식별자 가져오기
+FString UHSSessionManager::GetSearchResultSessionId(const FOnlineSessionSearchResult& SearchResult)
+{
+    FString SessionId;
+    if (SearchResult.Session.SessionSettings.Get(TEXT("SESSION_ID"), SessionId) && !SessionId.IsEmpty())
+    {
+        return SessionId;
+    }
+
+    return SearchResult.Session.SessionInfo.IsValid() ? SearchResult.GetSessionIdStr() : FString();
+}
+
+// 검색 필터 캐시 키
+uint32 UHSSessionManager::GetSearchFilterKey(const FHSSessionSearchFilter& Filter)
+{
+    // MaxPing은 결과 선택 시 로컬에서 적용하므로 키에서 제외
+    uint32 FilterKey = GetTypeHash(Filter.MaxSearchResults);
+    FilterKey = HashCombine(FilterKey, GetTypeHash(Filter.bSearchLAN));
+    FilterKey = HashCombine(FilterKey, GetTypeHash(Filter.bPublicOnly));
+    FilterKey = HashCombine(FilterKey, GetTypeHash(Filter.bNonEmptyOnly));
+    FilterKey = HashCombine(FilterKey, GetTypeHash(Filter.bExcludeFullSessions));
+    FilterKey = HashCombine(FilterKey, GetTypeHash(Filter.GameMode));
+    FilterKey = HashCombine(FilterKey, GetTypeHash(Filter.MapName));
+
+    // 커스텀 필터는 순서와 무관하도록 항목 해시를 더함
+    uint32 CustomFilterHash = 0;
+    for (const auto& CustomFilter : Filter.CustomFilters)
+    {
+        CustomFilterHash += HashCombine(GetTypeHash(CustomFilter.Key), GetTypeHash(CustomFilter.Value));
+    }
+    FilterKey = HashCombine(FilterKey, CustomFilterHash);
+
+    // 0은 캐시 없음을 뜻하므로 피함
+    return FilterKey != 0 ? FilterKey : 1;
+}
+
+// 검색 결과 반영
+void UHSSessionManager::ApplySearchResults(const TSharedRef<FOnlineSessionSearch>& SessionSearch)
+{
+    TArray<FHSSessionInfo> MergedResults;
+    MergedResults.Reserve(SessionSearch->SearchResults.Num());
+    int32 ReusedCount = 0;
+
+    for (const FOnlineSessionSearchResult& SearchResult : SessionSearch->SearchResults)
+    {
+        const FString SessionId = GetSearchResultSessionId(SearchResult);
+
+        // 이미 아는 세션은 이름/맵/호스트 등 변환 결과를 재사용하고 인원/핑만 갱신
+        int32 PreviousIndex = INDEX_NONE;
+        if (!SessionId.IsEmpty() && SearchResultIndexBySessionId.RemoveAndCopyValue(SessionId, PreviousIndex))
+        {
+            FHSSessionInfo& SessionInfo = MergedResults.Add_GetRef(MoveTemp(LastSearchResults[PreviousIndex]));
+            UpdateSessionAvailability(SessionInfo, SearchResult);
+            ++ReusedCount;
+        }
+        else
+        {
+            MergedResults.Add(ConvertFromSearchResult(SearchResult));
+        }
+
+        // 검색 객체와 참조 카운트를 공유해 검색 결과를 복사하지 않음
+        MergedResults.Last().SearchResult = TSharedPtr<const FOnlineSessionSearchResult>(SessionSearch, &SearchResult);
+    }
+
+    LastSearchResults = MoveTemp(MergedResults);
+    LastSearchResultsTimestamp = FDateTime::UtcNow();
+    ReusedSearchResultCount += ReusedCount;
+
+    RebuildSearchResultIndices();
+
+    UE_LOG(LogTemp, Verbose, TEXT("HSSessionManager: 검색 결과 반영 - %d개 (재사용 %d개)"), LastSearchResults.Num(), ReusedCount);
+}
+
+// 검색 결과 색인 재구성
+void UHSSessionManager::RebuildSearchResultIndices()
+{
+    SearchResultIndexBySessionId.Reset();
+    SearchResultIndexBySessionName.Reset();
+    for (TArray<int32>& PingBucket : SearchResultIndicesByPingBucket)
+    {
+        PingBucket.Reset();
+    }
+
+    SearchResultIndexBySessionId.Reserve(LastSearchResults.Num());
+    SearchResultIndexBySessionName.Reserve(LastSearchResults.Num());
+
+    for (int32 ResultIndex = 0; ResultIndex < LastSearchResults.Num(); ++ResultIndex)
+    {
+        const FHSSessionInfo& SessionInfo = LastSearchResults[ResultIndex];
+
+        if (!SessionInfo.SessionId.IsEmpty())
+        {
+            SearchResultIndexBySessionId.Add(SessionInfo.SessionId, ResultIndex);
+        }
+
+        // 이름이 같은 세션은 먼저 나온 결과를 사용 (FString 키는 대소문자 구분 없음)
+        if (!SearchResultIndexBySessionName.Contains(SessionInfo.SessionName))
+        {
+            SearchResultIndexBySessionName.Add(SessionInfo.SessionName, ResultIndex);
+        }
+
+        const int32 BucketIndex = FMath::Clamp(SessionInfo.Ping / PingBucketSizeMs, 0, PingBucketCount - 1);
+        SearchResultIndicesByPingBucket[BucketIndex].Add(ResultIndex);
+    }
+}
+
+// 빠른 매칭/재연결 대기 요청 처리
+bool UHSSessionManager::ProcessPendingSearchRequests()
+{
+    if (bPendingQuickMatchJoin)
+    {
+        bPendingQuickMatchJoin = false;
+
+        if (const FHSSessionInfo* BestSession = FindQuickMatchCandidate(PendingQuickMatchFilter.MaxPing))
+        {
+            UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 빠른 매칭 대상 세션 선택 - %s (핑: %d)"), *BestSession->SessionName, BestSession->Ping);
+            JoinSession(*BestSession);
+            return true;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 빠른 매칭 조건에 맞는 세션이 없습니다"));
+    }
+
+    if (bReconnectSearchPending)
+    {
+        if (const FHSSessionInfo* TargetSession = FindReconnectCandidate())
+        {
+            UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 재연결 대상 세션 발견 - %s"), *TargetSession->SessionName);
+            bReconnectSearchPending = false;
+            JoinSession(*TargetSession);
+            return true;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 재연결 대상 세션을 찾지 못했습니다"));
+    }
+
+    return false;
+}
+
+// 빠른 매칭 대상 찾기
+const FHSSessionInfo* UHSSessionManager::FindQuickMatchCandidate(int32 MaxPing) const
+{
+    // 핑 구간을 낮은 순서로 보고, 참여 가능한 세션이 있는 첫 구간에서 가장 낮은 핑을 선택
+    for (int32 BucketIndex = 0; BucketIndex < SearchResultIndicesByPingBucket.Num(); ++BucketIndex)
+    {
+        if (MaxPing > 0 && BucketIndex * PingBucketSizeMs > MaxPing)
+        {
+            break;
+        }
+
+        const FHSSessionInfo* BestSession = nullptr;
+        for (const int32 ResultIndex : SearchResultIndicesByPingBucket[BucketIndex])
+        {
+            const FHSSessionInfo& SessionInfo = LastSearchResults[ResultIndex];
+
+            if (!SessionInfo.SearchResult.IsValid())
+            {
+                continue;
+            }
+
+            if (SessionInfo.MaxPlayers > 0 && SessionInfo.CurrentPlayers >= SessionInfo.MaxPlayers)
+            {
+                continue;
+            }
+
+            if (MaxPing > 0 && SessionInfo.Ping > MaxPing)
+            {
+                continue;
+            }
+
+            if (!BestSession || SessionInfo.Ping < BestSession->Ping)
+            {
+                BestSession = &SessionInfo;
+            }
+        }
+
+        if (BestSession)
+        {
+            return BestSession;
+        }
+    }
+
+    return nullptr;
+}
+
+// 재연결 대상 찾기
+const FHSSessionInfo* UHSSessionManager::FindReconnectCandidate() const
+{
+    const int32* ResultIndex = nullptr;
+
+    if (!PendingReconnectSessionId.IsEmpty())
+    {
+        ResultIndex = SearchResultIndexBySessionId.Find(PendingReconnectSessionId);
+    }
+
+    if (!ResultIndex && !PendingReconnectSessionName.IsEmpty())
+    {
+        ResultIndex = SearchResultIndexBySessionName.Find(PendingReconnectSessionName);
+    }
+
+    if (ResultIndex && LastSearchResults[*ResultIndex].SearchResult.IsValid())
+    {
+        return &LastSearchResults[*ResultIndex];
+    }
+
+    return nullptr;
 }
 
 // === 타이머 콜백 함수들 ===
@@ -989,14 +1296,15 @@ void UHSSessionManager::AttemptReconnect()
 
     bReconnectSearchPending = true;
     PendingReconnectSessionName = CurrentSessionInfo.SessionName;
-    PendingReconnectSessionId = CurrentSessionInfo.SessionSettings.FindRef(TEXT("SESSION_ID"));
+    PendingReconnectSessionId = !CurrentSessionInfo.SessionId.IsEmpty() ? CurrentSessionInfo.SessionId : CurrentSessionInfo.SessionSettings.FindRef(TEXT("SESSION_ID"));
 
     FHSSessionSearchFilter ReconnectFilter = DefaultSearchFilter;
     ReconnectFilter.MaxSearchResults = FMath::Max(10, DefaultSearchFilter.MaxSearchResults);
     ReconnectFilter.GameMode = CurrentSessionInfo.GameMode;
     ReconnectFilter.MapName = CurrentSessionInfo.MapName;
 
-    if (!SearchSessions(ReconnectFilter))
+    // 재연결은 캐시 대신 항상 최신 검색 결과를 사용
+    if (!StartSessionSearch(ReconnectFilter, false))
     {
         bReconnectSearchPending = false;
         HandleSessionError(TEXT("Failed to start reconnection search"));
@@ -1026,6 +1334,8 @@ void UHSSessionManager::CleanupSession()
     {
         LastSearchResults.Empty();
         LastSearchResultsTimestamp = FDateTime::MinValue();
+        LastSearchFilterKey = 0;
+        RebuildSearchResultIndices();
         UE_LOG(LogTemp, Verbose, TEXT("HSSessionManager: 오래된 세션 검색 결과 정리"));
     }
 
@@ -1088,97 +1398,17 @@ void UHSSessionManager::OnFindSessionsComplete(bool bSuccess)
 {
     if (bSuccess && CurrentSessionSearch.IsValid())
     {
-        LastSearchResults.Empty();
-        
-        // 검색 결과를 내부 형식으로 변환
-        for (const FOnlineSessionSearchResult& SearchResult : CurrentSessionSearch->SearchResults)
-        {
-            FHSSessionInfo SessionInfo = ConvertFromSearchResult(SearchResult);
-            LastSearchResults.Add(SessionInfo);
-        }
-        LastSearchResultsTimestamp = FDateTime::UtcNow();
+        // 이전 결과와 합쳐 새로 발견된 세션만 변환하고 색인 재구성
+        ApplySearchResults(CurrentSessionSearch.ToSharedRef());
+        LastSearchFilter = ActiveSearchFilter;
+        LastSearchFilterKey = ActiveSearchFilterKey;
         
         ChangeSessionState(EHSSessionState::SS_None);
         OnSessionSearchCompleted.Broadcast(true, LastSearchResults);
         
         UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 세션 검색 완료 - %d개 발견"), LastSearchResults.Num());
 
-        if (bPendingQuickMatchJoin)
-        {
-            const FHSSessionInfo* BestSession = nullptr;
-            int32 BestPing = TNumericLimits<int32>::Max();
-
-            for (const FHSSessionInfo& SessionInfo : LastSearchResults)
-            {
-                if (!SessionInfo.SearchResult.IsValid())
-                {
-                    continue;
-                }
-
-                if (SessionInfo.MaxPlayers > 0 && SessionInfo.CurrentPlayers >= SessionInfo.MaxPlayers)
-                {
-                    continue;
-                }
-
-                if (PendingQuickMatchFilter.MaxPing > 0 && SessionInfo.Ping > PendingQuickMatchFilter.MaxPing)
-                {
-                    continue;
-                }
-
-                if (!BestSession || SessionInfo.Ping < BestPing)
-                {
-                    BestSession = &SessionInfo;
-                    BestPing = SessionInfo.Ping;
-                }
-            }
-
-            bPendingQuickMatchJoin = false;
-
-            if (BestSession)
-            {
-                UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 빠른 매칭 대상 세션 선택 - %s (핑: %d)"), *BestSession->SessionName, BestSession->Ping);
-                JoinSession(*BestSession);
-                return;
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 빠른 매칭 조건에 맞는 세션이 없습니다"));
-            }
-        }
-
-        if (bReconnectSearchPending)
-        {
-            const FHSSessionInfo* TargetSession = nullptr;
-            for (const FHSSessionInfo& SessionInfo : LastSearchResults)
-            {
-                if (!SessionInfo.SearchResult.IsValid())
-                {
-                    continue;
-                }
-
-                const FString* SessionIdSetting = SessionInfo.SessionSettings.Find(TEXT("SESSION_ID"));
-                const bool bIdMatches = SessionIdSetting && !PendingReconnectSessionId.IsEmpty() && SessionIdSetting->Equals(PendingReconnectSessionId, ESearchCase::IgnoreCase);
-                const bool bNameMatches = SessionInfo.SessionName.Equals(PendingReconnectSessionName, ESearchCase::IgnoreCase);
-
-                if (bIdMatches || bNameMatches)
-                {
-                    TargetSession = &SessionInfo;
-                    break;
-                }
-            }
-
-            if (TargetSession)
-            {
-                UE_LOG(LogTemp, Log, TEXT("HSSessionManager: 재연결 대상 세션 발견 - %s"), *TargetSession->SessionName);
-                bReconnectSearchPending = false;
-                JoinSession(*TargetSession);
-                return;
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 재연결 대상 세션을 찾지 못했습니다"));
-            }
-        }
+        ProcessPendingSearchRequests();
     }
     else
     {
@@ -1291,6 +1521,74 @@ void UHSSessionManager::LogSearchResults() const
     }
 }
 
+// 가상 검색 결과 성능 측정
+void UHSSessionManager::ProfileSyntheticSearchResults(int32 SessionCount)
+{
+    if (CurrentSessionState != EHSSessionState::SS_None)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 세션 처리 중에는 가상 검색 결과를 측정할 수 없습니다"));
+        return;
+    }
+
+    SessionCount = FMath::Clamp(SessionCount, 1, 100000);
+
+    const TSharedRef<FOnlineSessionSearch> InitialSearch = MakeSyntheticSessionSearch(SessionCount, 1);
+    const TSharedRef<FOnlineSessionSearch> RefreshSearch = MakeSyntheticSessionSearch(SessionCount, 2);
+
+    // 실제 검색 결과와 캐시 상태는 측정 동안 따로 보관 (검색 필터 키는 건드리지 않으므로 캐시도 그대로 유지)
+    TArray<FHSSessionInfo> SavedSearchResults = MoveTemp(LastSearchResults);
+    const FDateTime SavedSearchResultsTimestamp = LastSearchResultsTimestamp;
+    const int32 SavedReusedSearchResultCount = ReusedSearchResultCount;
+
+    // 빈 결과에서 전체 변환, 이어서 같은 세션의 갱신 반영
+    LastSearchResults.Reset();
+    RebuildSearchResultIndices();
+
+    const double InitialStartTime = FPlatformTime::Seconds();
+    ApplySearchResults(InitialSearch);
+    const double RefreshStartTime = FPlatformTime::Seconds();
+    ApplySearchResults(RefreshSearch);
+    const double QuickMatchStartTime = FPlatformTime::Seconds();
+    const FHSSessionInfo* QuickMatchCandidate = FindQuickMatchCandidate(DefaultSearchFilter.MaxPing);
+    const double EndTime = FPlatformTime::Seconds();
+
+    UE_LOG(LogTemp, Warning, TEXT("HSSessionManager: 가상 검색 결과 %d개 - 최초 반영 %.2fms, 갱신 반영 %.2fms, 빠른 매칭 선택 %.3fms (핑 %d)"),
+           SessionCount,
+           (RefreshStartTime - InitialStartTime) * 1000.0,
+           (QuickMatchStartTime - RefreshStartTime) * 1000.0,
+           (EndTime - QuickMatchStartTime) * 1000.0,
+           QuickMatchCandidate ? QuickMatchCandidate->Ping : -1);
+
+    // 측정용 결과를 버리고 보관한 검색 결과와 색인 복원
+    LastSearchResults = MoveTemp(SavedSearchResults);
+    LastSearchResultsTimestamp = SavedSearchResultsTimestamp;
+    ReusedSearchResultCount = SavedReusedSearchResultCount;
+    RebuildSearchResultIndices();
+}
+
+// 가상 검색 결과 생성
+TSharedRef<FOnlineSessionSearch> UHSSessionManager::MakeSyntheticSessionSearch(int32 SessionCount, int32 RandomSeed)
+{
+    // 같은 세션 ID 집합에 핑/인원만 시드별로 다른 검색 결과 생성
+    TSharedRef<FOnlineSessionSearch> SyntheticSearch = MakeShared<FOnlineSessionSearch>();
+    SyntheticSearch->SearchResults.SetNum(SessionCount);
+
+    FRandomStream RandomStream(RandomSeed);
+    for (int32 ResultIndex = 0; ResultIndex < SessionCount; ++ResultIndex)
+    {
+        FOnlineSessionSearchResult& SearchResult = SyntheticSearch->SearchResults[ResultIndex];
+        SearchResult.PingInMs = RandomStream.RandRange(10, 500);
+        SearchResult.Session.SessionSettings.NumPublicConnections = 4;
+        SearchResult.Session.NumOpenPublicConnections = RandomStream.RandRange(0, 4);
+        SearchResult.Session.SessionSettings.Set(TEXT("SESSION_ID"), FString::Printf(TEXT("Synthetic_%d"), ResultIndex), EOnlineDataAdvertisementType::ViaOnlineService);
+        SearchResult.Session.SessionSettings.Set(TEXT("SESSION_NAME"), FString::Printf(TEXT("Synthetic Session %d"), ResultIndex), EOnlineDataAdvertisementType::ViaOnlineService);
+        SearchResult.Session.SessionSettings.Set(TEXT("MAP_NAME"), FString(TEXT("/Game/Maps/DefaultMap")), EOnlineDataAdvertisementType::ViaOnlineService);
+        SearchResult.Session.SessionSettings.Set(TEXT("GAME_MODE"), FString(TEXT("HSGameMode")), EOnlineDataAdvertisementType::ViaOnlineService);
+    }
+
+    return SyntheticSearch;
+}
+
 // === 에러 처리 ===
 
 // 세션 에러 처리
@@ -79,7 +79,11 @@ struct FHSSessionInfo
     UPROPERTY(BlueprintReadOnly, Category = "Session Info")
     int32 Ping;
 
-    // 세션 설정 키-값 쌍
+    // 세션 식별자 (SESSION_ID 설정, 없으면 온라인 서브시스템 세션 ID)
+    UPROPERTY(BlueprintReadOnly, Category = "Session Info")
+    FString SessionId;
+
+    // 세션 설정 키-값 쌍 (검색 결과에서는 참여 시점 또는 GetSearchResultSettings 호출 시 채워짐)
     UPROPERTY(BlueprintReadOnly, Category = "Session Info")
     TMap<FString, FString> SessionSettings;
 
@@ -245,6 +249,10 @@ class HUNTINGSPIRIT_API UHSSessionManager : public UGameInstanceSubsystem
 {
     GENERATED_BODY()
 
+#if WITH_DEV_AUTOMATION_TESTS
+    friend class FHSSessionManagerSyntheticSearchTest;
+#endif
+
 public:
     // 생성자
     UHSSessionManager();
@@ -325,6 +333,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Session Search")
     bool QuickMatch(const FHSSessionSearchFilter& SearchFilter);
 
+    /**
+     * 마지막 검색 필터로 캐시를 건너뛰고 온라인 검색을 다시 수행합니다
+     * 검색 자체는 전체 검색이며, 결과 반영 시 이미 아는 세션만 변환 없이 인원/핑을 갱신합니다
+     * @return 검색 시작 성공 여부
+     */
+    UFUNCTION(BlueprintCallable, Category = "Session Search")
+    bool RefreshSearchResults();
+
+    /**
+     * 검색 결과 캐시를 무효화합니다 (다음 검색은 항상 온라인 검색 수행)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Session Search")
+    void InvalidateSearchCache();
+
     // === 세션 정보 조회 ===
 
     /**
@@ -348,6 +370,22 @@ public:
     UFUNCTION(BlueprintPure, Category = "Session Info")
     TArray<FHSSessionInfo> GetLastSearchResults() const { return LastSearchResults; }
 
+    /**
+     * 검색 결과의 세션 설정을 반환합니다 (필요할 때만 문자열로 변환)
+     * @param SessionIndex 검색 결과에서의 세션 인덱스
+     * @return 설정 키-값 쌍
+     */
+    UFUNCTION(BlueprintPure, Category = "Session Info")
+    TMap<FString, FString> GetSearchResultSettings(int32 SessionIndex) const;
+
+    /**
+     * 세션 ID로 검색 결과 인덱스를 찾습니다
+     * @param SessionId 세션 식별자
+     * @return 검색 결과 인덱스, 없으면 -1
+     */
+    UFUNCTION(BlueprintPure, Category = "Session Info")
+    int32 FindSearchResultIndexBySessionId(const FString& SessionId) const;
+
     /**
      * 세션에 참여 중인지 확인합니다
      * @return 세션 참여 여부
@@ -538,6 +576,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Configuration")
     float ConnectionTimeout;
 
+    // 같은 필터의 검색 결과를 재사용하는 시간 (초, 0이면 캐시 사용 안 함)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Configuration")
+    float SearchResultCacheTTL;
+
     // === 런타임 변수들 ===
 
     // 온라인 서브시스템 참조
@@ -568,6 +610,21 @@ protected:
     // 최근 검색 결과 타임스탬프
     FDateTime LastSearchResultsTimestamp;
 
+    // 최근 검색 결과와 진행 중인 검색의 필터 (키는 필터 전체 해시, 0이면 캐시 없음)
+    FHSSessionSearchFilter LastSearchFilter;
+    uint32 LastSearchFilterKey;
+    FHSSessionSearchFilter ActiveSearchFilter;
+    uint32 ActiveSearchFilterKey;
+
+    // 검색 결과 색인 (결과가 바뀔 때 한 번만 구성)
+    TMap<FString, int32> SearchResultIndexBySessionId;
+    TMap<FString, int32> SearchResultIndexBySessionName;
+    TArray<TArray<int32>> SearchResultIndicesByPingBucket;
+
+    // 검색 캐시 통계
+    int32 SearchCacheHitCount;
+    int32 ReusedSearchResultCount;
+
     // 금지된 플레이어 유효 기간 추적
     UPROPERTY()
     TMap<FString, FDateTime> BannedPlayerTimestamps;
@@ -590,6 +647,8 @@ private:
     // === 상수 설정 ===
     static constexpr float BanRetentionHours = 24.0f;
     static constexpr float SearchResultRetentionSeconds = 120.0f;
+    static constexpr int32 PingBucketSizeMs = 50;
+    static constexpr int32 PingBucketCount = 10; // 마지막 구간은 450ms 이상 전부
 
     // === 내부 함수들 ===
 
@@ -605,9 +664,33 @@ private:
     // 검색 필터를 엔진 형식으로 변환
     void ApplySearchFilter(const FHSSessionSearchFilter& Filter, TSharedPtr<FOnlineSessionSearch> SessionSearch) const;
 
-    // 검색 결과를 내부 형식으로 변환
+    // 검색 결과를 내부 형식으로 변환 (세션 설정 맵은 채우지 않음)
     FHSSessionInfo ConvertFromSearchResult(const FOnlineSessionSearchResult& SearchResult) const;
 
+    // 검색 결과에서 자주 바뀌는 값(인원, 핑)만 갱신
+    static void UpdateSessionAvailability(FHSSessionInfo& SessionInfo, const FOnlineSessionSearchResult& SearchResult);
+
+    // 검색 결과의 세션 설정을 문자열 맵으로 변환
+    static void ExtractSessionSettings(const FOnlineSessionSearchResult& SearchResult, TMap<FString, FString>& OutSettings);
+
+    // 검색 결과의 세션 식별자
+    static FString GetSearchResultSessionId(const FOnlineSessionSearchResult& SearchResult);
+
+    // 검색 필터 전체를 해시한 캐시 키
+    static uint32 GetSearchFilterKey(const FHSSessionSearchFilter& Filter);
+
+    // 필터로 검색 시작 (bAllowCachedResults면 유효한 캐시가 있을 때 바로 완료 처리)
+    bool StartSessionSearch(const FHSSessionSearchFilter& SearchFilter, bool bAllowCachedResults);
+
+    // 새 검색 결과를 기존 결과와 합치고 색인 재구성 (이미 아는 세션은 재사용)
+    void ApplySearchResults(const TSharedRef<FOnlineSessionSearch>& SessionSearch);
+    void RebuildSearchResultIndices();
+
+    // 검색 완료 후 빠른 매칭/재연결 대기 요청 처리 (참여를 시작했으면 true)
+    bool ProcessPendingSearchRequests();
+    const FHSSessionInfo* FindQuickMatchCandidate(int32 MaxPing) const;
+    const FHSSessionInfo* FindReconnectCandidate() const;
+
     // 세션 하트비트 처리
     UFUNCTION()
     void ProcessSessionHeartbeat();
@@ -675,6 +758,13 @@ private:
     UFUNCTION(BlueprintCallable, Category = "Debug", CallInEditor)
     void LogSearchResults() const;
 
+    // 가상 검색 결과로 결과 반영/색인 구성 시간 측정 (온라인 서브시스템 없이 실행 가능, 기존 검색 결과는 복원)
+    UFUNCTION(BlueprintCallable, Category = "Debug", CallInEditor)
+    void ProfileSyntheticSearchResults(int32 SessionCount = 2000);
+
+    // 같은 세션 ID 집합에 시드별로 핑/인원만 다른 가상 검색 결과 생성
+    static TSharedRef<FOnlineSessionSearch> MakeSyntheticSessionSearch(int32 SessionCount, int32 RandomSeed);
+
     // === 에러 처리 ===
 
     // 세션 에러 처리
@@ -0,0 +1,137 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 에셋 선로딩 관리자 구현
+
+#include "HSAssetPreloadManager.h"
+#include "Engine/Engine.h"
+#include "Engine/AssetManager.h"
+#include "Stats/Stats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sync Load Fallbacks"), STAT_HSSyncLoadFallbacks, STATGROUP_Game);
+
+void UHSAssetPreloadManager::Deinitialize()
+{
+    for (auto& GroupPair : PreloadGroups)
+    {
+        if (GroupPair.Value.Handle.IsValid())
+        {
+            GroupPair.Value.Handle->CancelHandle();
+        }
+    }
+    PreloadGroups.Empty();
+
+    Super::Deinitialize();
+}
+
+UHSAssetPreloadManager* UHSAssetPreloadManager::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UHSAssetPreloadManager>() : nullptr;
+}
+
+void UHSAssetPreloadManager::RequestPreload(FName GroupName, const TArray<FSoftObjectPath>& AssetPaths,
+                                            FStreamableDelegate OnLoaded, TAsyncLoadPriority Priority)
+{
+    if (GroupName.IsNone())
+    {
+        OnLoaded.ExecuteIfBound();
+        return;
+    }
+
+    // 이미 요청된 그룹은 콜백만 합침
+    if (FPreloadGroup* ExistingGroup = PreloadGroups.Find(GroupName))
+    {
+        ++MergedPreloadRequestCount;
+
+        if (ExistingGroup->bLoaded)
+        {
+            OnLoaded.ExecuteIfBound();
+        }
+        else if (OnLoaded.IsBound())
+        {
+            ExistingGroup->PendingCallbacks.Add(MoveTemp(OnLoaded));
+        }
+        return;
+    }
+
+    TArray<FSoftObjectPath> PathsToLoad;
+    PathsToLoad.Reserve(AssetPaths.Num());
+    for (const FSoftObjectPath& AssetPath : AssetPaths)
+    {
+        if (AssetPath.IsValid())
+        {
+            PathsToLoad.AddUnique(AssetPath);
+        }
+    }
+
+    ++PreloadRequestCount;
+
+    FPreloadGroup& NewGroup = PreloadGroups.Add(GroupName);
+    if (OnLoaded.IsBound())
+    {
+        NewGroup.PendingCallbacks.Add(MoveTemp(OnLoaded));
+    }
+
+    if (PathsToLoad.Num() == 0)
+    {
+        HandleGroupLoaded(GroupName);
+        return;
+    }
+
+    // 이미 메모리에 있으면 핸들이 즉시 완료되며 콜백도 바로 호출됨
+    FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+    TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+        MoveTemp(PathsToLoad),
+        FStreamableDelegate::CreateUObject(this, &UHSAssetPreloadManager::HandleGroupLoaded, GroupName),
+        Priority);
+
+    // 즉시 완료로 콜백 안에서 그룹이 해제되었을 수 있으므로 다시 찾음
+    if (FPreloadGroup* Group = PreloadGroups.Find(GroupName))
+    {
+        Group->Handle = Handle;
+    }
+}
+
+void UHSAssetPreloadManager::ReleasePreload(FName GroupName)
+{
+    FPreloadGroup Group;
+    if (PreloadGroups.RemoveAndCopyValue(GroupName, Group) && Group.Handle.IsValid())
+    {
+        // 로드 중이면 완료 후 해제되며, 그룹이 없으므로 대기 중인 콜백은 호출되지 않음
+        Group.Handle->ReleaseHandle();
+    }
+}
+
+bool UHSAssetPreloadManager::IsPreloadComplete(FName GroupName) const
+{
+    const FPreloadGroup* Group = PreloadGroups.Find(GroupName);
+    return Group && Group->bLoaded;
+}
+
+void UHSAssetPreloadManager::HandleGroupLoaded(FName GroupName)
+{
+    FPreloadGroup* Group = PreloadGroups.Find(GroupName);
+    if (!Group)
+    {
+        return;
+    }
+
+    Group->bLoaded = true;
+
+    // 콜백 안에서 다른 그룹을 요청할 수 있으므로 목록을 꺼낸 뒤 실행
+    TArray<FStreamableDelegate> Callbacks = MoveTemp(Group->PendingCallbacks);
+    for (FStreamableDelegate& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound();
+    }
+}
+
+void UHSAssetPreloadManager::RecordSyncLoadFallback(const FSoftObjectPath& AssetPath, const TCHAR* Context)
+{
+    INC_DWORD_STAT(STAT_HSSyncLoadFallbacks);
+
+    if (UHSAssetPreloadManager* PreloadManager = Get())
+    {
+        ++PreloadManager->SyncLoadFallbackCount;
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("HSAssetPreloadManager - 선로딩되지 않은 에셋 동기 로드 (%s): %s"),
+           Context ? Context : TEXT("Unknown"), *AssetPath.ToString());
+}
@@ -0,0 +1,109 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 에셋 선로딩 관리자
+// 바이옴/보스/레시피 세트 단위로 소프트 참조를 미리 비동기 로드해 게임 스레드의 동기 로딩을 제거
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPtr.h"
+#include "HSAssetPreloadManager.generated.h"
+
+/**
+ * 에셋 선로딩 관리자
+ * - 그룹 이름 단위로 소프트 참조 묶음을 비동기 로드하고, 해제 전까지 핸들로 메모리에 유지
+ * - 같은 그룹의 중복 요청은 기존 로드에 콜백만 추가 (이미 완료되었으면 즉시 호출)
+ * - 호출자는 Resolve* 로 이미 로드된 에셋을 받고, 아직 로드되지 않았을 때만 동기 로딩으로 대체 (횟수 집계)
+ * - 게임 인스턴스가 없는 데이터 에셋에서도 쓸 수 있도록 엔진 서브시스템으로 둠
+ */
+UCLASS()
+class HUNTINGSPIRIT_API UHSAssetPreloadManager : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem 인터페이스
+    virtual void Deinitialize() override;
+
+    // 엔진이 없으면 nullptr
+    static UHSAssetPreloadManager* Get();
+
+    /**
+     * 에셋 묶음을 비동기로 미리 로드합니다
+     * @param GroupName 선로딩 그룹 이름 (같은 이름의 요청은 하나로 합쳐짐)
+     * @param AssetPaths 로드할 에셋 경로 (빈 경로는 무시)
+     * @param OnLoaded 그룹 로드가 끝나면 호출 (이미 끝났으면 즉시 호출)
+     * @param Priority 비동기 로드 우선순위
+     */
+    void RequestPreload(FName GroupName, const TArray<FSoftObjectPath>& AssetPaths,
+                        FStreamableDelegate OnLoaded = FStreamableDelegate(),
+                        TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+    /**
+     * 선로딩 그룹을 해제합니다 (다른 참조가 없으면 GC 대상이 됨)
+     */
+    void ReleasePreload(FName GroupName);
+
+    bool IsPreloadRequested(FName GroupName) const { return PreloadGroups.Contains(GroupName); }
+    bool IsPreloadComplete(FName GroupName) const;
+
+    /**
+     * 로드된 에셋을 반환하고, 로드 전이면 동기 로딩으로 대체합니다 (대체 횟수 집계)
+     */
+    template<typename T>
+    static T* ResolveSoftObject(const TSoftObjectPtr<T>& SoftObject, const TCHAR* Context)
+    {
+        if (T* LoadedObject = SoftObject.Get())
+        {
+            return LoadedObject;
+        }
+        if (SoftObject.IsNull())
+        {
+            return nullptr;
+        }
+
+        RecordSyncLoadFallback(SoftObject.ToSoftObjectPath(), Context);
+        return SoftObject.LoadSynchronous();
+    }
+
+    template<typename T>
+    static UClass* ResolveSoftClass(const TSoftClassPtr<T>& SoftClass, const TCHAR* Context)
+    {
+        if (UClass* LoadedClass = SoftClass.Get())
+        {
+            return LoadedClass;
+        }
+        if (SoftClass.IsNull())
+        {
+            return nullptr;
+        }
+
+        RecordSyncLoadFallback(SoftClass.ToSoftObjectPath(), Context);
+        return SoftClass.LoadSynchronous();
+    }
+
+    // 통계
+    int32 GetPreloadGroupCount() const { return PreloadGroups.Num(); }
+    int32 GetPreloadRequestCount() const { return PreloadRequestCount; }
+    int32 GetMergedPreloadRequestCount() const { return MergedPreloadRequestCount; }
+    int32 GetSyncLoadFallbackCount() const { return SyncLoadFallbackCount; }
+
+private:
+    struct FPreloadGroup
+    {
+        TSharedPtr<FStreamableHandle> Handle;
+        TArray<FStreamableDelegate> PendingCallbacks;
+        bool bLoaded = false;
+    };
+
+    static void RecordSyncLoadFallback(const FSoftObjectPath& AssetPath, const TCHAR* Context);
+
+    void HandleGroupLoaded(FName GroupName);
+
+    TMap<FName, FPreloadGroup> PreloadGroups;
+
+    // 통계
+    int32 PreloadRequestCount = 0;
+    int32 MergedPreloadRequestCount = 0;
+    int32 SyncLoadFallbackCount = 0;
+};
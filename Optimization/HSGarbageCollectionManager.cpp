@@ -0,0 +1,297 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 가비지 컬렉션 정책 관리자 구현
+
+#include "HSGarbageCollectionManager.h"
+#include "HuntingSpirit/Networking/DedicatedServer/HSDedicatedServerManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UObjectGlobals.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("HSGarbageCollection"), STATGROUP_HSGarbageCollection, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GC Pause This Frame (ms)"), STAT_HSGCFramePauseMs, STATGROUP_HSGarbageCollection);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("GC Deferred Frames"), STAT_HSGCDeferredFrames, STATGROUP_HSGarbageCollection);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("GC Collections"), STAT_HSGCCollections, STATGROUP_HSGarbageCollection);
+
+namespace HSGarbageCollectionManagerConstants
+{
+    // 멈춤 시간 히스토그램 구간 상한 (ms), 마지막 구간은 그 이상
+    static constexpr float PauseBucketUpperBoundsMs[] = { 1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 33.0f, 66.0f };
+    static constexpr int32 PauseBucketCount = UE_ARRAY_COUNT(PauseBucketUpperBoundsMs) + 1;
+
+    // 히스토그램 로그 주기 (완료된 수집 횟수)
+    static constexpr int32 HistogramLogInterval = 10;
+}
+
+void UHSGarbageCollectionManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PauseHistogram.SetNumZeroed(HSGarbageCollectionManagerConstants::PauseBucketCount);
+}
+
+void UHSGarbageCollectionManager::Deinitialize()
+{
+    if (CompletedCollectionCount > 0)
+    {
+        LogPauseHistogram();
+    }
+
+    CombatHoldSources.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UHSGarbageCollectionManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHSGarbageCollectionManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHSGarbageCollectionManager, STATGROUP_Tickables);
+}
+
+void UHSGarbageCollectionManager::RequestCollection(bool bUrgent, const TCHAR* Reason)
+{
+    bUrgentRequest |= bUrgent;
+
+    if (bCollectionRequested)
+    {
+        return;
+    }
+
+    bCollectionRequested = true;
+    RequestTime = FPlatformTime::Seconds();
+    RequestReason = Reason ? Reason : TEXT("Unknown");
+
+    UE_LOG(LogTemp, Verbose, TEXT("HSGarbageCollectionManager: 가비지 컬렉션 요청 (%s%s)"),
+           *RequestReason, bUrgent ? TEXT(", 긴급") : TEXT(""));
+}
+
+void UHSGarbageCollectionManager::NotifyGamePhaseChanged(EHSGamePhase NewPhase)
+{
+    CurrentGamePhase = NewPhase;
+    NotifyNaturalPause();
+}
+
+void UHSGarbageCollectionManager::NotifyNaturalPause()
+{
+    RefreshConfig();
+    NaturalPauseEndTime = FPlatformTime::Seconds() + PerformanceConfig.GCNaturalPauseWindow;
+}
+
+void UHSGarbageCollectionManager::SetCombatHold(const UObject* Source, bool bHold)
+{
+    if (!Source)
+    {
+        return;
+    }
+
+    if (bHold)
+    {
+        CombatHoldSources.AddUnique(Source);
+    }
+    else
+    {
+        CombatHoldSources.RemoveSwap(Source);
+    }
+}
+
+bool UHSGarbageCollectionManager::IsCombatIntensive() const
+{
+    if (CurrentGamePhase == EHSGamePhase::GP_BossEncounter)
+    {
+        return true;
+    }
+
+    for (const TWeakObjectPtr<const UObject>& Source : CombatHoldSources)
+    {
+        if (Source.IsValid())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UHSGarbageCollectionManager::RefreshConfig()
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    UHSDedicatedServerManager* ServerManager = GameInstance ? GameInstance->GetSubsystem<UHSDedicatedServerManager>() : nullptr;
+    UHSServerConfig* ServerConfig = ServerManager ? ServerManager->GetServerConfig() : nullptr;
+
+    PerformanceConfig = ServerConfig ? ServerConfig->GetPerformanceConfig() : FHSPerformanceConfig();
+}
+
+void UHSGarbageCollectionManager::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // 파괴된 보류 대상 정리
+    CombatHoldSources.RemoveAllSwap([](const TWeakObjectPtr<const UObject>& Source) { return !Source.IsValid(); });
+
+    if (bCollectionInProgress)
+    {
+        AdvanceCollection();
+        return;
+    }
+
+    if (!bCollectionRequested)
+    {
+        return;
+    }
+
+    RefreshConfig();
+
+    const double CurrentTime = FPlatformTime::Seconds();
+    if (ShouldStartCollection(CurrentTime))
+    {
+        StartCollection(CurrentTime);
+    }
+    else if (IsCombatIntensive() && GEngine)
+    {
+        // 전투 중에는 엔진 자동 GC도 이번 프레임에는 건너뛰게 함 (메모리 부족 시 엔진 판단은 유지)
+        GEngine->DelayGarbageCollection();
+        ++DeferredFrameCount;
+        INC_DWORD_STAT(STAT_HSGCDeferredFrames);
+    }
+}
+
+bool UHSGarbageCollectionManager::ShouldStartCollection(double CurrentTime)
+{
+    if (IsGarbageCollecting())
+    {
+        return false;
+    }
+
+    const double WaitedSeconds = CurrentTime - RequestTime;
+    const bool bInNaturalPause = CurrentTime <= NaturalPauseEndTime;
+
+    if (IsCombatIntensive())
+    {
+        // 유예 시간을 넘기면 전투 중에도 수집 (점진 수집이므로 프레임당 멈춤은 예산 이내)
+        const float MaxDeferral = bUrgentRequest ? PerformanceConfig.GCUrgentMaxDeferral : PerformanceConfig.GCMaxCombatDeferral;
+        return WaitedSeconds >= MaxDeferral;
+    }
+
+    // 비전투 중에는 휴지 구간을 우선 기다리고, 긴급 요청이나 대기 한도 초과 시 바로 시작
+    return bInNaturalPause || bUrgentRequest || WaitedSeconds >= PerformanceConfig.GCNaturalPauseWait;
+}
+
+void UHSGarbageCollectionManager::StartCollection(double CurrentTime)
+{
+    const double SliceStartTime = FPlatformTime::Seconds();
+
+    // 전체 정리(Purge)는 하지 않고 도달성 분석만 시작, 이후 정리는 프레임 예산 안에서 진행
+    if (!TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, false))
+    {
+        // GC 잠금을 얻지 못하면 다음 프레임에 재시도
+        return;
+    }
+
+    bCollectionRequested = false;
+    bCollectionInProgress = true;
+    bStartedDuringCombat = IsCombatIntensive();
+    if (bStartedDuringCombat)
+    {
+        ++ForcedDuringCombatCount;
+    }
+    CollectionStartTime = CurrentTime;
+    CollectionPauseSeconds = 0.0;
+    CollectionSliceCount = 0;
+
+    RecordPause(FPlatformTime::Seconds() - SliceStartTime);
+
+    UE_LOG(LogTemp, Verbose, TEXT("HSGarbageCollectionManager: 가비지 컬렉션 시작 (%s, 대기 %.1f초%s)"),
+           *RequestReason, CurrentTime - RequestTime, bStartedDuringCombat ? TEXT(", 전투 중 유예 초과") : TEXT(""));
+
+    bUrgentRequest = false;
+    RequestReason.Reset();
+}
+
+void UHSGarbageCollectionManager::AdvanceCollection()
+{
+    const double TimeBudget = PerformanceConfig.GCFrameBudgetMs / 1000.0;
+    const double SliceStartTime = FPlatformTime::Seconds();
+    bool bWorkDone = false;
+
+#if !UE_VERSION_OLDER_THAN(5, 4, 0)
+    // 점진 도달성 분석이 켜져 있으면 남은 분석을 먼저 진행
+    if (IsIncrementalReachabilityAnalysisPending())
+    {
+        PerformIncrementalReachabilityAnalysis(TimeBudget);
+        bWorkDone = true;
+    }
+    else
+#endif
+    if (IsIncrementalPurgePending())
+    {
+        IncrementalPurgeGarbage(true, TimeBudget);
+        bWorkDone = true;
+    }
+
+    if (bWorkDone)
+    {
+        RecordPause(FPlatformTime::Seconds() - SliceStartTime);
+        return;
+    }
+
+    // 분석과 정리가 모두 끝남
+    bCollectionInProgress = false;
+    ++CompletedCollectionCount;
+    INC_DWORD_STAT(STAT_HSGCCollections);
+
+    UE_LOG(LogTemp, Verbose, TEXT("HSGarbageCollectionManager: 가비지 컬렉션 완료 - %d프레임, 총 멈춤 %.2fms, 경과 %.2f초"),
+           CollectionSliceCount, CollectionPauseSeconds * 1000.0, FPlatformTime::Seconds() - CollectionStartTime);
+
+    if (CompletedCollectionCount % HSGarbageCollectionManagerConstants::HistogramLogInterval == 0)
+    {
+        LogPauseHistogram();
+    }
+}
+
+void UHSGarbageCollectionManager::RecordPause(double PauseSeconds)
+{
+    const float PauseMs = static_cast<float>(PauseSeconds * 1000.0);
+
+    int32 BucketIndex = 0;
+    while (BucketIndex < UE_ARRAY_COUNT(HSGarbageCollectionManagerConstants::PauseBucketUpperBoundsMs) &&
+           PauseMs >= HSGarbageCollectionManagerConstants::PauseBucketUpperBoundsMs[BucketIndex])
+    {
+        ++BucketIndex;
+    }
+    ++PauseHistogram[BucketIndex];
+
+    LongestPauseMs = FMath::Max(LongestPauseMs, PauseMs);
+    CollectionPauseSeconds += PauseSeconds;
+    ++CollectionSliceCount;
+
+    SET_FLOAT_STAT(STAT_HSGCFramePauseMs, PauseMs);
+}
+
+void UHSGarbageCollectionManager::LogPauseHistogram() const
+{
+    using namespace HSGarbageCollectionManagerConstants;
+
+    FString HistogramText;
+    float LowerBoundMs = 0.0f;
+    for (int32 BucketIndex = 0; BucketIndex < PauseHistogram.Num(); ++BucketIndex)
+    {
+        if (BucketIndex < UE_ARRAY_COUNT(PauseBucketUpperBoundsMs))
+        {
+            HistogramText += FString::Printf(TEXT(" [%.0f-%.0fms]=%d"), LowerBoundMs, PauseBucketUpperBoundsMs[BucketIndex], PauseHistogram[BucketIndex]);
+            LowerBoundMs = PauseBucketUpperBoundsMs[BucketIndex];
+        }
+        else
+        {
+            HistogramText += FString::Printf(TEXT(" [%.0fms+]=%d"), LowerBoundMs, PauseHistogram[BucketIndex]);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("HSGarbageCollectionManager: GC 멈춤 히스토그램 (수집 %d회, 전투 중 강제 %d회, 유예 %d프레임, 최대 %.2fms):%s"),
+           CompletedCollectionCount, ForcedDuringCombatCount, DeferredFrameCount, LongestPauseMs, *HistogramText);
+}
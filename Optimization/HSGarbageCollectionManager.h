@@ -0,0 +1,108 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 가비지 컬렉션 정책 관리자
+// 강제 전체 GC 대신 수집 시점을 골라 점진적으로 나누어 실행해 전투 중 프레임 멈춤을 방지
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HuntingSpirit/Core/GameState/HSGameStateBase.h"
+#include "HuntingSpirit/Networking/DedicatedServer/HSServerConfig.h"
+#include "HSGarbageCollectionManager.generated.h"
+
+/**
+ * 가비지 컬렉션 정책 관리자
+ * - 호출자는 수집을 요청만 하고, 실제 시작 시점은 정책이 결정
+ * - 전투 집중 구간(보스 조우 페이즈, 웨이브 진행 등 전투 보류 중)에는 수집과 엔진 자동 GC를 미룸 (최대 유예 시간까지)
+ * - 페이즈 전환·웨이브 사이 같은 휴지 구간이 오면 우선 시작
+ * - 시작 후 도달성 분석과 정리(Purge)는 프레임당 시간 예산 안에서 나누어 진행
+ * - 프레임별 GC 멈춤 시간을 히스토그램으로 집계해 로그로 출력
+ */
+UCLASS()
+class HUNTINGSPIRIT_API UHSGarbageCollectionManager : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem 인터페이스
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject 인터페이스
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * 가비지 컬렉션을 요청합니다 (이미 대기 중이면 합쳐짐)
+     * @param bUrgent 메모리 부족 등 짧은 유예 후 반드시 수집해야 하는 요청
+     * @param Reason 로그용 요청 사유
+     */
+    void RequestCollection(bool bUrgent, const TCHAR* Reason);
+
+    /**
+     * 게임 페이즈 변경을 알립니다 (전환 시점은 휴지 구간으로 취급)
+     */
+    void NotifyGamePhaseChanged(EHSGamePhase NewPhase);
+
+    /**
+     * 웨이브 사이 등 휴지 구간이 시작되었음을 알립니다
+     */
+    void NotifyNaturalPause();
+
+    /**
+     * 전투 집중 구간 보류를 설정/해제합니다 (보류가 하나라도 있으면 수집을 미룸)
+     */
+    void SetCombatHold(const UObject* Source, bool bHold);
+
+    bool IsCombatIntensive() const;
+    bool IsCollectionPending() const { return bCollectionRequested; }
+    bool IsCollectionInProgress() const { return bCollectionInProgress; }
+
+    // 통계
+    int32 GetCompletedCollectionCount() const { return CompletedCollectionCount; }
+    int32 GetDeferredFrameCount() const { return DeferredFrameCount; }
+    int32 GetForcedDuringCombatCount() const { return ForcedDuringCombatCount; }
+    float GetLongestPauseMs() const { return LongestPauseMs; }
+    const TArray<int32>& GetPauseHistogram() const { return PauseHistogram; }
+
+    /**
+     * GC 멈춤 시간 히스토그램을 로그로 출력합니다
+     */
+    void LogPauseHistogram() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void RefreshConfig();
+    bool ShouldStartCollection(double CurrentTime);
+    void StartCollection(double CurrentTime);
+    void AdvanceCollection();
+    void RecordPause(double PauseSeconds);
+
+    // 서버 설정에서 가져온 성능 설정 (설정이 없으면 기본값)
+    FHSPerformanceConfig PerformanceConfig;
+
+    EHSGamePhase CurrentGamePhase = EHSGamePhase::GP_WaitingForPlayers;
+    TArray<TWeakObjectPtr<const UObject>> CombatHoldSources;
+
+    // 요청 상태
+    bool bCollectionRequested = false;
+    bool bUrgentRequest = false;
+    FString RequestReason;
+    double RequestTime = 0.0;
+    double NaturalPauseEndTime = -1.0;
+
+    // 진행 상태
+    bool bCollectionInProgress = false;
+    bool bStartedDuringCombat = false;
+    double CollectionStartTime = 0.0;
+    double CollectionPauseSeconds = 0.0;
+    int32 CollectionSliceCount = 0;
+
+    // 통계
+    TArray<int32> PauseHistogram;
+    int32 CompletedCollectionCount = 0;
+    int32 DeferredFrameCount = 0;
+    int32 ForcedDuringCombatCount = 0;
+    float LongestPauseMs = 0.0f;
+};
@@ -0,0 +1,439 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 중요도 기반 틱 관리자 구현
+
+#include "HSSignificanceManager.h"
+#include "HuntingSpirit/Enemies/Base/HSEnemyBase.h"
+#include "HuntingSpirit/Networking/DedicatedServer/HSDedicatedServerManager.h"
+#include "AIController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AISense_Sight.h"
+#include "Perception/PawnSensingComponent.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("HSSignificance"), STATGROUP_HSSignificance, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("High Tier Actors"), STAT_HSSignificanceHigh, STATGROUP_HSSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Medium Tier Actors"), STAT_HSSignificanceMedium, STATGROUP_HSSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Low Tier Actors"), STAT_HSSignificanceLow, STATGROUP_HSSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dormant Tier Actors"), STAT_HSSignificanceDormant, STATGROUP_HSSignificance);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Estimated Saved ms/Frame (not measured)"), STAT_HSSignificanceSavedMs, STATGROUP_HSSignificance);
+DECLARE_CYCLE_STAT(TEXT("Evaluate Significance"), STAT_HSSignificanceEvaluate, STATGROUP_HSSignificance);
+
+namespace HSSignificanceManagerHelpers
+{
+    // 두 등급 중 더 중요한 쪽
+    static EHSSignificanceTier MoreSignificant(EHSSignificanceTier A, EHSSignificanceTier B)
+    {
+        return static_cast<uint8>(A) <= static_cast<uint8>(B) ? A : B;
+    }
+
+    // 화면 표시 판정 시간 창 (초)
+    static constexpr float RecentlyRenderedTolerance = 0.25f;
+}
+
+void UHSSignificanceManager::Deinitialize()
+{
+    Entries.Empty();
+    EntryIndexByActor.Empty();
+    PlayerLocations.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UHSSignificanceManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHSSignificanceManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHSSignificanceManager, STATGROUP_Tickables);
+}
+
+void UHSSignificanceManager::RegisterActor(AActor* Actor, EHSSignificanceCategory Category)
+{
+    if (!IsValid(Actor) || EntryIndexByActor.Contains(Actor))
+    {
+        return;
+    }
+
+    FSignificanceEntry NewEntry;
+    NewEntry.Actor = Actor;
+    NewEntry.ActorKey = Actor;
+    NewEntry.Category = Category;
+    NewEntry.BaseTickInterval = Actor->GetActorTickInterval();
+
+    if (const ACharacter* Character = Cast<ACharacter>(Actor))
+    {
+        if (const USkeletalMeshComponent* Mesh = Character->GetMesh())
+        {
+            NewEntry.BaseMeshTickInterval = Mesh->GetComponentTickInterval();
+        }
+    }
+
+    if (const UPawnSensingComponent* Sensing = Actor->FindComponentByClass<UPawnSensingComponent>())
+    {
+        NewEntry.BasePerceptionInterval = Sensing->SensingInterval;
+    }
+
+    EntryIndexByActor.Add(Actor, Entries.Add(NewEntry));
+}
+
+void UHSSignificanceManager::UnregisterActor(AActor* Actor)
+{
+    if (const int32* IndexPtr = EntryIndexByActor.Find(Actor))
+    {
+        const int32 EntryIndex = *IndexPtr;
+        ApplyTier(Entries[EntryIndex], EHSSignificanceTier::High);
+        RemoveEntryAt(EntryIndex);
+    }
+}
+
+void UHSSignificanceManager::RemoveEntryAt(int32 EntryIndex)
+{
+    // 파괴된 액터도 지울 수 있도록 등록 시점의 키를 사용
+    EntryIndexByActor.Remove(Entries[EntryIndex].ActorKey);
+    Entries.RemoveAtSwap(EntryIndex, 1, false);
+    if (Entries.IsValidIndex(EntryIndex))
+    {
+        EntryIndexByActor.Add(Entries[EntryIndex].ActorKey, EntryIndex);
+    }
+}
+
+int32 UHSSignificanceManager::GetTierActorCount(EHSSignificanceTier Tier) const
+{
+    return TierCounts[static_cast<uint8>(Tier)];
+}
+
+EHSSignificanceTier UHSSignificanceManager::GetActorTier(const AActor* Actor) const
+{
+    const int32* IndexPtr = EntryIndexByActor.Find(Actor);
+    return IndexPtr ? Entries[*IndexPtr].Tier : EHSSignificanceTier::High;
+}
+
+const TArray<FHSPlayerLocationEntry>& UHSSignificanceManager::GetPlayerLocations()
+{
+    if (PlayerLocationsFrame == GFrameCounter)
+    {
+        return PlayerLocations;
+    }
+    PlayerLocationsFrame = GFrameCounter;
+
+    PlayerLocations.Reset();
+    if (UWorld* World = GetWorld())
+    {
+        for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+        {
+            const APlayerController* PlayerController = Iterator->Get();
+            if (APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+            {
+                FHSPlayerLocationEntry& PlayerEntry = PlayerLocations.AddDefaulted_GetRef();
+                PlayerEntry.Pawn = PlayerPawn;
+                PlayerEntry.Location = PlayerPawn->GetActorLocation();
+            }
+        }
+    }
+    return PlayerLocations;
+}
+
+void UHSSignificanceManager::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    AccumulatedDeltaTime += DeltaTime;
+    ++AccumulatedFrames;
+
+    TimeSinceLastEvaluation += DeltaTime;
+    if (TimeSinceLastEvaluation < PerformanceConfig.SignificanceUpdateInterval)
+    {
+        return;
+    }
+    TimeSinceLastEvaluation = 0.0f;
+
+    RefreshConfig();
+    EvaluateSignificance();
+
+    AccumulatedDeltaTime = 0.0f;
+    AccumulatedFrames = 0;
+}
+
+void UHSSignificanceManager::RefreshConfig()
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    UHSDedicatedServerManager* ServerManager = GameInstance ? GameInstance->GetSubsystem<UHSDedicatedServerManager>() : nullptr;
+    UHSServerConfig* ServerConfig = ServerManager ? ServerManager->GetServerConfig() : nullptr;
+
+    PerformanceConfig = ServerConfig ? ServerConfig->GetPerformanceConfig() : FHSPerformanceConfig();
+}
+
+void UHSSignificanceManager::EvaluateSignificance()
+{
+    SCOPE_CYCLE_COUNTER(STAT_HSSignificanceEvaluate);
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // 파괴된 액터 정리
+    for (int32 EntryIndex = Entries.Num() - 1; EntryIndex >= 0; --EntryIndex)
+    {
+        if (!Entries[EntryIndex].Actor.IsValid())
+        {
+            RemoveEntryAt(EntryIndex);
+        }
+    }
+
+    // 관리가 꺼져 있으면 모든 액터를 기준 설정으로 복원
+    if (!PerformanceConfig.bEnableSignificanceTicking)
+    {
+        for (FSignificanceEntry& Entry : Entries)
+        {
+            if (Entry.Tier != EHSSignificanceTier::High)
+            {
+                ApplyTier(Entry, EHSSignificanceTier::High);
+            }
+        }
+        FMemory::Memzero(TierCounts, sizeof(TierCounts));
+        TierCounts[static_cast<uint8>(EHSSignificanceTier::High)] = Entries.Num();
+        EstimatedSavedMsPerFrame = 0.0f;
+        return;
+    }
+
+    // 플레이어 위치 수집 (공유 색인)
+    TArray<FVector, TInlineAllocator<8>> PlayerPositions;
+    for (const FHSPlayerLocationEntry& PlayerEntry : GetPlayerLocations())
+    {
+        PlayerPositions.Add(PlayerEntry.Location);
+    }
+
+    // 1. 거리/화면/전투 기준 등급 산정
+    TArray<EHSSignificanceTier> NewTiers;
+    NewTiers.SetNumUninitialized(Entries.Num());
+    TArray<int32> HighTierIndices;
+
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+    {
+        FSignificanceEntry& Entry = Entries[EntryIndex];
+        const AActor* ReferenceActor = GetReferenceActor(Entry);
+        if (!ReferenceActor || PlayerPositions.Num() == 0)
+        {
+            NewTiers[EntryIndex] = EHSSignificanceTier::Dormant;
+            continue;
+        }
+
+        const FVector ActorLocation = ReferenceActor->GetActorLocation();
+        float NearestDistanceSquared = TNumericLimits<float>::Max();
+        for (const FVector& PlayerLocation : PlayerPositions)
+        {
+            NearestDistanceSquared = FMath::Min(NearestDistanceSquared, FVector::DistSquared(ActorLocation, PlayerLocation));
+        }
+
+        const AHSEnemyBase* Enemy = Cast<AHSEnemyBase>(ReferenceActor);
+        Entry.NearestPlayerDistance = FMath::Sqrt(NearestDistanceSquared);
+        Entry.bInCombat = Enemy && Enemy->IsInCombat();
+
+        EHSSignificanceTier Tier = ComputeDistanceTier(Entry.NearestPlayerDistance, Entry.Tier);
+
+        // 전투 중이거나 화면에 보이는 액터는 최소 Medium 유지
+        if (Entry.bInCombat || ReferenceActor->WasRecentlyRendered(HSSignificanceManagerHelpers::RecentlyRenderedTolerance))
+        {
+            Tier = HSSignificanceManagerHelpers::MoreSignificant(Tier, EHSSignificanceTier::Medium);
+        }
+
+        NewTiers[EntryIndex] = Tier;
+        if (Tier == EHSSignificanceTier::High)
+        {
+            HighTierIndices.Add(EntryIndex);
+        }
+    }
+
+    // 2. High 등급 예산 초과 시 전투 중이 아니고 먼 액터부터 Medium으로 하향
+    const int32 HighBudget = PerformanceConfig.MaxHighSignificanceActors;
+    if (HighBudget > 0 && HighTierIndices.Num() > HighBudget)
+    {
+        HighTierIndices.Sort([this](int32 A, int32 B)
+        {
+            const FSignificanceEntry& EntryA = Entries[A];
+            const FSignificanceEntry& EntryB = Entries[B];
+            if (EntryA.bInCombat != EntryB.bInCombat)
+            {
+                return EntryA.bInCombat;
+            }
+            return EntryA.NearestPlayerDistance < EntryB.NearestPlayerDistance;
+        });
+
+        for (int32 Rank = HighBudget; Rank < HighTierIndices.Num(); ++Rank)
+        {
+            NewTiers[HighTierIndices[Rank]] = EHSSignificanceTier::Medium;
+        }
+    }
+
+    // 3. 바뀐 등급만 적용하고 통계 갱신
+    const float AverageDeltaTime = AccumulatedFrames > 0 ? AccumulatedDeltaTime / AccumulatedFrames : 0.0f;
+    const float FramesPerSecond = AverageDeltaTime > KINDA_SMALL_NUMBER ? 1.0f / AverageDeltaTime : 0.0f;
+    float SavedTicksPerSecond = 0.0f;
+
+    FMemory::Memzero(TierCounts, sizeof(TierCounts));
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+    {
+        FSignificanceEntry& Entry = Entries[EntryIndex];
+        if (Entry.Tier != NewTiers[EntryIndex])
+        {
+            ApplyTier(Entry, NewTiers[EntryIndex]);
+        }
+
+        ++TierCounts[static_cast<uint8>(Entry.Tier)];
+
+        // 기준 틱 빈도 대비 줄어든 틱 수 추정 (틱 간격 0은 매 프레임)
+        if (FramesPerSecond > 0.0f)
+        {
+            const float EffectiveInterval = FMath::Max(Entry.BaseTickInterval, GetTierTickInterval(Entry.Tier));
+            const float BaseRate = Entry.BaseTickInterval > 0.0f ? FMath::Min(FramesPerSecond, 1.0f / Entry.BaseTickInterval) : FramesPerSecond;
+            const float EffectiveRate = EffectiveInterval > 0.0f ? FMath::Min(FramesPerSecond, 1.0f / EffectiveInterval) : FramesPerSecond;
+            SavedTicksPerSecond += FMath::Max(0.0f, BaseRate - EffectiveRate);
+        }
+    }
+
+    EstimatedSavedMsPerFrame = FramesPerSecond > 0.0f ? SavedTicksPerSecond * PerformanceConfig.EstimatedTickCostMs / FramesPerSecond : 0.0f;
+
+    SET_DWORD_STAT(STAT_HSSignificanceHigh, TierCounts[static_cast<uint8>(EHSSignificanceTier::High)]);
+    SET_DWORD_STAT(STAT_HSSignificanceMedium, TierCounts[static_cast<uint8>(EHSSignificanceTier::Medium)]);
+    SET_DWORD_STAT(STAT_HSSignificanceLow, TierCounts[static_cast<uint8>(EHSSignificanceTier::Low)]);
+    SET_DWORD_STAT(STAT_HSSignificanceDormant, TierCounts[static_cast<uint8>(EHSSignificanceTier::Dormant)]);
+    SET_FLOAT_STAT(STAT_HSSignificanceSavedMs, EstimatedSavedMsPerFrame);
+}
+
+EHSSignificanceTier UHSSignificanceManager::ComputeDistanceTier(float Distance, EHSSignificanceTier PreviousTier) const
+{
+    const float Thresholds[3] = {
+        PerformanceConfig.SignificanceHighDistance,
+        PerformanceConfig.SignificanceMediumDistance,
+        PerformanceConfig.SignificanceLowDistance
+    };
+
+    auto TierForScale = [&Thresholds, Distance](float Scale)
+    {
+        for (int32 TierIndex = 0; TierIndex < 3; ++TierIndex)
+        {
+            if (Distance <= Thresholds[TierIndex] * Scale)
+            {
+                return static_cast<EHSSignificanceTier>(TierIndex);
+            }
+        }
+        return EHSSignificanceTier::Dormant;
+    };
+
+    const EHSSignificanceTier RawTier = TierForScale(1.0f);
+    if (static_cast<uint8>(RawTier) <= static_cast<uint8>(PreviousTier))
+    {
+        return RawTier;
+    }
+
+    // 하향은 경계를 히스테리시스만큼 넓혀서 판정하고, 이전 등급보다 올라가지는 않음
+    const EHSSignificanceTier RelaxedTier = TierForScale(1.0f + PerformanceConfig.SignificanceHysteresis);
+    return static_cast<uint8>(RelaxedTier) > static_cast<uint8>(PreviousTier) ? RelaxedTier : PreviousTier;
+}
+
+void UHSSignificanceManager::ApplyTier(FSignificanceEntry& Entry, EHSSignificanceTier NewTier) const
+{
+    Entry.Tier = NewTier;
+
+    AActor* Actor = Entry.Actor.Get();
+    if (!Actor)
+    {
+        return;
+    }
+
+    const bool bRestoreBase = NewTier == EHSSignificanceTier::High;
+
+    Actor->SetActorTickInterval(bRestoreBase ? Entry.BaseTickInterval : FMath::Max(Entry.BaseTickInterval, GetTierTickInterval(NewTier)));
+
+    switch (Entry.Category)
+    {
+        case EHSSignificanceCategory::Enemy:
+        {
+            // 애니메이션 업데이트 빈도
+            if (ACharacter* Character = Cast<ACharacter>(Actor))
+            {
+                if (USkeletalMeshComponent* Mesh = Character->GetMesh())
+                {
+                    Mesh->SetComponentTickInterval(bRestoreBase ? Entry.BaseMeshTickInterval : FMath::Max(Entry.BaseMeshTickInterval, GetTierAnimationInterval(NewTier)));
+                }
+            }
+
+            // 감지 빈도
+            if (UPawnSensingComponent* Sensing = Actor->FindComponentByClass<UPawnSensingComponent>())
+            {
+                Sensing->SetSensingInterval(bRestoreBase ? Entry.BasePerceptionInterval : FMath::Max(Entry.BasePerceptionInterval, GetTierPerceptionInterval(NewTier)));
+            }
+            break;
+        }
+
+        case EHSSignificanceCategory::AIController:
+        {
+            // AI 인지 컴포넌트는 감지 간격을 노출하지 않으므로 Dormant 등급에서 시야 감지를 끔
+            if (AAIController* AIController = Cast<AAIController>(Actor))
+            {
+                if (UAIPerceptionComponent* Perception = AIController->GetAIPerceptionComponent())
+                {
+                    Perception->SetSenseEnabled(UAISense_Sight::StaticClass(), NewTier != EHSSignificanceTier::Dormant);
+                }
+            }
+            break;
+        }
+
+        case EHSSignificanceCategory::Projectile:
+        default:
+            break;
+    }
+}
+
+float UHSSignificanceManager::GetTierTickInterval(EHSSignificanceTier Tier) const
+{
+    switch (Tier)
+    {
+        case EHSSignificanceTier::Medium:   return PerformanceConfig.MediumTickInterval;
+        case EHSSignificanceTier::Low:      return PerformanceConfig.LowTickInterval;
+        case EHSSignificanceTier::Dormant:  return PerformanceConfig.DormantTickInterval;
+        default:                            return 0.0f;
+    }
+}
+
+float UHSSignificanceManager::GetTierAnimationInterval(EHSSignificanceTier Tier) const
+{
+    switch (Tier)
+    {
+        case EHSSignificanceTier::Medium:   return PerformanceConfig.MediumAnimationInterval;
+        case EHSSignificanceTier::Low:      return PerformanceConfig.LowAnimationInterval;
+        case EHSSignificanceTier::Dormant:  return PerformanceConfig.DormantAnimationInterval;
+        default:                            return 0.0f;
+    }
+}
+
+float UHSSignificanceManager::GetTierPerceptionInterval(EHSSignificanceTier Tier) const
+{
+    switch (Tier)
+    {
+        case EHSSignificanceTier::Medium:   return PerformanceConfig.MediumPerceptionInterval;
+        case EHSSignificanceTier::Low:      return PerformanceConfig.LowPerceptionInterval;
+        case EHSSignificanceTier::Dormant:  return PerformanceConfig.DormantPerceptionInterval;
+        default:                            return 0.0f;
+    }
+}
+
+AActor* UHSSignificanceManager::GetReferenceActor(const FSignificanceEntry& Entry)
+{
+    AActor* Actor = Entry.Actor.Get();
+    if (Entry.Category == EHSSignificanceCategory::AIController)
+    {
+        const AController* Controller = Cast<AController>(Actor);
+        return Controller ? Controller->GetPawn() : nullptr;
+    }
+    return Actor;
+}
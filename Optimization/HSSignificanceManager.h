@@ -0,0 +1,137 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 중요도 기반 틱 관리자
+// 플레이어와의 관련도에 따라 적/발사체/AI 컨트롤러의 틱·애니메이션·감지 빈도를 조절
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HuntingSpirit/Networking/DedicatedServer/HSServerConfig.h"
+#include "HSSignificanceManager.generated.h"
+
+class APawn;
+
+// 중요도 등급 (위에서부터 중요)
+UENUM(BlueprintType)
+enum class EHSSignificanceTier : uint8
+{
+    High        UMETA(DisplayName = "High"),
+    Medium      UMETA(DisplayName = "Medium"),
+    Low         UMETA(DisplayName = "Low"),
+    Dormant     UMETA(DisplayName = "Dormant")
+};
+
+// 등록 대상 분류 (등급 적용 방식이 다름)
+UENUM(BlueprintType)
+enum class EHSSignificanceCategory : uint8
+{
+    Enemy           UMETA(DisplayName = "Enemy"),
+    Projectile      UMETA(DisplayName = "Projectile"),
+    AIController    UMETA(DisplayName = "AI Controller")
+};
+
+// 플레이어 위치 색인 항목 (프레임 단위로 캐시되어 여러 시스템이 공유)
+struct FHSPlayerLocationEntry
+{
+    TWeakObjectPtr<APawn> Pawn;
+    FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * 중요도 기반 틱 관리자
+ * - 가장 가까운 플레이어와의 거리, 화면 표시 여부, 전투 참여 여부로 등급을 산정
+ * - 등급 하향에는 경계 히스테리시스를 적용해 경계 부근의 잦은 전환을 방지
+ * - 등급별 액터 틱 간격, 메시(애니메이션) 틱 간격, 감지 간격을 적용 (등급이 바뀔 때만)
+ * - 예산(High 등급 최대 수)과 간격은 서버 설정의 Performance 항목에서 읽음
+ * - 플레이어 위치 색인을 프레임당 한 번만 만들어 보스 교전 판정 등 다른 시스템과 공유
+ */
+UCLASS()
+class HUNTINGSPIRIT_API UHSSignificanceManager : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem 인터페이스
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject 인터페이스
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * 액터를 중요도 관리 대상으로 등록합니다 (등록 시점의 틱 간격을 High 등급 기준값으로 사용)
+     */
+    void RegisterActor(AActor* Actor, EHSSignificanceCategory Category);
+
+    /**
+     * 액터를 관리 대상에서 제외하고 기준 틱 설정으로 되돌립니다
+     */
+    void UnregisterActor(AActor* Actor);
+
+    /**
+     * 플레이어 폰 위치 목록을 반환합니다 (같은 프레임에서는 캐시된 목록을 재사용)
+     */
+    const TArray<FHSPlayerLocationEntry>& GetPlayerLocations();
+
+    // 통계
+    UFUNCTION(BlueprintPure, Category = "Significance")
+    int32 GetTierActorCount(EHSSignificanceTier Tier) const;
+
+    UFUNCTION(BlueprintPure, Category = "Significance")
+    EHSSignificanceTier GetActorTier(const AActor* Actor) const;
+
+    int32 GetRegisteredActorCount() const { return Entries.Num(); }
+
+    // 줄어든 틱 수 x 설정값 EstimatedTickCostMs로 계산한 추정치 (실측 아님, 실제 절감은 stat game/Insights로 확인)
+    float GetEstimatedSavedMsPerFrame() const { return EstimatedSavedMsPerFrame; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FSignificanceEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        TObjectKey<AActor> ActorKey;
+        EHSSignificanceCategory Category = EHSSignificanceCategory::Enemy;
+        EHSSignificanceTier Tier = EHSSignificanceTier::High;
+        float NearestPlayerDistance = 0.0f;
+        bool bInCombat = false;
+
+        // 등록 시점 기준값 (High 등급에서 복원)
+        float BaseTickInterval = 0.0f;
+        float BaseMeshTickInterval = 0.0f;
+        float BasePerceptionInterval = 0.0f;
+    };
+
+    void RefreshConfig();
+    void EvaluateSignificance();
+    void RemoveEntryAt(int32 EntryIndex);
+
+    EHSSignificanceTier ComputeDistanceTier(float Distance, EHSSignificanceTier PreviousTier) const;
+    void ApplyTier(FSignificanceEntry& Entry, EHSSignificanceTier NewTier) const;
+
+    float GetTierTickInterval(EHSSignificanceTier Tier) const;
+    float GetTierAnimationInterval(EHSSignificanceTier Tier) const;
+    float GetTierPerceptionInterval(EHSSignificanceTier Tier) const;
+
+    static AActor* GetReferenceActor(const FSignificanceEntry& Entry);
+
+    TArray<FSignificanceEntry> Entries;
+    TMap<TObjectKey<AActor>, int32> EntryIndexByActor;
+
+    // 플레이어 위치 색인 (PlayerLocationsFrame 프레임에 갱신됨)
+    TArray<FHSPlayerLocationEntry> PlayerLocations;
+    uint64 PlayerLocationsFrame = MAX_uint64;
+
+    // 서버 설정에서 가져온 성능 설정 (설정이 없으면 기본값)
+    FHSPerformanceConfig PerformanceConfig;
+
+    float TimeSinceLastEvaluation = 0.0f;
+    float AccumulatedDeltaTime = 0.0f;
+    int32 AccumulatedFrames = 0;
+
+    // 통계
+    int32 TierCounts[4] = { 0, 0, 0, 0 };
+    float EstimatedSavedMsPerFrame = 0.0f;
+};
@@ -0,0 +1,215 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 주기 작업 스케줄러 구현
+
+#include "HSThrottledTaskScheduler.h"
+#include "Engine/World.h"
+#include "Stats/Stats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Throttled Tasks Run"), STAT_HSThrottledTasksRun, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Throttled Tasks Deferred"), STAT_HSThrottledTasksDeferred, STATGROUP_Game);
+
+namespace HSThrottledTaskSchedulerConstants
+{
+    // 황금비 켤레 - 순번에 곱한 소수부가 [0, 1)에 고르게 분포
+    static constexpr float GoldenRatioConjugate = 0.6180339887f;
+}
+
+void UHSThrottledTaskScheduler::Deinitialize()
+{
+    Tasks.Empty();
+    TaskIdsByOwner.Empty();
+    Schedule.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UHSThrottledTaskScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHSThrottledTaskScheduler::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHSThrottledTaskScheduler, STATGROUP_Tickables);
+}
+
+FHSThrottledTaskHandle UHSThrottledTaskScheduler::RegisterTask(UObject* Owner, float Interval, FHSThrottledTaskDelegate Task)
+{
+    FHSThrottledTaskHandle Handle;
+
+    UWorld* World = GetWorld();
+    if (!World || !IsValid(Owner) || Interval <= 0.0f || !Task.IsBound())
+    {
+        return Handle;
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+
+    // 등록 순번 기반 위상 오프셋으로 첫 실행 시각을 주기 안에 분산
+    ++PhaseSequence;
+    const float PhaseFraction = FMath::Frac(PhaseSequence * HSThrottledTaskSchedulerConstants::GoldenRatioConjugate);
+
+    Handle.TaskId = NextTaskId++;
+    if (NextTaskId == 0)
+    {
+        NextTaskId = 1;
+    }
+
+    FThrottledTask& NewTask = Tasks.Add(Handle.TaskId);
+    NewTask.Owner = Owner;
+    NewTask.OwnerKey = Owner;
+    NewTask.Delegate = MoveTemp(Task);
+    NewTask.Interval = Interval;
+    NewTask.NextRunTime = CurrentTime + Interval * PhaseFraction;
+    NewTask.LastRunTime = CurrentTime;
+    TaskIdsByOwner.FindOrAdd(NewTask.OwnerKey).Add(Handle.TaskId);
+
+    Schedule.HeapPush({ NewTask.NextRunTime, Handle.TaskId }, FScheduleEntryPredicate());
+
+    return Handle;
+}
+
+void UHSThrottledTaskScheduler::UnregisterTask(FHSThrottledTaskHandle& Handle)
+{
+    if (Handle.IsValid())
+    {
+        // 힙 항목은 꺼낼 때 무효 처리되므로 작업만 제거
+        RemoveTask(Handle.TaskId);
+        Handle.Invalidate();
+    }
+}
+
+void UHSThrottledTaskScheduler::UnregisterAllTasks(const UObject* Owner)
+{
+    TArray<uint32> OwnerTaskIds;
+    if (!TaskIdsByOwner.RemoveAndCopyValue(TObjectKey<UObject>(Owner), OwnerTaskIds))
+    {
+        return;
+    }
+
+    for (const uint32 TaskId : OwnerTaskIds)
+    {
+        Tasks.Remove(TaskId);
+    }
+}
+
+void UHSThrottledTaskScheduler::RemoveTask(uint32 TaskId)
+{
+    FThrottledTask RemovedTask;
+    if (!Tasks.RemoveAndCopyValue(TaskId, RemovedTask))
+    {
+        return;
+    }
+
+    if (TArray<uint32>* OwnerTaskIds = TaskIdsByOwner.Find(RemovedTask.OwnerKey))
+    {
+        OwnerTaskIds->RemoveSwap(TaskId);
+        if (OwnerTaskIds->Num() == 0)
+        {
+            TaskIdsByOwner.Remove(RemovedTask.OwnerKey);
+        }
+    }
+}
+
+bool UHSThrottledTaskScheduler::IsEntryValid(const FScheduleEntry& Entry) const
+{
+    const FThrottledTask* Task = Tasks.Find(Entry.TaskId);
+    return Task && Task->NextRunTime == Entry.RunTime;
+}
+
+int32 UHSThrottledTaskScheduler::CountDueEntries(float CurrentTime) const
+{
+    // 최소 힙에서 부모가 도래하지 않았으면 자식도 도래하지 않았으므로
+    // 도래한 항목과 그 경계 자식만 방문 (전체 힙이 아닌 이월 작업 수에 비례)
+    int32 DueCount = 0;
+    TArray<int32, TInlineAllocator<64>> PendingIndices;
+    if (Schedule.Num() > 0)
+    {
+        PendingIndices.Add(0);
+    }
+
+    while (PendingIndices.Num() > 0)
+    {
+        const int32 Index = PendingIndices.Pop(false);
+        const FScheduleEntry& Entry = Schedule[Index];
+        if (Entry.RunTime > CurrentTime)
+        {
+            continue;
+        }
+
+        if (IsEntryValid(Entry))
+        {
+            ++DueCount;
+        }
+
+        const int32 LeftChild = Index * 2 + 1;
+        if (LeftChild < Schedule.Num())
+        {
+            PendingIndices.Add(LeftChild);
+        }
+        if (LeftChild + 1 < Schedule.Num())
+        {
+            PendingIndices.Add(LeftChild + 1);
+        }
+    }
+
+    return DueCount;
+}
+
+void UHSThrottledTaskScheduler::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    LastFrameTaskCount = 0;
+    LastFrameDeferredCount = 0;
+
+    UWorld* World = GetWorld();
+    if (!World || Schedule.Num() == 0)
+    {
+        return;
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+
+    while (Schedule.Num() > 0 && Schedule.HeapTop().RunTime <= CurrentTime)
+    {
+        if (MaxTasksPerFrame > 0 && LastFrameTaskCount >= MaxTasksPerFrame)
+        {
+            // 상한 초과분은 힙에 그대로 두고 다음 프레임에 먼저 실행
+            LastFrameDeferredCount = CountDueEntries(CurrentTime);
+            break;
+        }
+
+        FScheduleEntry Entry;
+        Schedule.HeapPop(Entry, FScheduleEntryPredicate(), false);
+
+        FThrottledTask* Task = Tasks.Find(Entry.TaskId);
+        if (!Task || Task->NextRunTime != Entry.RunTime)
+        {
+            continue;
+        }
+
+        if (!Task->Owner.IsValid() || !Task->Delegate.IsBound())
+        {
+            RemoveTask(Entry.TaskId);
+            continue;
+        }
+
+        const float ElapsedSinceLastRun = CurrentTime - Task->LastRunTime;
+        Task->LastRunTime = CurrentTime;
+
+        // 위상을 유지한 채 다음 주기로 이동 (오래 밀렸으면 놓친 주기는 건너뜀)
+        const int32 MissedIntervals = FMath::FloorToInt((CurrentTime - Task->NextRunTime) / Task->Interval);
+        Task->NextRunTime += Task->Interval * (MissedIntervals + 1);
+        Schedule.HeapPush({ Task->NextRunTime, Entry.TaskId }, FScheduleEntryPredicate());
+
+        // 콜백 안에서 등록/해제가 일어날 수 있으므로 복사 후 실행
+        const FHSThrottledTaskDelegate Delegate = Task->Delegate;
+        Delegate.Execute(ElapsedSinceLastRun);
+        ++LastFrameTaskCount;
+    }
+
+    PeakFrameTaskCount = FMath::Max(PeakFrameTaskCount, LastFrameTaskCount);
+
+    SET_DWORD_STAT(STAT_HSThrottledTasksRun, LastFrameTaskCount);
+    SET_DWORD_STAT(STAT_HSThrottledTasksDeferred, LastFrameDeferredCount);
+}
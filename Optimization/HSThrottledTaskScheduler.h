@@ -0,0 +1,123 @@
+// 사냥의 영혼(HuntingSpirit) 게임의 주기 작업 스케줄러
+// 인스턴스별 주기 유지보수 작업을 위상 분산시켜 프레임에 고르게 배치
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HSThrottledTaskScheduler.generated.h"
+
+// 주기 작업 콜백 (마지막 실행 이후 경과 시간 전달)
+DECLARE_DELEGATE_OneParam(FHSThrottledTaskDelegate, float /* ElapsedSinceLastRun */);
+
+// 등록된 주기 작업 핸들
+struct HUNTINGSPIRIT_API FHSThrottledTaskHandle
+{
+    uint32 TaskId = 0;
+
+    bool IsValid() const { return TaskId != 0; }
+    void Invalidate() { TaskId = 0; }
+};
+
+/**
+ * 주기 작업 스케줄러
+ * - 함수 내 static 누적 타이머를 대체하는 소유자별 주기 작업 등록
+ * - 같은 주기의 작업들은 황금비 수열로 위상을 분산해 한 프레임에 몰리지 않게 함
+ * - 다음 실행 시각 기준 최소 힙으로 도래한 작업만 꺼내 실행
+ * - 프레임당 실행 상한을 넘는 작업은 다음 프레임으로 이월
+ */
+UCLASS()
+class HUNTINGSPIRIT_API UHSThrottledTaskScheduler : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem 인터페이스
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject 인터페이스
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * 주기 작업을 등록합니다
+     * @param Owner 작업 소유자 (소멸 시 작업 자동 제거)
+     * @param Interval 실행 주기 (초)
+     * @param Task 실행할 콜백
+     * @return 작업 핸들 (주기가 0 이하이거나 콜백이 비어 있으면 무효 핸들)
+     */
+    FHSThrottledTaskHandle RegisterTask(UObject* Owner, float Interval, FHSThrottledTaskDelegate Task);
+
+    /**
+     * 주기 작업을 해제하고 핸들을 무효화합니다
+     */
+    void UnregisterTask(FHSThrottledTaskHandle& Handle);
+
+    /**
+     * 특정 소유자의 모든 주기 작업을 해제합니다
+     */
+    void UnregisterAllTasks(const UObject* Owner);
+
+    // 통계
+    int32 GetRegisteredTaskCount() const { return Tasks.Num(); }
+    int32 GetLastFrameTaskCount() const { return LastFrameTaskCount; }
+    int32 GetLastFrameDeferredCount() const { return LastFrameDeferredCount; }
+    int32 GetPeakFrameTaskCount() const { return PeakFrameTaskCount; }
+
+    // 프레임당 최대 실행 작업 수 (0이면 제한 없음)
+    int32 MaxTasksPerFrame = 32;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FThrottledTask
+    {
+        TWeakObjectPtr<UObject> Owner;
+        TObjectKey<UObject> OwnerKey;
+        FHSThrottledTaskDelegate Delegate;
+        float Interval = 0.0f;
+        float NextRunTime = 0.0f;
+        float LastRunTime = 0.0f;
+    };
+
+    // 다음 실행 시각 힙 항목 (해제/재예약된 작업의 이전 항목은 꺼낼 때 무시)
+    struct FScheduleEntry
+    {
+        float RunTime = 0.0f;
+        uint32 TaskId = 0;
+    };
+
+    struct FScheduleEntryPredicate
+    {
+        bool operator()(const FScheduleEntry& A, const FScheduleEntry& B) const
+        {
+            return A.RunTime < B.RunTime || (A.RunTime == B.RunTime && A.TaskId < B.TaskId);
+        }
+    };
+
+    bool IsEntryValid(const FScheduleEntry& Entry) const;
+
+    // 실행 시각이 도래한 유효 항목 수 (도래하지 않은 노드의 하위 트리는 방문하지 않음)
+    int32 CountDueEntries(float CurrentTime) const;
+
+    // 작업 제거 (소유자 색인도 함께 정리)
+    void RemoveTask(uint32 TaskId);
+
+    TMap<uint32, FThrottledTask> Tasks;
+
+    // 소유자별 작업 ID (소유자 단위 해제용)
+    TMap<TObjectKey<UObject>, TArray<uint32>> TaskIdsByOwner;
+    TArray<FScheduleEntry> Schedule;
+
+    uint32 NextTaskId = 1;
+
+    // 위상 분산용 등록 순번
+    uint32 PhaseSequence = 0;
+
+    // 프레임 통계
+    int32 LastFrameTaskCount = 0;
+    int32 LastFrameDeferredCount = 0;
+    int32 PeakFrameTaskCount = 0;
+};
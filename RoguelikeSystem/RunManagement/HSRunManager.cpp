@@ -4,7 +4,9 @@
 #include "Engine/LocalPlayer.h"
 #include "TimerManager.h"
 #include "Containers/Set.h"
+#include "GameFramework/GameModeBase.h"
 #include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
 #include "OnlineSubsystemTypes.h"
@@ -64,17 +66,24 @@ void UHSRunManager::Initialize(FSubsystemCollectionBase& Collection)
     CurrentRun = FHSRunData();
     CurrentRun.State = EHSRunState::None;
     
+    // 참가자 연결 상태는 폴링 대신 로그인/로그아웃 이벤트로 추적
+    PostLoginDelegateHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &UHSRunManager::HandlePostLogin);
+    LogoutDelegateHandle = FGameModeEvents::GameModeLogoutEvent.AddUObject(this, &UHSRunManager::HandleLogout);
+    
     UE_LOG(LogTemp, Log, TEXT("HSRunManager 초기화 완료"));
 }
 
 void UHSRunManager::Deinitialize()
 {
+    FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginDelegateHandle);
+    FGameModeEvents::GameModeLogoutEvent.Remove(LogoutDelegateHandle);
+    
     // 활성화된 타이머들 정리
     if (UWorld* World = GetWorld())
     {
-        if (RunUpdateTimerHandle.IsValid())
+        if (TimeLimitTimerHandle.IsValid())
         {
-            World->GetTimerManager().ClearTimer(RunUpdateTimerHandle);
+            World->GetTimerManager().ClearTimer(TimeLimitTimerHandle);
         }
         if (StatisticsTimerHandle.IsValid())
         {
@@ -117,8 +126,11 @@ bool UHSRunManager::StartNewRun(const FHSRunConfiguration& Configuration)
     // 타이머 시작
     if (UWorld* World = GetWorld())
     {
-        // 런 업데이트 타이머 (매 프레임)
-        World->GetTimerManager().SetTimer(RunUpdateTimerHandle, this, &UHSRunManager::UpdateRunProgress, 0.1f, true);
+        // 시간 제한 타이머 (월드 시간 기준 일회성, 일시정지 중에는 멈춤)
+        if (CurrentRun.Configuration.TimeLimit > 0.0f)
+        {
+            World->GetTimerManager().SetTimer(TimeLimitTimerHandle, this, &UHSRunManager::HandleTimeLimitReached, CurrentRun.Configuration.TimeLimit, false);
+        }
         
         // 통계 업데이트 타이머
         World->GetTimerManager().SetTimer(StatisticsTimerHandle, this, &UHSRunManager::UpdateStatistics, StatisticsUpdateInterval, true);
@@ -153,9 +165,9 @@ void UHSRunManager::EndCurrentRun(EHSRunResult Result)
     // 타이머 정리
     if (UWorld* World = GetWorld())
     {
-        if (RunUpdateTimerHandle.IsValid())
+        if (TimeLimitTimerHandle.IsValid())
         {
-            World->GetTimerManager().ClearTimer(RunUpdateTimerHandle);
+            World->GetTimerManager().ClearTimer(TimeLimitTimerHandle);
         }
         if (StatisticsTimerHandle.IsValid())
         {
@@ -183,7 +195,7 @@ void UHSRunManager::PauseCurrentRun()
         // 타이머 일시정지
         if (UWorld* World = GetWorld())
         {
-            World->GetTimerManager().PauseTimer(RunUpdateTimerHandle);
+            World->GetTimerManager().PauseTimer(TimeLimitTimerHandle);
             World->GetTimerManager().PauseTimer(StatisticsTimerHandle);
         }
         
@@ -200,7 +212,7 @@ void UHSRunManager::ResumeCurrentRun()
         // 타이머 재개
         if (UWorld* World = GetWorld())
         {
-            World->GetTimerManager().UnPauseTimer(RunUpdateTimerHandle);
+            World->GetTimerManager().UnPauseTimer(TimeLimitTimerHandle);
             World->GetTimerManager().UnPauseTimer(StatisticsTimerHandle);
         }
         
@@ -239,7 +251,9 @@ float UHSRunManager::GetRunProgress() const
         return 0.0f;
     }
     
-    float ElapsedTime = (FDateTime::Now() - CurrentRun.StartTime).GetTotalSeconds();
+    // 시간 제한 타이머의 경과 시간 기준 (월드 시간)
+    const UWorld* World = GetWorld();
+    const float ElapsedTime = World ? World->GetTimerManager().GetTimerElapsed(TimeLimitTimerHandle) : 0.0f;
     return FMath::Clamp(ElapsedTime / CurrentRun.Configuration.TimeLimit, 0.0f, 1.0f);
 }
 
@@ -488,83 +502,83 @@ void UHSRunManager::ChangeRunState(EHSRunState NewState)
     }
 }
 
-void UHSRunManager::UpdateRunProgress()
+void UHSRunManager::HandleTimeLimitReached()
 {
-    if (!IsRunActive())
+    if (IsRunActive())
     {
-        return;
+        EndCurrentRun(EHSRunResult::Timeout);
     }
-    
-    // 시간 제한 확인
-    if (CurrentRun.Configuration.TimeLimit > 0.0f)
+}
+
+void UHSRunManager::HandlePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+    // 로그인 시점에는 고유 ID가 확정되어 있으므로 추가 시 기록한 식별자를 갱신
+    if (GameMode && GameMode->GetWorld() == GetWorld() && NewPlayer)
     {
-        float ElapsedTime = (FDateTime::Now() - CurrentRun.StartTime).GetTotalSeconds();
-        if (ElapsedTime >= CurrentRun.Configuration.TimeLimit)
-        {
-            EndCurrentRun(EHSRunResult::Timeout);
-            return;
-        }
+        NotifyPlayerStateAdded(NewPlayer->GetPlayerState<APlayerState>());
     }
+}
 
-    if (CurrentRun.ParticipantIDs.Num() > 0)
+void UHSRunManager::HandleLogout(AGameModeBase* GameMode, AController* Exiting)
+{
+    if (GameMode && GameMode->GetWorld() == GetWorld() && Exiting)
     {
-        TSet<FString> ConnectedPlayerIds;
+        NotifyPlayerStateRemoved(Exiting->GetPlayerState<APlayerState>());
+    }
+}
 
-        if (UWorld* World = GetWorld())
-        {
-            if (AGameStateBase* GameState = World->GetGameState())
-            {
-                for (APlayerState* PlayerState : GameState->PlayerArray)
-                {
-                    const FString Identifier = BuildPlayerIdentifier(PlayerState);
-                    if (!Identifier.IsEmpty())
-                    {
-                        ConnectedPlayerIds.Add(Identifier);
-                    }
-                }
-            }
-        }
+void UHSRunManager::NotifyPlayerStateAdded(APlayerState* PlayerState)
+{
+    const FString Identifier = BuildPlayerIdentifier(PlayerState);
+    if (Identifier.IsEmpty())
+    {
+        return;
+    }
 
-        if (ConnectedPlayerIds.Num() == 0)
-        {
-            if (UGameInstance* GameInstance = GetGameInstance())
-            {
-                for (ULocalPlayer* LocalPlayer : GameInstance->GetLocalPlayers())
-                {
-                    const FString Identifier = BuildLocalPlayerIdentifier(LocalPlayer);
-                    if (!Identifier.IsEmpty())
-                    {
-                        ConnectedPlayerIds.Add(Identifier);
-                    }
-                }
-            }
-        }
+    const FName ParticipantName(*Identifier);
+    ConnectedPlayerIds.Add(PlayerState, ParticipantName);
 
-        if (ConnectedPlayerIds.Num() > 0)
-        {
-            for (const FString& Identifier : ConnectedPlayerIds)
-            {
-                if (!CurrentRun.ParticipantIDs.Contains(Identifier))
-                {
-                    CurrentRun.ParticipantIDs.Add(Identifier);
-                }
-            }
+    // 런 도중 합류한 플레이어도 참가자로 기록
+    if (IsRunActive() && !ParticipantNames.Contains(ParticipantName))
+    {
+        ParticipantNames.Add(ParticipantName);
+        CurrentRun.ParticipantIDs.Add(Identifier);
+    }
+}
 
-            for (const FString& ParticipantId : CurrentRun.ParticipantIDs)
-            {
-                if (ParticipantId.Equals(TEXT("LocalPlayer")))
-                {
-                    continue;
-                }
+void UHSRunManager::NotifyPlayerStateRemoved(APlayerState* PlayerState)
+{
+    // 로그아웃과 플레이어 상태 제거가 모두 호출되므로 처음 한 번만 처리
+    FName RecordedName;
+    if (!PlayerState || !ConnectedPlayerIds.RemoveAndCopyValue(PlayerState, RecordedName))
+    {
+        return;
+    }
 
-                if (!ConnectedPlayerIds.Contains(ParticipantId))
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("런 참가자 연결 끊김 감지: %s"), *ParticipantId);
-                    EndCurrentRun(EHSRunResult::Disconnection);
-                    return;
-                }
-            }
-        }
+    if (!IsRunActive())
+    {
+        return;
+    }
+
+    // 월드 정리 중 제거는 연결 끊김이 아님
+    const UWorld* World = GetWorld();
+    if (!World || World->bIsTearingDown)
+    {
+        return;
+    }
+
+    // 추가 시점 식별자와 현재 식별자 중 하나라도 참가자면 연결 끊김
+    bool bWasParticipant = ParticipantNames.Contains(RecordedName);
+    if (!bWasParticipant)
+    {
+        const FString CurrentIdentifier = BuildPlayerIdentifier(PlayerState);
+        bWasParticipant = !CurrentIdentifier.IsEmpty() && ParticipantNames.Contains(FName(*CurrentIdentifier));
+    }
+
+    if (bWasParticipant)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("런 참가자 연결 끊김 감지: %s"), *RecordedName.ToString());
+        EndCurrentRun(EHSRunResult::Disconnection);
     }
 }
 
@@ -593,9 +607,12 @@ void UHSRunManager::InitializeRunData(const FHSRunConfiguration& Configuration)
     CurrentRun.ElapsedTime = 0.0f;
     
     CurrentRun.ParticipantIDs.Empty();
+    ParticipantNames.Reset();
+    ConnectedPlayerIds.Reset();
 
     TSet<FString> UniqueParticipants;
 
+    // 현재 접속 중인 플레이어로 연결 상태를 다시 구성 (이후에는 이벤트로 갱신)
     if (UWorld* World = GetWorld())
     {
         if (AGameStateBase* GameState = World->GetGameState())
@@ -606,6 +623,7 @@ void UHSRunManager::InitializeRunData(const FHSRunConfiguration& Configuration)
                 if (!Identifier.IsEmpty())
                 {
                     UniqueParticipants.Add(Identifier);
+                    ConnectedPlayerIds.Add(PlayerState, FName(*Identifier));
                 }
             }
         }
@@ -626,6 +644,7 @@ void UHSRunManager::InitializeRunData(const FHSRunConfiguration& Configuration)
     for (const FString& ParticipantId : UniqueParticipants)
     {
         CurrentRun.ParticipantIDs.Add(ParticipantId);
+        ParticipantNames.Add(FName(*ParticipantId));
     }
 
     if (CurrentRun.ParticipantIDs.Num() == 0)
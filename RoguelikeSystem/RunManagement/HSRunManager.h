@@ -4,8 +4,14 @@
 #include "Engine/World.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
+#include "UObject/ObjectKey.h"
 #include "HSRunManager.generated.h"
 
+class AController;
+class AGameModeBase;
+class APlayerController;
+class APlayerState;
+
 // 런 상태 열거형
 UENUM(BlueprintType)
 enum class EHSRunState : uint8
@@ -414,6 +420,18 @@ public:
     UFUNCTION(BlueprintPure, Category = "Rewards")
     float GetCooperationBonus() const;
 
+    // 참가자 추적
+    
+    /**
+     * 플레이어 상태 추가를 알립니다 (게임 스테이트에서 호출)
+     */
+    void NotifyPlayerStateAdded(APlayerState* PlayerState);
+
+    /**
+     * 플레이어 상태 제거를 알립니다 (게임 스테이트에서 호출, 참가자였다면 연결 끊김으로 런 종료)
+     */
+    void NotifyPlayerStateRemoved(APlayerState* PlayerState);
+
     // 델리게이트
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnRunStateChanged OnRunStateChanged;
@@ -434,7 +452,7 @@ protected:
     float StatisticsUpdateInterval = 1.0f;
 
     // 타이머 핸들들
-    FTimerHandle RunUpdateTimerHandle;
+    FTimerHandle TimeLimitTimerHandle;
     FTimerHandle StatisticsTimerHandle;
 
 private:
@@ -446,9 +464,15 @@ private:
     void ChangeRunState(EHSRunState NewState);
 
     /**
-     * 런 업데이트를 처리합니다
+     * 시간 제한 도달 시 런을 종료합니다 (일회성 타이머 콜백)
+     */
+    void HandleTimeLimitReached();
+
+    /**
+     * 게임 모드 로그인/로그아웃 이벤트를 처리합니다
      */
-    void UpdateRunProgress();
+    void HandlePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+    void HandleLogout(AGameModeBase* GameMode, AController* Exiting);
 
     /**
      * 통계 업데이트를 처리합니다
@@ -472,4 +496,12 @@ private:
     mutable EHSRunDifficulty CachedDifficulty = EHSRunDifficulty::Normal;
     mutable float CachedCooperationBonus = 1.0f;
     mutable int32 CachedCooperativeActions = -1;
+
+    /**
+     * 참가자 추적 데이터 (식별자는 FName으로 인턴해 비교)
+     */
+    TMap<TObjectKey<APlayerState>, FName> ConnectedPlayerIds;
+    TSet<FName> ParticipantNames;
+    FDelegateHandle PostLoginDelegateHandle;
+    FDelegateHandle LogoutDelegateHandle;
 };
@@ -0,0 +1,132 @@
+// HSBossAbilityTargetingTests.cpp
+// 보스 능력 AoE 중심 탐색 자동화 테스트
+// 격자 분할 클러스터링 결과를 O(n²) 전수 탐색과 비교하고 4/32/128 타겟에서 비용 측정
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Tests/HSTestWorld.h"
+#include "HuntingSpirit/Enemies/Bosses/HSBossAbilitySystem.h"
+#include "Engine/StaticMeshActor.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSBossAbilityTargetingTests
+{
+    constexpr float AreaRadius = 300.0f;
+    constexpr int32 IterationsPerCase = 200;
+
+    int32 CountCovered(const TArray<AActor*>& Targets, const FVector& Center, float Radius)
+    {
+        int32 Count = 0;
+        for (const AActor* Target : Targets)
+        {
+            if (FVector::DistSquared(Target->GetActorLocation(), Center) <= FMath::Square(Radius))
+            {
+                ++Count;
+            }
+        }
+        return Count;
+    }
+
+    // 기존 방식: 모든 타겟 위치를 후보로 두고 다른 모든 타겟과 비교
+    int32 BruteForceBestCoverage(const TArray<AActor*>& Targets, float Radius)
+    {
+        int32 BestCount = 0;
+        for (const AActor* Candidate : Targets)
+        {
+            BestCount = FMath::Max(BestCount, CountCovered(Targets, Candidate->GetActorLocation(), Radius));
+        }
+        return BestCount;
+    }
+
+    // 플레이어 4명 주변에 소환수가 뭉쳐 있는 전투 배치를 흉내내 클러스터 몇 개에 타겟을 분산
+    void SpawnClusteredTargets(FHSScopedTestWorld& TestWorld, int32 TargetCount, FRandomStream& Random, TArray<AActor*>& OutTargets)
+    {
+        const int32 ClusterCount = FMath::Max(1, TargetCount / 8);
+        TArray<FVector> ClusterCenters;
+        for (int32 Index = 0; Index < ClusterCount; ++Index)
+        {
+            ClusterCenters.Add(FVector(Random.FRandRange(-3000.0f, 3000.0f), Random.FRandRange(-3000.0f, 3000.0f), 0.0f));
+        }
+
+        for (int32 Index = 0; Index < TargetCount; ++Index)
+        {
+            const FVector Offset(Random.FRandRange(-400.0f, 400.0f), Random.FRandRange(-400.0f, 400.0f), 0.0f);
+            if (AStaticMeshActor* Target = TestWorld.Spawn<AStaticMeshActor>(ClusterCenters[Index % ClusterCount] + Offset))
+            {
+                OutTargets.Add(Target);
+            }
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSBossAbilityOptimalLocationTest, "HuntingSpirit.Enemies.BossAbilitySystem.OptimalAreaCenter",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSBossAbilityOptimalLocationTest::RunTest(const FString& Parameters)
+{
+    using namespace HSBossAbilityTargetingTests;
+
+    FHSScopedTestWorld TestWorld;
+    AActor* BossActor = TestWorld.Spawn<AStaticMeshActor>(FVector::ZeroVector);
+    UHSBossAbilitySystem* AbilitySystem = NewObject<UHSBossAbilitySystem>(BossActor);
+
+    FHSBossAbility Ability;
+    Ability.AbilityID = TEXT("TestAreaBlast");
+    Ability.TargetType = EHSAbilityTargetType::AreaOfEffect;
+    Ability.AreaRadius = AreaRadius;
+    Ability.MaxTargets = 128;
+
+    const int32 TargetCounts[] = { 4, 32, 128 };
+    for (const int32 TargetCount : TargetCounts)
+    {
+        FRandomStream Random(31 + TargetCount);
+        TArray<AActor*> Targets;
+        SpawnClusteredTargets(TestWorld, TargetCount, Random, Targets);
+
+        // 정확성: 전수 탐색의 최대 포함 수 이상을 포함해야 함
+        const FVector Center = AbilitySystem->GetOptimalTargetLocation(Ability, Targets);
+        const int32 GridCoverage = CountCovered(Targets, Center, AreaRadius);
+        const int32 BruteForceCoverage = BruteForceBestCoverage(Targets, AreaRadius);
+        TestTrue(FString::Printf(TEXT("%d targets: grid centre covers %d, brute force best %d"), TargetCount, GridCoverage, BruteForceCoverage),
+            GridCoverage >= BruteForceCoverage);
+
+        // 결정성: 입력 순서를 섞어도 같은 중심 (누적 순서 차이로 인한 부동소수 오차만 허용)
+        TArray<AActor*> ShuffledTargets = Targets;
+        for (int32 Index = ShuffledTargets.Num() - 1; Index > 0; --Index)
+        {
+            ShuffledTargets.Swap(Index, Random.RandRange(0, Index));
+        }
+        const FVector ShuffledCenter = AbilitySystem->GetOptimalTargetLocation(Ability, ShuffledTargets);
+        TestTrue(FString::Printf(TEXT("%d targets: centre does not depend on input order"), TargetCount), Center.Equals(ShuffledCenter, 0.01f));
+
+        // 비용 측정
+        double StartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < IterationsPerCase; ++Iteration)
+        {
+            AbilitySystem->GetOptimalTargetLocation(Ability, Targets);
+        }
+        const double GridSeconds = FPlatformTime::Seconds() - StartTime;
+
+        StartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < IterationsPerCase; ++Iteration)
+        {
+            BruteForceBestCoverage(Targets, AreaRadius);
+        }
+        const double BruteForceSeconds = FPlatformTime::Seconds() - StartTime;
+
+        AddInfo(FString::Printf(TEXT("%d targets: grid clustering %.2f us/call, O(n^2) scan %.2f us/call"),
+            TargetCount, GridSeconds * 1000000.0 / IterationsPerCase, BruteForceSeconds * 1000000.0 / IterationsPerCase));
+
+        for (AActor* Target : Targets)
+        {
+            Target->Destroy();
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,168 @@
+// HSBossEngagementTests.cpp
+// 보스 교전 플레이어 판정 자동화 테스트
+// 소환수 50마리가 있는 전투에서 진입/이탈 히스테리시스를 검증하고, 공유 플레이어 색인 기반 판정과
+// 기존 방식(AggroRange 구체 스윕 + 캐스팅 필터)의 보스당 비용, 중요도 평가 비용을 측정
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Tests/HSTestWorld.h"
+#include "HuntingSpirit/Enemies/Bosses/HSBossBase.h"
+#include "HuntingSpirit/Characters/Player/HSPlayerCharacter.h"
+#include "HuntingSpirit/Optimization/HSSignificanceManager.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSBossEngagementTests
+{
+    constexpr int32 MinionCount = 50;
+    constexpr int32 BenchmarkFrames = 600;
+    constexpr float FrameDeltaTime = 1.0f / 60.0f;
+
+    // 기존 판정: 거리로 이탈자를 지운 뒤 어그로 범위 구체 스윕으로 폰을 모두 맞히고 플레이어만 골라 목록 포함 여부를 선형 확인
+    int32 LegacySweepEngagement(UWorld* World, const AActor* Boss, float AggroRange, TArray<AActor*>& InOutEngaged)
+    {
+        const FVector BossLocation = Boss->GetActorLocation();
+        InOutEngaged.RemoveAll([&](const AActor* Player)
+        {
+            return !IsValid(Player) || FVector::Dist(BossLocation, Player->GetActorLocation()) > AggroRange;
+        });
+
+        TArray<FHitResult> HitResults;
+        FCollisionQueryParams QueryParams;
+        QueryParams.AddIgnoredActor(Boss);
+
+        World->SweepMultiByChannel(HitResults, BossLocation, BossLocation, FQuat::Identity,
+            ECC_Pawn, FCollisionShape::MakeSphere(AggroRange), QueryParams);
+
+        for (const FHitResult& Hit : HitResults)
+        {
+            if (AHSPlayerCharacter* Player = Cast<AHSPlayerCharacter>(Hit.GetActor()))
+            {
+                if (!InOutEngaged.Contains(Player))
+                {
+                    InOutEngaged.Add(Player);
+                }
+            }
+        }
+        return HitResults.Num();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSBossEngagementMinionLoadTest, "HuntingSpirit.Enemies.BossBase.EngagementWithMinions",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSBossEngagementMinionLoadTest::RunTest(const FString& Parameters)
+{
+    using namespace HSBossEngagementTests;
+
+    FHSScopedTestWorld TestWorld;
+    UWorld* World = TestWorld.Get();
+    UHSSignificanceManager* SignificanceManager = World->GetSubsystem<UHSSignificanceManager>();
+    AHSBossBase* Boss = TestWorld.Spawn<AHSBossBase>(FVector::ZeroVector);
+    if (!TestNotNull(TEXT("Significance manager available"), SignificanceManager) || !TestNotNull(TEXT("Boss spawned"), Boss))
+    {
+        return false;
+    }
+
+    const float AggroRange = Boss->AggroRange;
+    const float ExitRange = AggroRange * Boss->EngagementExitRangeMultiplier;
+
+    // 소환수는 모두 어그로 범위 안에 배치 (기존 스윕이 매번 맞히던 대상)
+    FRandomStream Random(44);
+    for (int32 Index = 0; Index < MinionCount; ++Index)
+    {
+        const FVector Location = FVector(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f).GetSafeNormal2D()
+            * Random.FRandRange(300.0f, AggroRange * 0.9f);
+        if (AHSEnemyBase* Minion = TestWorld.Spawn<AHSEnemyBase>(Location))
+        {
+            SignificanceManager->RegisterActor(Minion, EHSSignificanceCategory::Enemy);
+        }
+    }
+
+    // 플레이어 4명: 범위 안 2명, 진입/이탈 거리 사이 1명, 멀리 1명
+    const FVector PlayerLocations[] = {
+        FVector(AggroRange * 0.5f, 0.0f, 0.0f),
+        FVector(0.0f, AggroRange * 0.75f, 0.0f),
+        FVector(-(AggroRange + ExitRange) * 0.5f, 0.0f, 0.0f),
+        FVector(0.0f, -ExitRange * 3.0f, 0.0f)
+    };
+    TArray<AHSPlayerCharacter*> Players;
+    for (const FVector& Location : PlayerLocations)
+    {
+        AHSPlayerCharacter* Player = TestWorld.Spawn<AHSPlayerCharacter>(Location);
+        APlayerController* Controller = TestWorld.Spawn<APlayerController>(Location);
+        if (!TestNotNull(TEXT("Player spawned"), Player) || !TestNotNull(TEXT("Player controller spawned"), Controller))
+        {
+            return false;
+        }
+        Controller->Possess(Player);
+        Players.Add(Player);
+    }
+
+    auto IsEngaged = [Boss](const AActor* Actor) { return Boss->EngagedPlayers.Contains(Actor); };
+
+    // 진입: 범위 안 플레이어만 교전, 사이 구간 플레이어는 아직 진입하지 않음
+    ++GFrameCounter;
+    Boss->UpdateEngagedPlayers();
+    TestEqual(TEXT("Only players inside aggro range engage"), Boss->EngagedPlayers.Num(), 2);
+    TestTrue(TEXT("Near players engaged"), IsEngaged(Players[0]) && IsEngaged(Players[1]));
+    TestFalse(TEXT("Player in the hysteresis band does not enter"), IsEngaged(Players[2]));
+
+    // 이탈 히스테리시스: 진입 거리를 벗어나도 이탈 거리 안이면 유지, 밖이면 제거
+    Players[0]->SetActorLocation(FVector((AggroRange + ExitRange) * 0.5f, 0.0f, 0.0f));
+    ++GFrameCounter;
+    Boss->UpdateEngagedPlayers();
+    TestTrue(TEXT("Engaged player stays inside exit range"), IsEngaged(Players[0]));
+
+    Players[0]->SetActorLocation(FVector(ExitRange * 1.5f, 0.0f, 0.0f));
+    ++GFrameCounter;
+    Boss->UpdateEngagedPlayers();
+    TestFalse(TEXT("Engaged player leaves beyond exit range"), IsEngaged(Players[0]));
+    TestEqual(TEXT("Membership set matches engaged list"), Boss->EngagedPlayerKeys.Num(), Boss->EngagedPlayers.Num());
+
+    for (const AActor* Engaged : Boss->EngagedPlayers)
+    {
+        TestTrue(TEXT("Minions are never engaged"), Cast<AHSPlayerCharacter>(Engaged) != nullptr);
+    }
+    Players[0]->SetActorLocation(PlayerLocations[0]);
+
+    // 측정: 매 프레임 판정했을 때의 호출당 비용과 판정 주기로 나눈 프레임당 비용
+    double IndexSeconds = 0.0;
+    double SweepSeconds = 0.0;
+    double SignificanceSeconds = 0.0;
+    int32 SweepHits = 0;
+    TArray<AActor*> LegacyEngaged;
+
+    for (int32 Frame = 0; Frame < BenchmarkFrames; ++Frame)
+    {
+        ++GFrameCounter;
+
+        double StartTime = FPlatformTime::Seconds();
+        Boss->UpdateEngagedPlayers();
+        IndexSeconds += FPlatformTime::Seconds() - StartTime;
+
+        StartTime = FPlatformTime::Seconds();
+        SweepHits = LegacySweepEngagement(World, Boss, AggroRange, LegacyEngaged);
+        SweepSeconds += FPlatformTime::Seconds() - StartTime;
+
+        // 중요도 평가는 평가 주기에만 돌므로 주기만큼 진행시켜 매번 평가하도록 함
+        StartTime = FPlatformTime::Seconds();
+        SignificanceManager->Tick(1.0f);
+        SignificanceSeconds += FPlatformTime::Seconds() - StartTime;
+    }
+
+    const double IndexUs = IndexSeconds * 1.0e6 / BenchmarkFrames;
+    const double SweepUs = SweepSeconds * 1.0e6 / BenchmarkFrames;
+    const double UpdatesPerFrame = FrameDeltaTime / FMath::Max(Boss->EngagementUpdateInterval, FrameDeltaTime);
+    AddInfo(FString::Printf(TEXT("%d minions, %d players: shared index %.2f us/update (%.2f us/frame at %.2fs interval), legacy sweep %.2f us/frame (%d hits)"),
+        MinionCount, Players.Num(), IndexUs, IndexUs * UpdatesPerFrame, Boss->EngagementUpdateInterval, SweepUs, SweepHits));
+    AddInfo(FString::Printf(TEXT("Significance evaluation with %d minions: %.2f us/evaluation"),
+        MinionCount, SignificanceSeconds * 1.0e6 / BenchmarkFrames));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
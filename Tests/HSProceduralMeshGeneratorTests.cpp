@@ -0,0 +1,242 @@
+// HSProceduralMeshGeneratorTests.cpp
+// 절차적 메시 생성기 자동화 테스트
+// 합성 격자로 정점 용접의 결과 정점 수와 UV/노말 경계 유지를 검증하고 정점 수별 처리 시간을 측정
+// 기울어진 평면으로 노말/탄젠트 계산 결과를 해석해와 비교하고 처리량(정점/ms)을 측정
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/World/Generation/HSProceduralMeshGenerator.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSProceduralMeshGeneratorTests
+{
+    constexpr float GridSpacing = 100.0f;
+    constexpr float WeldThreshold = 0.1f;
+
+    // 용접 허용 오차보다 충분히 작은 위치 흔들림 (비트 단위로 같지 않은 중복 정점을 만들기 위함)
+    constexpr float PositionJitter = 0.02f;
+
+    // 쿼드마다 정점 4개를 따로 가진 격자 (공유 위치마다 최대 4개의 중복 정점)
+    // SeamX 열부터는 UV를, SeamY 행부터는 노말을 바꿔 각각 UV/노말 경계를 만듦
+    struct FSplitGrid
+    {
+        TArray<FVector> Vertices;
+        TArray<FVector> Normals;
+        TArray<FVector2D> UVs;
+        TArray<FProcMeshTangent> Tangents;
+        TArray<int32> Triangles;
+    };
+
+    FSplitGrid MakeSplitGrid(int32 QuadsPerSide, FRandomStream& Random)
+    {
+        const int32 SeamX = QuadsPerSide / 2;
+        const int32 SeamY = QuadsPerSide / 3;
+        const FVector SeamNormal = FVector(0.0f, 0.6f, 0.8f);
+
+        FSplitGrid Grid;
+        const int32 QuadCount = QuadsPerSide * QuadsPerSide;
+        Grid.Vertices.Reserve(QuadCount * 4);
+        Grid.Normals.Reserve(QuadCount * 4);
+        Grid.UVs.Reserve(QuadCount * 4);
+        Grid.Tangents.Reserve(QuadCount * 4);
+        Grid.Triangles.Reserve(QuadCount * 6);
+
+        static const FIntPoint Corners[] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+
+        for (int32 QuadY = 0; QuadY < QuadsPerSide; ++QuadY)
+        {
+            for (int32 QuadX = 0; QuadX < QuadsPerSide; ++QuadX)
+            {
+                const int32 Base = Grid.Vertices.Num();
+                for (const FIntPoint& Corner : Corners)
+                {
+                    const int32 X = QuadX + Corner.X;
+                    const int32 Y = QuadY + Corner.Y;
+                    Grid.Vertices.Add(FVector(
+                        X * GridSpacing + Random.FRandRange(-PositionJitter, PositionJitter),
+                        Y * GridSpacing + Random.FRandRange(-PositionJitter, PositionJitter),
+                        0.0f));
+                    Grid.Normals.Add(QuadY >= SeamY ? SeamNormal : FVector::UpVector);
+                    Grid.UVs.Add(FVector2D((float)X / QuadsPerSide + (QuadX >= SeamX ? 0.5f : 0.0f), (float)Y / QuadsPerSide));
+                    Grid.Tangents.Add(FProcMeshTangent(1.0f, 0.0f, 0.0f));
+                }
+
+                Grid.Triangles.Append({ Base, Base + 2, Base + 1, Base + 1, Base + 2, Base + 3 });
+            }
+        }
+
+        return Grid;
+    }
+
+    // 한 평면 위의 높이 맵 (두 노말 계산 경로 모두 해석해와 같아야 함)
+    constexpr float PlaneSlopeX = 0.3f;
+    constexpr float PlaneSlopeY = -0.2f;
+    constexpr float NormalChunkSize = 5000.0f;
+    constexpr float NormalTolerance = 1.0e-3f;
+
+    TArray<float> MakePlaneHeightMap(int32 MapSize)
+    {
+        const float CellSize = NormalChunkSize / (MapSize - 1);
+        TArray<float> HeightMap;
+        HeightMap.SetNumUninitialized(MapSize * MapSize);
+        for (int32 Y = 0; Y < MapSize; ++Y)
+        {
+            for (int32 X = 0; X < MapSize; ++X)
+            {
+                HeightMap[Y * MapSize + X] = (PlaneSlopeX * X + PlaneSlopeY * Y) * CellSize;
+            }
+        }
+        return HeightMap;
+    }
+
+    // 노말이 해석해와 다르거나 탄젠트가 단위 길이/노말 직교를 벗어난 정점 수
+    int32 CountBadNormalsAndTangents(const TArray<FVector>& Normals, const TArray<FProcMeshTangent>& Tangents)
+    {
+        const FVector ExpectedNormal = FVector(-PlaneSlopeX, -PlaneSlopeY, 1.0f).GetSafeNormal();
+        int32 BadCount = 0;
+        for (int32 Index = 0; Index < Normals.Num(); ++Index)
+        {
+            const FVector& TangentX = Tangents[Index].TangentX;
+            if (!Normals[Index].Equals(ExpectedNormal, NormalTolerance)
+                || !FMath::IsNearlyEqual((float)TangentX.Size(), 1.0f, NormalTolerance)
+                || FMath::Abs(FVector::DotProduct(TangentX, Normals[Index])) > NormalTolerance)
+            {
+                ++BadCount;
+            }
+        }
+        return BadCount;
+    }
+
+    // 공유 위치 (N+1)² 개에 UV 경계 열 (N+1)개, 노말 경계 행 (N+1)개, 두 경계의 교차점 1개가 더해짐
+    int32 ExpectedWeldedVertexCount(int32 QuadsPerSide)
+    {
+        return FMath::Square(QuadsPerSide + 2);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSProceduralMeshWeldTest, "HuntingSpirit.World.ProceduralMesh.WeldVertices",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSProceduralMeshWeldTest::RunTest(const FString& Parameters)
+{
+    using namespace HSProceduralMeshGeneratorTests;
+
+    // 정점 약 10k / 100k / 1M
+    const int32 QuadsPerSideCases[] = { 50, 158, 500 };
+    FRandomStream Random(38);
+    double FirstNsPerVertex = 0.0;
+
+    for (int32 QuadsPerSide : QuadsPerSideCases)
+    {
+        FSplitGrid Grid = MakeSplitGrid(QuadsPerSide, Random);
+        const int32 InputVertexCount = Grid.Vertices.Num();
+
+        // 삼각형 꼭짓점별 원래 속성 (용접 후 같은 꼭짓점이 같은 위치/UV/노말을 가리키는지 비교)
+        TArray<FVector> CornerPositions;
+        TArray<FVector> CornerNormals;
+        TArray<FVector2D> CornerUVs;
+        CornerPositions.Reserve(Grid.Triangles.Num());
+        CornerNormals.Reserve(Grid.Triangles.Num());
+        CornerUVs.Reserve(Grid.Triangles.Num());
+        for (int32 Index : Grid.Triangles)
+        {
+            CornerPositions.Add(Grid.Vertices[Index]);
+            CornerNormals.Add(Grid.Normals[Index]);
+            CornerUVs.Add(Grid.UVs[Index]);
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        const int32 RemovedCount = HSProceduralMeshGenerator::WeldVertices(
+            Grid.Vertices, Grid.Triangles, WeldThreshold, &Grid.Normals, &Grid.UVs, &Grid.Tangents);
+        const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        const int32 WeldedCount = Grid.Vertices.Num();
+        TestEqual(FString::Printf(TEXT("%d vertices: welded count keeps one vertex per position and seam side"), InputVertexCount),
+            WeldedCount, ExpectedWeldedVertexCount(QuadsPerSide));
+        TestEqual(TEXT("Removed count matches shrink"), RemovedCount, InputVertexCount - WeldedCount);
+        TestTrue(TEXT("Attribute arrays compacted with positions"),
+            Grid.Normals.Num() == WeldedCount && Grid.UVs.Num() == WeldedCount && Grid.Tangents.Num() == WeldedCount);
+
+        int32 BadIndices = 0;
+        int32 MovedCorners = 0;
+        int32 BrokenSeams = 0;
+        for (int32 Corner = 0; Corner < Grid.Triangles.Num(); ++Corner)
+        {
+            const int32 Index = Grid.Triangles[Corner];
+            if (!Grid.Vertices.IsValidIndex(Index))
+            {
+                ++BadIndices;
+                continue;
+            }
+            if (!Grid.Vertices[Index].Equals(CornerPositions[Corner], WeldThreshold))
+            {
+                ++MovedCorners;
+            }
+            if (!Grid.UVs[Index].Equals(CornerUVs[Corner], KINDA_SMALL_NUMBER) || !Grid.Normals[Index].Equals(CornerNormals[Corner], KINDA_SMALL_NUMBER))
+            {
+                ++BrokenSeams;
+            }
+        }
+        TestEqual(TEXT("Every remapped index is in range"), BadIndices, 0);
+        TestEqual(TEXT("Every corner stays within the weld threshold"), MovedCorners, 0);
+        TestEqual(TEXT("UV and normal seams preserved for every corner"), BrokenSeams, 0);
+
+        const double NsPerVertex = ElapsedMs * 1.0e6 / InputVertexCount;
+        if (FirstNsPerVertex <= 0.0)
+        {
+            FirstNsPerVertex = NsPerVertex;
+        }
+        AddInfo(FString::Printf(TEXT("Weld %d -> %d vertices: %.2f ms, %.1f ns/vertex (x%.2f of smallest case)"),
+            InputVertexCount, WeldedCount, ElapsedMs, NsPerVertex, NsPerVertex / FMath::Max(FirstNsPerVertex, 1.0e-6)));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSProceduralMeshNormalThroughputTest, "HuntingSpirit.World.ProceduralMesh.NormalTangentThroughput",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSProceduralMeshNormalThroughputTest::RunTest(const FString& Parameters)
+{
+    using namespace HSProceduralMeshGeneratorTests;
+
+    // 정점 약 16k / 66k / 263k
+    const int32 MapSizeCases[] = { 129, 257, 513 };
+    FMeshLODSettings LODSettings;
+    LODSettings.bGenerateTangents = true;
+
+    for (int32 MapSize : MapSizeCases)
+    {
+        const TArray<float> HeightMap = MakePlaneHeightMap(MapSize);
+
+        // 격자 지형 경로: 높이 맵 중앙 차분으로 정점 생성과 같은 패스에서 계산
+        FProceduralMeshBuildData BuildData;
+        if (!TestTrue(TEXT("Terrain mesh data built"), HSProceduralMeshGenerator::BuildTerrainMeshData(HeightMap, NormalChunkSize, LODSettings, BuildData)))
+        {
+            return false;
+        }
+        TestEqual(FString::Printf(TEXT("%d² heightmap: every terrain normal/tangent matches the plane"), MapSize),
+            CountBadNormalsAndTangents(BuildData.Normals, BuildData.Tangents), 0);
+
+        // 일반 메시 경로: 같은 정점/삼각형으로 인접 삼각형 수집 방식 계산
+        TArray<FVector> Normals;
+        TArray<FProcMeshTangent> Tangents;
+        const double StartTime = FPlatformTime::Seconds();
+        HSProceduralMeshGenerator::CalculateNormalsAndTangents(BuildData.Vertices, BuildData.UVs, BuildData.Triangles, Normals, &Tangents);
+        const double GatherElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        TestEqual(FString::Printf(TEXT("%d² heightmap: every gathered normal/tangent matches the plane"), MapSize),
+            CountBadNormalsAndTangents(Normals, Tangents), 0);
+
+        const int32 VertexCount = BuildData.Vertices.Num();
+        AddInfo(FString::Printf(TEXT("%d vertices: heightmap pass %.1f vertices/ms, adjacency gather %.1f vertices/ms (%.2f ms)"),
+            VertexCount, BuildData.VerticesPerMs, GatherElapsedMs > 0.0 ? VertexCount / GatherElapsedMs : 0.0, GatherElapsedMs));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
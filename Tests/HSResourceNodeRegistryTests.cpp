@@ -0,0 +1,158 @@
+// HSResourceNodeRegistryTests.cpp
+// 자원 노드 그리드 레지스트리 자동화 테스트
+// 5,000개 노드를 등록한 상태에서 결과 정확성과 조회 비용(셀/엔트리 수, 시간)을 전수 검사/구체 오버랩과 비교
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Tests/HSTestWorld.h"
+#include "HuntingSpirit/World/Resources/HSResourceNode.h"
+#include "HuntingSpirit/World/Resources/HSResourceNodeRegistry.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSResourceNodeRegistryTests
+{
+    constexpr int32 NodeCount = 5000;
+    constexpr int32 QueryCount = 200;
+    constexpr float WorldExtent = 50000.0f;
+    constexpr float QueryRadius = 1000.0f;
+
+    // ResourceData는 protected이므로 리플렉션으로 타입만 지정
+    void SetNodeResourceType(AHSResourceNode* Node, EResourceType ResourceType)
+    {
+        static const FStructProperty* ResourceDataProperty = FindFProperty<FStructProperty>(AHSResourceNode::StaticClass(), TEXT("ResourceData"));
+        if (ResourceDataProperty)
+        {
+            ResourceDataProperty->ContainerPtrToValuePtr<FResourceData>(Node)->ResourceType = ResourceType;
+        }
+    }
+
+    // 레지스트리 도입 전 방식의 기준 결과 (등록된 전체 노드 전수 검사)
+    void BruteForceQuery(const TArray<AHSResourceNode*>& Nodes, const FVector& Center, float Radius, EResourceType TypeFilter, TArray<AHSResourceNode*>& OutNodes)
+    {
+        OutNodes.Reset();
+        const float RadiusSquared = FMath::Square(Radius);
+        for (AHSResourceNode* Node : Nodes)
+        {
+            if (TypeFilter != EResourceType::None && Node->GetResourceType() != TypeFilter)
+            {
+                continue;
+            }
+            if (FVector::DistSquared(Node->GetActorLocation(), Center) <= RadiusSquared)
+            {
+                OutNodes.Add(Node);
+            }
+        }
+    }
+
+    bool SameNodeSet(TArray<AHSResourceNode*> A, TArray<AHSResourceNode*> B)
+    {
+        if (A.Num() != B.Num())
+        {
+            return false;
+        }
+        A.Sort();
+        B.Sort();
+        return A == B;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSResourceNodeRegistryQuery5kTest, "HuntingSpirit.World.ResourceNodeRegistry.Query5kNodes",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHSResourceNodeRegistryQuery5kTest::RunTest(const FString& Parameters)
+{
+    using namespace HSResourceNodeRegistryTests;
+
+    FHSScopedTestWorld TestWorld;
+    UHSResourceNodeRegistry* Registry = TestWorld.Get()->GetSubsystem<UHSResourceNodeRegistry>();
+    if (!TestNotNull(TEXT("Registry subsystem exists for game worlds"), Registry))
+    {
+        return false;
+    }
+
+    // 결정적 배치를 위해 고정 시드 사용
+    FRandomStream Random(28);
+    const EResourceType ResourceTypes[] = { EResourceType::Wood, EResourceType::Stone, EResourceType::Iron, EResourceType::Herb };
+
+    TArray<AHSResourceNode*> Nodes;
+    Nodes.Reserve(NodeCount);
+    for (int32 Index = 0; Index < NodeCount; ++Index)
+    {
+        const FVector Location(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0f);
+        AHSResourceNode* Node = TestWorld.Spawn<AHSResourceNode>(Location);
+        if (!Node)
+        {
+            continue;
+        }
+        SetNodeResourceType(Node, ResourceTypes[Index % UE_ARRAY_COUNT(ResourceTypes)]);
+        Registry->RegisterNode(Node);
+        Nodes.Add(Node);
+    }
+
+    TestEqual(TEXT("All nodes registered"), Registry->GetRegisteredNodeCount(), Nodes.Num());
+
+    TArray<AHSResourceNode*> GridResult;
+    TArray<AHSResourceNode*> ReferenceResult;
+    TArray<AActor*> OverlapResult;
+    TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
+    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_WorldDynamic));
+    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_WorldStatic));
+    const TArray<AActor*> ActorsToIgnore;
+
+    double GridSeconds = 0.0;
+    double BruteForceSeconds = 0.0;
+    double OverlapSeconds = 0.0;
+    int64 TotalEntriesTested = 0;
+    int32 MismatchCount = 0;
+
+    for (int32 QueryIndex = 0; QueryIndex < QueryCount; ++QueryIndex)
+    {
+        const FVector Center(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0f);
+        const EResourceType TypeFilter = (QueryIndex % 2 == 0) ? EResourceType::None : ResourceTypes[QueryIndex % UE_ARRAY_COUNT(ResourceTypes)];
+
+        double StartTime = FPlatformTime::Seconds();
+        Registry->QueryNodesInRadius(Center, QueryRadius, TypeFilter, GridResult);
+        GridSeconds += FPlatformTime::Seconds() - StartTime;
+        TotalEntriesTested += Registry->GetLastQueryEntriesTested();
+
+        StartTime = FPlatformTime::Seconds();
+        BruteForceQuery(Nodes, Center, QueryRadius, TypeFilter, ReferenceResult);
+        BruteForceSeconds += FPlatformTime::Seconds() - StartTime;
+
+        // 이전 스캔 경로 (비용 비교용, 결과는 콜리전 설정에 따라 달라지므로 검증하지 않음)
+        StartTime = FPlatformTime::Seconds();
+        UKismetSystemLibrary::SphereOverlapActors(TestWorld.Get(), Center, QueryRadius, ObjectTypes, AHSResourceNode::StaticClass(), ActorsToIgnore, OverlapResult);
+        OverlapSeconds += FPlatformTime::Seconds() - StartTime;
+
+        if (!SameNodeSet(GridResult, ReferenceResult))
+        {
+            ++MismatchCount;
+        }
+    }
+
+    TestEqual(TEXT("Grid query matches brute-force results"), MismatchCount, 0);
+
+    // 반경 1000uu(셀 1개 폭) 조회는 최대 3x3 셀만 방문하므로 평균 검사 엔트리가 전체의 일부여야 함
+    const double AverageEntriesTested = static_cast<double>(TotalEntriesTested) / QueryCount;
+    TestTrue(FString::Printf(TEXT("Average entries tested (%.1f) is far below node count (%d)"), AverageEntriesTested, Nodes.Num()),
+        AverageEntriesTested < Nodes.Num() * 0.05);
+
+    AddInfo(FString::Printf(TEXT("%d nodes, %d queries: grid %.3f ms, brute force %.3f ms, sphere overlap %.3f ms (avg %.1f entries tested)"),
+        Nodes.Num(), QueryCount, GridSeconds * 1000.0, BruteForceSeconds * 1000.0, OverlapSeconds * 1000.0, AverageEntriesTested));
+
+    // 해제 후에는 조회 결과에 나타나지 않아야 함
+    for (AHSResourceNode* Node : Nodes)
+    {
+        Registry->UnregisterNode(Node);
+    }
+    TestEqual(TEXT("All nodes unregistered"), Registry->GetRegisteredNodeCount(), 0);
+    TestEqual(TEXT("Empty registry returns no nodes"), Registry->QueryNodesInRadius(FVector::ZeroVector, WorldExtent, EResourceType::None, GridResult), 0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
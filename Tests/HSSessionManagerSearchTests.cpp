@@ -0,0 +1,161 @@
+// HSSessionManagerSearchTests.cpp
+// 세션 매니저 검색 결과 반영 자동화 테스트
+// NULL 온라인 서브시스템과 가상 검색 결과로 색인/빠른 매칭 선택/캐시 재사용과 가상 측정 후 상태 복원을 검증
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Networking/SessionHandling/HSSessionManager.h"
+#include "OnlineSubsystemNames.h"
+
+namespace HSSessionManagerSearchTests
+{
+    constexpr int32 SyntheticSessionCount = 5000;
+    constexpr int32 ProfileSessionCount = 1000;
+
+    // 색인 없이 전체 결과를 훑어 빠른 매칭 조건을 만족하는 가장 낮은 핑 계산 (없으면 -1)
+    int32 FindLowestJoinablePing(const TArray<FHSSessionInfo>& Results, int32 MaxPing)
+    {
+        int32 LowestPing = -1;
+        for (const FHSSessionInfo& SessionInfo : Results)
+        {
+            const bool bJoinable = SessionInfo.SearchResult.IsValid() &&
+                (SessionInfo.MaxPlayers <= 0 || SessionInfo.CurrentPlayers < SessionInfo.MaxPlayers) &&
+                (MaxPing <= 0 || SessionInfo.Ping <= MaxPing);
+            if (bJoinable && (LowestPing < 0 || SessionInfo.Ping < LowestPing))
+            {
+                LowestPing = SessionInfo.Ping;
+            }
+        }
+        return LowestPing;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSSessionManagerSyntheticSearchTest, "HuntingSpirit.Networking.SessionManager.SyntheticSearch",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHSSessionManagerSyntheticSearchTest::RunTest(const FString& Parameters)
+{
+    using namespace HSSessionManagerSearchTests;
+
+    IOnlineSubsystem* NullSubsystem = IOnlineSubsystem::Get(NULL_SUBSYSTEM);
+    if (!NullSubsystem || !NullSubsystem->GetSessionInterface().IsValid())
+    {
+        AddWarning(TEXT("NULL online subsystem is not available; skipping session search test"));
+        return true;
+    }
+
+    // 게임 인스턴스 없이 NULL 서브시스템의 세션 인터페이스만 연결
+    UHSSessionManager* SessionManager = NewObject<UHSSessionManager>();
+    SessionManager->OnlineSubsystem = NullSubsystem;
+    SessionManager->SessionInterface = NullSubsystem->GetSessionInterface();
+
+    TestFalse(TEXT("Refresh without a previous search does nothing"), SessionManager->RefreshSearchResults());
+
+    // 온라인 검색 완료 콜백 경로로 최초 결과 반영
+    const FHSSessionSearchFilter SearchFilter = SessionManager->DefaultSearchFilter;
+    const TSharedRef<FOnlineSessionSearch> InitialSearch = UHSSessionManager::MakeSyntheticSessionSearch(SyntheticSessionCount, 1);
+    SessionManager->ChangeSessionState(EHSSessionState::SS_Searching);
+    SessionManager->CurrentSessionSearch = InitialSearch;
+    SessionManager->ActiveSearchFilter = SearchFilter;
+    SessionManager->ActiveSearchFilterKey = UHSSessionManager::GetSearchFilterKey(SearchFilter);
+    SessionManager->OnFindSessionsComplete(true);
+
+    TestTrue(TEXT("Search completion returns to idle"), SessionManager->GetCurrentSessionState() == EHSSessionState::SS_None);
+    TestEqual(TEXT("Every synthetic session converted"), SessionManager->LastSearchResults.Num(), SyntheticSessionCount);
+    TestTrue(TEXT("Completed filter becomes the cache key"), SessionManager->LastSearchFilterKey == SessionManager->ActiveSearchFilterKey);
+
+    // 세션 ID 색인과 핑 구간 색인이 결과 배열과 일치하는지 확인
+    int32 IndexMismatches = 0;
+    for (int32 ResultIndex = 0; ResultIndex < SyntheticSessionCount; ++ResultIndex)
+    {
+        const FString SessionId = FString::Printf(TEXT("Synthetic_%d"), ResultIndex);
+        if (SessionManager->FindSearchResultIndexBySessionId(SessionId) != ResultIndex ||
+            SessionManager->LastSearchResults[ResultIndex].SessionId != SessionId)
+        {
+            ++IndexMismatches;
+        }
+    }
+    TestEqual(TEXT("Session ID index resolves every result"), IndexMismatches, 0);
+
+    int32 BucketedCount = 0;
+    int32 BucketMismatches = 0;
+    for (int32 BucketIndex = 0; BucketIndex < SessionManager->SearchResultIndicesByPingBucket.Num(); ++BucketIndex)
+    {
+        for (const int32 ResultIndex : SessionManager->SearchResultIndicesByPingBucket[BucketIndex])
+        {
+            const int32 Ping = SessionManager->LastSearchResults[ResultIndex].Ping;
+            if (FMath::Clamp(Ping / UHSSessionManager::PingBucketSizeMs, 0, UHSSessionManager::PingBucketCount - 1) != BucketIndex)
+            {
+                ++BucketMismatches;
+            }
+            ++BucketedCount;
+        }
+    }
+    TestEqual(TEXT("Every result is in exactly one ping bucket"), BucketedCount, SyntheticSessionCount);
+    TestEqual(TEXT("Results sit in the bucket of their ping"), BucketMismatches, 0);
+
+    // 핑 구간 색인으로 고른 빠른 매칭 대상은 전체 탐색 결과와 같은 핑이어야 함
+    for (const int32 MaxPing : { 0, 100, SearchFilter.MaxPing })
+    {
+        const FHSSessionInfo* Candidate = SessionManager->FindQuickMatchCandidate(MaxPing);
+        TestEqual(FString::Printf(TEXT("Quick match picks the lowest joinable ping (max %d)"), MaxPing),
+            Candidate ? Candidate->Ping : -1, FindLowestJoinablePing(SessionManager->LastSearchResults, MaxPing));
+    }
+
+    // 같은 필터의 최근 결과는 온라인 검색 없이 캐시로 완료
+    const int32 CacheHitsBefore = SessionManager->SearchCacheHitCount;
+    TestTrue(TEXT("Cached search completes immediately"), SessionManager->SearchSessions(SearchFilter));
+    TestEqual(TEXT("Cache hit counted"), SessionManager->SearchCacheHitCount, CacheHitsBefore + 1);
+    TestTrue(TEXT("Cache hit does not start an online search"), SessionManager->GetCurrentSessionState() == EHSSessionState::SS_None);
+
+    // 같은 세션의 갱신 결과는 변환 결과를 재사용하고 인원/핑만 바뀜
+    const TSharedRef<FOnlineSessionSearch> RefreshSearch = UHSSessionManager::MakeSyntheticSessionSearch(SyntheticSessionCount, 2);
+    const int32 ReusedBefore = SessionManager->ReusedSearchResultCount;
+    SessionManager->ApplySearchResults(RefreshSearch);
+    TestEqual(TEXT("Every known session reused on refresh"), SessionManager->ReusedSearchResultCount, ReusedBefore + SyntheticSessionCount);
+
+    int32 StaleAvailability = 0;
+    for (int32 ResultIndex = 0; ResultIndex < SyntheticSessionCount; ++ResultIndex)
+    {
+        const FHSSessionInfo& SessionInfo = SessionManager->LastSearchResults[ResultIndex];
+        const FOnlineSessionSearchResult& SearchResult = RefreshSearch->SearchResults[ResultIndex];
+        if (SessionInfo.Ping != SearchResult.PingInMs ||
+            SessionInfo.CurrentPlayers != 4 - SearchResult.Session.NumOpenPublicConnections ||
+            SessionInfo.SearchResult.Get() != &SearchResult)
+        {
+            ++StaleAvailability;
+        }
+    }
+    TestEqual(TEXT("Refresh updates ping, players and search result of reused sessions"), StaleAvailability, 0);
+
+    // 가상 측정은 실제 검색 결과, 캐시, 색인을 그대로 남겨야 함
+    const TArray<FHSSessionInfo> ResultsBeforeProfile = SessionManager->LastSearchResults;
+    const FDateTime TimestampBeforeProfile = SessionManager->LastSearchResultsTimestamp;
+    const uint32 FilterKeyBeforeProfile = SessionManager->LastSearchFilterKey;
+    const int32 ReusedBeforeProfile = SessionManager->ReusedSearchResultCount;
+    const int32 QuickMatchPingBeforeProfile = FindLowestJoinablePing(ResultsBeforeProfile, SearchFilter.MaxPing);
+
+    SessionManager->ProfileSyntheticSearchResults(ProfileSessionCount);
+
+    TestEqual(TEXT("Profiling keeps the search results"), SessionManager->LastSearchResults.Num(), ResultsBeforeProfile.Num());
+    TestTrue(TEXT("Profiling keeps the search result objects"),
+        SessionManager->LastSearchResults.Num() > 0 && SessionManager->LastSearchResults.Last().SearchResult == ResultsBeforeProfile.Last().SearchResult);
+    TestTrue(TEXT("Profiling keeps the result timestamp"), SessionManager->LastSearchResultsTimestamp == TimestampBeforeProfile);
+    TestTrue(TEXT("Profiling keeps the cache key"), SessionManager->LastSearchFilterKey == FilterKeyBeforeProfile);
+    TestEqual(TEXT("Profiling keeps the reuse statistics"), SessionManager->ReusedSearchResultCount, ReusedBeforeProfile);
+    TestEqual(TEXT("Profiling restores the session ID index"),
+        SessionManager->FindSearchResultIndexBySessionId(FString::Printf(TEXT("Synthetic_%d"), SyntheticSessionCount - 1)), SyntheticSessionCount - 1);
+
+    const FHSSessionInfo* CandidateAfterProfile = SessionManager->FindQuickMatchCandidate(SearchFilter.MaxPing);
+    TestEqual(TEXT("Profiling restores the ping bucket index"), CandidateAfterProfile ? CandidateAfterProfile->Ping : -1, QuickMatchPingBeforeProfile);
+
+    TestTrue(TEXT("Cache still serves the same filter after profiling"), SessionManager->SearchSessions(SearchFilter));
+    TestEqual(TEXT("Cache hit counted after profiling"), SessionManager->SearchCacheHitCount, CacheHitsBefore + 2);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
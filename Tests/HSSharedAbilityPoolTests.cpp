@@ -0,0 +1,205 @@
+// HSSharedAbilityPoolTests.cpp
+// 공유 능력 풀 스트레스 자동화 테스트
+// 초당 수천 번의 활성화/만료/수동 해제를 반복하며 세대 핸들의 재사용 거부, 자유 목록 일관성, 슬롯 주소 유지를 검증
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Cooperation/SharedAbilities/HSSharedAbilitySystem.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSSharedAbilityPoolTests
+{
+    constexpr int32 AbilityCount = 2048;
+    constexpr int32 ActivationsPerFrame = 100;
+    constexpr int32 SimulatedFrames = 600;
+    constexpr float FrameDeltaTime = 1.0f / 60.0f;
+    constexpr int32 MaxTrackedStaleHandles = 4096;
+
+    FName MakeAbilityID(int32 Index)
+    {
+        return FName(TEXT("PoolStress"), Index + 1);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSSharedAbilityPoolStressTest, "HuntingSpirit.Cooperation.SharedAbilitySystem.PoolStress",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSSharedAbilityPoolStressTest::RunTest(const FString& Parameters)
+{
+    using namespace HSSharedAbilityPoolTests;
+
+    UHSSharedAbilitySystem* AbilitySystem = NewObject<UHSSharedAbilitySystem>();
+    const TArray<class AHSCharacterBase*> NoParticipants;
+
+    // 조건/쿨다운이 없어 만료 즉시 다시 활성화할 수 있고, 참가자가 없어 효과 처리가 비용에 섞이지 않는 능력
+    FRandomStream Random(45);
+    for (int32 Index = 0; Index < AbilityCount; ++Index)
+    {
+        FSharedAbilityData AbilityData;
+        AbilityData.AbilityID = MakeAbilityID(Index);
+        AbilityData.AbilityType = ESharedAbilityType::SAT_SharedResource;
+        AbilityData.Cooldown = 0.0f;
+        AbilityData.Duration = Random.FRandRange(0.05f, 0.5f);
+        AbilityData.ActivationEffect = nullptr;
+        AbilityData.ActivationSound = nullptr;
+        AbilitySystem->RegisterSharedAbility(AbilityData);
+    }
+
+    // 지속 시간이 없는 능력 하나는 끝까지 유지해 청크가 늘어나도 슬롯 주소가 바뀌지 않는지 확인
+    FSharedAbilityData PinnedData;
+    PinnedData.AbilityID = TEXT("PoolStressPinned");
+    PinnedData.AbilityType = ESharedAbilityType::SAT_SharedResource;
+    PinnedData.Cooldown = 0.0f;
+    PinnedData.Duration = 0.0f;
+    PinnedData.ActivationEffect = nullptr;
+    PinnedData.ActivationSound = nullptr;
+    AbilitySystem->RegisterSharedAbility(PinnedData);
+    TestTrue(TEXT("Pinned ability activated"), AbilitySystem->TryActivateSharedAbility(PinnedData.AbilityID, NoParticipants));
+    const FHSSharedAbilityHandle PinnedHandle = AbilitySystem->ActiveAbilities.FindRef(PinnedData.AbilityID);
+    const FActiveSharedAbility* PinnedAddress = AbilitySystem->ResolveAbilityHandle(PinnedHandle);
+
+    // 자유 목록을 끝까지 따라가며 순환/사용 중 슬롯 포함 여부를 확인하고, 사용 중 수와 활성 목록이 맞는지 비교
+    auto VerifyPoolConsistency = [&](const TCHAR* Stage) -> bool
+    {
+        const int32 Capacity = AbilitySystem->GetPooledAbilityCapacity();
+        TBitArray<> Visited(false, Capacity);
+        int32 FreeCount = 0;
+        bool bConsistent = true;
+
+        for (int32 SlotIndex = AbilitySystem->FirstFreeSlotIndex; SlotIndex != INDEX_NONE;
+            SlotIndex = AbilitySystem->GetPoolSlot(SlotIndex).NextFreeSlotIndex)
+        {
+            if (SlotIndex < 0 || SlotIndex >= Capacity || Visited[SlotIndex] || AbilitySystem->GetPoolSlot(SlotIndex).bInUse)
+            {
+                bConsistent = false;
+                break;
+            }
+            Visited[SlotIndex] = true;
+            ++FreeCount;
+        }
+
+        for (const TPair<FName, FHSSharedAbilityHandle>& Pair : AbilitySystem->ActiveAbilities)
+        {
+            const FActiveSharedAbility* Ability = AbilitySystem->ResolveAbilityHandle(Pair.Value);
+            if (!Ability || Ability->AbilityID != Pair.Key || !Ability->bIsActive)
+            {
+                bConsistent = false;
+            }
+        }
+
+        bConsistent &= FreeCount + AbilitySystem->GetPooledAbilityInUseCount() == Capacity;
+        bConsistent &= AbilitySystem->GetPooledAbilityInUseCount() == AbilitySystem->ActiveAbilities.Num();
+        return TestTrue(FString::Printf(TEXT("Pool free list consistent (%s)"), Stage), bConsistent);
+    };
+
+    TArray<FHSSharedAbilityHandle> StaleHandles;
+    StaleHandles.Reserve(MaxTrackedStaleHandles);
+    int32 StaleHandlesResolved = 0;
+    int32 TotalActivations = 0;
+    int32 ManualDeactivations = 0;
+    int32 PeakInUse = 0;
+
+    // 반환 직전에 핸들을 기록해 두고, 슬롯이 재사용된 뒤에도 옛 핸들이 거부되는지 확인
+    auto TrackStaleHandle = [&](const FName& AbilityID)
+    {
+        if (const FHSSharedAbilityHandle* Handle = AbilitySystem->ActiveAbilities.Find(AbilityID))
+        {
+            if (StaleHandles.Num() < MaxTrackedStaleHandles)
+            {
+                StaleHandles.Add(*Handle);
+            }
+            else
+            {
+                StaleHandles[Random.RandRange(0, MaxTrackedStaleHandles - 1)] = *Handle;
+            }
+        }
+    };
+
+    // 측정은 활성화/해제와 만료 틱만 포함하고 검증용 기록과 조회는 제외
+    double ChurnSeconds = 0.0;
+    for (int32 Frame = 0; Frame < SimulatedFrames; ++Frame)
+    {
+        double StartTime = FPlatformTime::Seconds();
+        for (int32 Attempt = 0; Attempt < ActivationsPerFrame; ++Attempt)
+        {
+            const FName AbilityID = MakeAbilityID(Random.RandRange(0, AbilityCount - 1));
+            if (AbilitySystem->IsSharedAbilityActive(AbilityID))
+            {
+                // 일부는 만료 전에 수동 해제해 만료 힙에 무효 항목을 남김
+                if (Random.FRand() < 0.1f)
+                {
+                    ChurnSeconds += FPlatformTime::Seconds() - StartTime;
+                    TrackStaleHandle(AbilityID);
+                    StartTime = FPlatformTime::Seconds();
+                    AbilitySystem->DeactivateSharedAbility(AbilityID);
+                    ++ManualDeactivations;
+                }
+                continue;
+            }
+
+            if (AbilitySystem->TryActivateSharedAbility(AbilityID, NoParticipants))
+            {
+                ++TotalActivations;
+                PeakInUse = FMath::Max(PeakInUse, AbilitySystem->GetPooledAbilityInUseCount());
+            }
+        }
+        ChurnSeconds += FPlatformTime::Seconds() - StartTime;
+
+        // 이번 틱에 만료될 능력 일부의 핸들 기록
+        for (const TPair<FName, FHSSharedAbilityHandle>& Pair : AbilitySystem->ActiveAbilities)
+        {
+            const UHSSharedAbilitySystem::FAbilityPoolSlot& Slot = AbilitySystem->GetPoolSlot(Pair.Value.SlotIndex);
+            if (Slot.DurationEndTime > 0.0 && Slot.DurationEndTime <= AbilitySystem->SharedAbilityTime + FrameDeltaTime && Random.FRand() < 0.25f)
+            {
+                TrackStaleHandle(Pair.Key);
+            }
+        }
+
+        StartTime = FPlatformTime::Seconds();
+        AbilitySystem->TickSharedAbilities(FrameDeltaTime);
+        ChurnSeconds += FPlatformTime::Seconds() - StartTime;
+
+        for (const FHSSharedAbilityHandle& StaleHandle : StaleHandles)
+        {
+            if (AbilitySystem->ResolveAbilityHandle(StaleHandle))
+            {
+                ++StaleHandlesResolved;
+            }
+        }
+
+        if (Frame % 60 == 0)
+        {
+            VerifyPoolConsistency(TEXT("during churn"));
+        }
+    }
+
+    TestEqual(TEXT("Stale handles never resolve after release or reuse"), StaleHandlesResolved, 0);
+    TestTrue(TEXT("Stale handles were exercised"), StaleHandles.Num() > 0);
+    TestTrue(TEXT("Pinned slot keeps its address while the pool grows"),
+        PinnedAddress != nullptr && AbilitySystem->ResolveAbilityHandle(PinnedHandle) == PinnedAddress);
+
+    // 용량은 동시에 사용한 최대 슬롯 수를 청크 단위로 올린 값을 넘지 않아야 함 (반환된 슬롯이 재사용됨)
+    const int32 ChunkSize = UHSSharedAbilitySystem::AbilityPoolChunkSize;
+    TestTrue(FString::Printf(TEXT("Capacity (%d) bounded by peak in-use (%d) rounded up to chunks"), AbilitySystem->GetPooledAbilityCapacity(), PeakInUse),
+        AbilitySystem->GetPooledAbilityCapacity() <= FMath::DivideAndRoundUp(PeakInUse, ChunkSize) * ChunkSize);
+
+    // 모든 능력이 만료되도록 충분히 진행한 뒤 고정 능력만 남는지 확인
+    AbilitySystem->TickSharedAbilities(1.0f);
+    VerifyPoolConsistency(TEXT("after expiry"));
+    TestEqual(TEXT("Only the pinned ability remains after every duration expired"), AbilitySystem->GetPooledAbilityInUseCount(), 1);
+
+    AbilitySystem->Shutdown();
+    VerifyPoolConsistency(TEXT("after shutdown"));
+    TestEqual(TEXT("Every slot returned after shutdown"), AbilitySystem->GetPooledAbilityInUseCount(), 0);
+
+    AddInfo(FString::Printf(TEXT("%d activations (%.0f/s simulated), %d manual releases, peak %d in use, capacity %d: %.2f ms total, %.2f us/activation"),
+        TotalActivations, TotalActivations / (SimulatedFrames * FrameDeltaTime), ManualDeactivations, PeakInUse,
+        AbilitySystem->GetPooledAbilityCapacity(), ChurnSeconds * 1000.0, TotalActivations > 0 ? ChurnSeconds * 1.0e6 / TotalActivations : 0.0));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,147 @@
+// HSStatsComponentBuffTests.cpp
+// 스탯 컴포넌트 버프 저장소 자동화 테스트
+// 핸들 기반 인덱스/만료 힙의 정확성과 수백 개 스택 버프의 적용/제거/만료 처리량 측정
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Tests/HSTestWorld.h"
+#include "HuntingSpirit/Characters/Stats/HSStatsComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSStatsComponentBuffTests
+{
+    UHSStatsComponent* CreateStatsComponent(FHSScopedTestWorld& TestWorld)
+    {
+        AActor* Owner = TestWorld.Spawn<AActor>(FVector::ZeroVector);
+        UHSStatsComponent* StatsComponent = NewObject<UHSStatsComponent>(Owner);
+        StatsComponent->RegisterComponent();
+        return StatsComponent;
+    }
+
+    FBuffData MakeAttackBuff(const FString& BuffID, float FlatValue, float Duration)
+    {
+        FBuffData BuffData;
+        BuffData.BuffID = BuffID;
+        BuffData.BuffType = EBuffType::Attack;
+        BuffData.FlatValuePerStack = FlatValue;
+        BuffData.Duration = Duration;
+        BuffData.bStackable = true;
+        return BuffData;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSStatsComponentBuffCorrectnessTest, "HuntingSpirit.Characters.StatsComponent.Buffs.Correctness",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHSStatsComponentBuffCorrectnessTest::RunTest(const FString& Parameters)
+{
+    using namespace HSStatsComponentBuffTests;
+
+    FHSScopedTestWorld TestWorld;
+    UHSStatsComponent* StatsComponent = CreateStatsComponent(TestWorld);
+    const float BaseAttack = StatsComponent->GetAttackPower();
+
+    // 재계산은 다음 틱으로 지연되지만 읽기 시점에는 즉시 반영되어야 함
+    const int32 RageHandle = StatsComponent->ApplyBuff(MakeAttackBuff(TEXT("Rage"), 10.0f, 5.0f));
+    TestTrue(TEXT("ApplyBuff returns a valid handle"), RageHandle != INDEX_NONE);
+    TestEqual(TEXT("Attack reflects the buff before the deferred flush"), StatsComponent->GetAttackPower(), BaseAttack + 10.0f, KINDA_SMALL_NUMBER);
+
+    // 같은 ID 재적용은 같은 핸들로 스택만 증가
+    TestEqual(TEXT("Re-applying the same ID keeps the handle"), StatsComponent->ApplyBuff(MakeAttackBuff(TEXT("Rage"), 10.0f, 5.0f)), RageHandle);
+    TestEqual(TEXT("Second stack is visible immediately"), StatsComponent->GetAttackPower(), BaseAttack + 20.0f, KINDA_SMALL_NUMBER);
+
+    // 대소문자만 다른 ID는 다른 버프
+    const int32 LowerRageHandle = StatsComponent->ApplyBuff(MakeAttackBuff(TEXT("rage"), 1.0f, 1.0f));
+    TestNotEqual(TEXT("IDs differing only in case get separate handles"), LowerRageHandle, RageHandle);
+    TestEqual(TEXT("Both buffs are active"), StatsComponent->GetActiveBuffs().Num(), 2);
+
+    // 짧은 버프만 만료되고 긴 버프는 유지
+    TestWorld.Tick(0.25f, 6);
+    TestFalse(TEXT("Short buff expired"), StatsComponent->HasBuff(TEXT("rage")));
+    TestTrue(TEXT("Long buff still active"), StatsComponent->HasBuff(TEXT("Rage")));
+    TestEqual(TEXT("Expired buff no longer contributes"), StatsComponent->GetAttackPower(), BaseAttack + 20.0f, KINDA_SMALL_NUMBER);
+
+    // 핸들로 제거 후 같은 ID를 다시 적용하면 새 핸들을 받고, 이전 만료 항목에 영향받지 않음
+    StatsComponent->RemoveBuffByHandle(RageHandle);
+    TestFalse(TEXT("Buff removed by handle"), StatsComponent->HasBuff(TEXT("Rage")));
+    TestEqual(TEXT("Attack back to base after removal"), StatsComponent->GetAttackPower(), BaseAttack, KINDA_SMALL_NUMBER);
+
+    const int32 ReappliedHandle = StatsComponent->ApplyBuff(MakeAttackBuff(TEXT("Rage"), 10.0f, 10.0f));
+    TestNotEqual(TEXT("Re-applied buff gets a fresh handle"), ReappliedHandle, RageHandle);
+    TestWorld.Tick(0.25f, 16);
+    TestTrue(TEXT("Stale heap entry of the removed buff does not expire the new one"), StatsComponent->HasBuff(TEXT("Rage")));
+
+    StatsComponent->ClearAllBuffs();
+    TestEqual(TEXT("Attack back to base after clearing"), StatsComponent->GetAttackPower(), BaseAttack, KINDA_SMALL_NUMBER);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSStatsComponentBuffThroughputTest, "HuntingSpirit.Characters.StatsComponent.Buffs.Throughput",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSStatsComponentBuffThroughputTest::RunTest(const FString& Parameters)
+{
+    using namespace HSStatsComponentBuffTests;
+
+    constexpr int32 BuffCount = 500;
+    constexpr int32 StacksPerBuff = 10;
+
+    FHSScopedTestWorld TestWorld;
+    UHSStatsComponent* StatsComponent = CreateStatsComponent(TestWorld);
+    const float BaseAttack = StatsComponent->GetAttackPower();
+
+    TArray<FString> BuffIDs;
+    BuffIDs.Reserve(BuffCount);
+    for (int32 Index = 0; Index < BuffCount; ++Index)
+    {
+        BuffIDs.Add(FString::Printf(TEXT("StackBuff_%d"), Index));
+    }
+
+    // 적용: 버프마다 최대 스택까지 반복 적용 (지속 시간은 0.5~2초로 분산)
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Stack = 0; Stack < StacksPerBuff; ++Stack)
+    {
+        for (int32 Index = 0; Index < BuffCount; ++Index)
+        {
+            StatsComponent->ApplyBuff(MakeAttackBuff(BuffIDs[Index], 0.1f, 0.5f + (Index % 16) * 0.1f));
+        }
+    }
+    const double ApplySeconds = FPlatformTime::Seconds() - StartTime;
+
+    TestEqual(TEXT("All buffs active"), StatsComponent->GetActiveBuffs().Num(), BuffCount);
+    TestEqual(TEXT("All stacks applied"), StatsComponent->GetAttackPower(), BaseAttack + BuffCount * StacksPerBuff * 0.1f, 0.01f);
+
+    // 제거: 절반을 ID로 제거
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < BuffCount; Index += 2)
+    {
+        StatsComponent->RemoveBuff(BuffIDs[Index]);
+    }
+    StatsComponent->GetAttackPower();
+    const double RemoveSeconds = FPlatformTime::Seconds() - StartTime;
+
+    TestEqual(TEXT("Half of the buffs removed"), StatsComponent->GetActiveBuffs().Num(), BuffCount / 2);
+
+    // 만료: 나머지는 단일 만료 타이머로 처리
+    StartTime = FPlatformTime::Seconds();
+    TestWorld.Tick(1.0f / 30.0f, 75);
+    const double ExpireSeconds = FPlatformTime::Seconds() - StartTime;
+
+    TestEqual(TEXT("Remaining buffs expired"), StatsComponent->GetActiveBuffs().Num(), 0);
+    TestEqual(TEXT("Attack back to base after expiry"), StatsComponent->GetAttackPower(), BaseAttack, 0.01f);
+
+    const int32 ApplyCount = BuffCount * StacksPerBuff;
+    AddInfo(FString::Printf(TEXT("%d applies: %.3f ms (%.2f us/apply), %d removes: %.3f ms, %d expirations over 75 frames: %.3f ms"),
+        ApplyCount, ApplySeconds * 1000.0, ApplySeconds * 1000000.0 / ApplyCount,
+        BuffCount / 2, RemoveSeconds * 1000.0,
+        BuffCount / 2, ExpireSeconds * 1000.0));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
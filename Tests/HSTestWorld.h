@@ -0,0 +1,61 @@
+// HSTestWorld.h
+// 자동화 테스트용 임시 게임 월드
+// 스코프 동안 월드 컨텍스트와 월드 서브시스템을 유지하고 종료 시 정리
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+class FHSScopedTestWorld
+{
+public:
+    FHSScopedTestWorld()
+    {
+        // Game 타입으로 생성해야 Game/PIE 전용 월드 서브시스템이 함께 초기화됨
+        World = UWorld::CreateWorld(EWorldType::Game, false);
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+    }
+
+    ~FHSScopedTestWorld()
+    {
+        if (World)
+        {
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+        }
+    }
+
+    FHSScopedTestWorld(const FHSScopedTestWorld&) = delete;
+    FHSScopedTestWorld& operator=(const FHSScopedTestWorld&) = delete;
+
+    UWorld* Get() const { return World; }
+
+    // 월드 시간과 타이머를 진행 (플레이 시작 전 월드도 타이머 매니저는 틱됨)
+    void Tick(float DeltaSeconds, int32 FrameCount = 1)
+    {
+        for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+            World->Tick(LEVELTICK_All, DeltaSeconds);
+            ++GFrameCounter;
+        }
+    }
+
+    template<typename ActorType>
+    ActorType* Spawn(const FVector& Location)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        return World->SpawnActor<ActorType>(ActorType::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+    }
+
+private:
+    UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
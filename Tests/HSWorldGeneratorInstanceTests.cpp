@@ -0,0 +1,177 @@
+// HSWorldGeneratorInstanceTests.cpp
+// 청크 인스턴스 메시 핸들 테이블 자동화 테스트
+// 수백 번의 청크 로드/언로드 후에도 핸들이 올바른 인스턴스를 가리키는지, 테이블/재빌드 비용이 누적되지 않는지 검증
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Tests/HSTestWorld.h"
+#include "HuntingSpirit/World/Generation/HSWorldGenerator.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSWorldGeneratorInstanceTests
+{
+    constexpr int32 CycleCount = 400;
+    constexpr int32 MaxLoadedChunks = 12;
+    constexpr int32 MinInstancesPerChunk = 16;
+    constexpr int32 MaxInstancesPerChunk = 64;
+
+    // 인스턴스 위치에 (청크 번호, 순번)을 인코딩해 핸들이 가리키는 인스턴스를 검증
+    FVector EncodeInstanceLocation(int32 ChunkSerial, int32 InstanceSerial)
+    {
+        return FVector(ChunkSerial * 100.0f, InstanceSerial * 100.0f, 0.0f);
+    }
+
+    UStaticMesh* LoadTestMesh(const TCHAR* Path)
+    {
+        UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, Path);
+        return Mesh ? Mesh : NewObject<UStaticMesh>();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSWorldGeneratorInstanceCycleTest, "HuntingSpirit.World.WorldGenerator.InstanceHandleCycles",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHSWorldGeneratorInstanceCycleTest::RunTest(const FString& Parameters)
+{
+    using namespace HSWorldGeneratorInstanceTests;
+
+    FHSScopedTestWorld TestWorld;
+    AHSWorldGenerator* Generator = TestWorld.Spawn<AHSWorldGenerator>(FVector::ZeroVector);
+    if (!TestNotNull(TEXT("World generator spawned"), Generator))
+    {
+        return false;
+    }
+
+    UStaticMesh* Meshes[] = {
+        LoadTestMesh(TEXT("/Engine/BasicShapes/Cube.Cube")),
+        LoadTestMesh(TEXT("/Engine/BasicShapes/Cylinder.Cylinder"))
+    };
+
+    FRandomStream Random(34);
+    TArray<FIntPoint> LoadedChunks;
+    TMap<FIntPoint, int32> ChunkSerials;
+    int32 NextChunkSerial = 0;
+    int32 PeakLiveInstances = 0;
+    int32 MismatchCount = 0;
+
+    double FirstWindowUnloadSeconds = 0.0;
+    double LastWindowUnloadSeconds = 0.0;
+    constexpr int32 WindowSize = 50;
+
+    // 로드된 모든 청크의 핸들이 인코딩한 위치의 인스턴스를 가리키는지 확인
+    auto VerifyLoadedChunks = [&]()
+    {
+        for (const FIntPoint& ChunkCoordinate : LoadedChunks)
+        {
+            const FWorldChunk& Chunk = Generator->GeneratedChunks.FindChecked(ChunkCoordinate);
+            const int32 ChunkSerial = ChunkSerials.FindChecked(ChunkCoordinate);
+            for (const FChunkInstancedMeshEntry& Entry : Chunk.InstancedMeshEntries)
+            {
+                const AHSWorldGenerator::FInstanceHandleTable& Table = Generator->InstanceHandleTables.FindChecked(Entry.Component.Get());
+                for (int32 Serial = 0; Serial < Entry.InstanceHandles.Num(); ++Serial)
+                {
+                    const int32 InstanceIndex = Table.InstanceByHandle[Entry.InstanceHandles[Serial]];
+                    FTransform InstanceTransform;
+                    if (InstanceIndex == INDEX_NONE || !Entry.Component->GetInstanceTransform(InstanceIndex, InstanceTransform, true)
+                        || !InstanceTransform.GetLocation().Equals(EncodeInstanceLocation(ChunkSerial, Serial), 0.1f))
+                    {
+                        ++MismatchCount;
+                    }
+                }
+            }
+        }
+    };
+
+    for (int32 Cycle = 0; Cycle < CycleCount; ++Cycle)
+    {
+        // 로드: 새 청크에 메시 두 종류의 인스턴스를 섞어 배치 (엔트리별 순번이 인스턴스 순서와 같도록 메시별로 순번 분리)
+        const FIntPoint ChunkCoordinate(Cycle, 0);
+        const int32 ChunkSerial = NextChunkSerial++;
+        FWorldChunk& Chunk = Generator->GeneratedChunks.Add(ChunkCoordinate);
+        Chunk.ChunkCoordinate = ChunkCoordinate;
+        Chunk.bIsGenerated = true;
+
+        const int32 InstanceCount = Random.RandRange(MinInstancesPerChunk, MaxInstancesPerChunk);
+        int32 SerialPerMesh[UE_ARRAY_COUNT(Meshes)] = {};
+        for (int32 Index = 0; Index < InstanceCount; ++Index)
+        {
+            const int32 MeshIndex = Random.RandRange(0, UE_ARRAY_COUNT(Meshes) - 1);
+            const FTransform InstanceTransform(EncodeInstanceLocation(ChunkSerial, SerialPerMesh[MeshIndex]++));
+            Generator->SpawnInstancedMesh(Chunk, Meshes[MeshIndex], InstanceTransform);
+        }
+        LoadedChunks.Add(ChunkCoordinate);
+        ChunkSerials.Add(ChunkCoordinate, ChunkSerial);
+
+        int32 LiveInstances = 0;
+        for (const TPair<UStaticMesh*, UHierarchicalInstancedStaticMeshComponent*>& Pair : Generator->InstancedMeshComponents)
+        {
+            LiveInstances += Pair.Value->GetInstanceCount();
+        }
+        PeakLiveInstances = FMath::Max(PeakLiveInstances, LiveInstances);
+
+        // 언로드: 상한을 넘으면 임의의 청크를 내려 중간 인스턴스가 스왑 제거되도록 함
+        if (LoadedChunks.Num() > MaxLoadedChunks)
+        {
+            const int32 UnloadIndex = Random.RandRange(0, LoadedChunks.Num() - 1);
+            const FIntPoint UnloadCoordinate = LoadedChunks[UnloadIndex];
+            LoadedChunks.RemoveAtSwap(UnloadIndex);
+            ChunkSerials.Remove(UnloadCoordinate);
+
+            const double StartTime = FPlatformTime::Seconds();
+            Generator->UnloadChunk(UnloadCoordinate);
+            const double UnloadSeconds = FPlatformTime::Seconds() - StartTime;
+
+            if (Cycle < MaxLoadedChunks + WindowSize)
+            {
+                FirstWindowUnloadSeconds += UnloadSeconds;
+            }
+            else if (Cycle >= CycleCount - WindowSize)
+            {
+                LastWindowUnloadSeconds += UnloadSeconds;
+            }
+        }
+
+        // 재빌드는 컴포넌트당 하나로 모여야 함
+        TestTrue(TEXT("Pending tree rebuilds are coalesced per component"),
+            Generator->PendingInstanceTreeRebuilds.Num() <= Generator->InstancedMeshComponents.Num());
+
+        if (Cycle % 10 == 0)
+        {
+            VerifyLoadedChunks();
+            TestWorld.Tick(1.0f / 60.0f);
+            TestEqual(TEXT("Tree rebuilds flushed on the next tick"), Generator->PendingInstanceTreeRebuilds.Num(), 0);
+        }
+    }
+
+    VerifyLoadedChunks();
+    TestEqual(TEXT("Every handle resolves to its own instance after all cycles"), MismatchCount, 0);
+
+    // 비용이 누적되지 않는지: 핸들 테이블은 동시에 살아 있던 최대 인스턴스 수를 넘지 않고, 인덱스 테이블은 컴포넌트와 일치
+    for (const TPair<UStaticMesh*, UHierarchicalInstancedStaticMeshComponent*>& Pair : Generator->InstancedMeshComponents)
+    {
+        const AHSWorldGenerator::FInstanceHandleTable& Table = Generator->InstanceHandleTables.FindChecked(Pair.Value);
+        TestEqual(TEXT("Index table matches component instance count"), Table.HandleByInstance.Num(), Pair.Value->GetInstanceCount());
+        TestTrue(FString::Printf(TEXT("Handle table (%d) bounded by peak live instances (%d)"), Table.InstanceByHandle.Num(), PeakLiveInstances),
+            Table.InstanceByHandle.Num() <= PeakLiveInstances);
+    }
+
+    AddInfo(FString::Printf(TEXT("%d load/unload cycles: first %d unloads %.3f ms, last %d unloads %.3f ms, peak %d live instances"),
+        CycleCount, WindowSize, FirstWindowUnloadSeconds * 1000.0, WindowSize, LastWindowUnloadSeconds * 1000.0, PeakLiveInstances));
+
+    // 모두 언로드하면 공유 컴포넌트와 테이블도 정리되어야 함
+    for (const FIntPoint& ChunkCoordinate : LoadedChunks)
+    {
+        Generator->UnloadChunk(ChunkCoordinate);
+    }
+    TestEqual(TEXT("Instance components released after unloading every chunk"), Generator->InstancedMeshComponents.Num(), 0);
+    TestEqual(TEXT("Handle tables released after unloading every chunk"), Generator->InstanceHandleTables.Num(), 0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
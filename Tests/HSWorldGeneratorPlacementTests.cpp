@@ -0,0 +1,136 @@
+// HSWorldGeneratorPlacementTests.cpp
+// 청크 오브젝트 배치 자동화 테스트
+// 밀도별로 청크당 배치 시간을 측정하고, 버킷 격자 간격 검사가 최소 거리를 지키는지 전수 비교로 검증
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HuntingSpirit/Tests/HSTestWorld.h"
+#include "HuntingSpirit/World/Generation/HSWorldGenerator.h"
+#include "HuntingSpirit/World/Generation/HSBiomeData.h"
+#include "Engine/StaticMeshActor.h"
+#include "HAL/PlatformTime.h"
+
+namespace HSWorldGeneratorPlacementTests
+{
+    constexpr int32 Densities[] = { 100, 500, 2000, 5000 };
+    constexpr int32 ChunksPerDensity = 3;
+    constexpr float MinDistanceBetweenObjects = 40.0f;
+
+    // 메시 생성 단계가 넘겨주는 것과 같은 형태의 완만한 합성 높이맵
+    TArray<float> MakeHeightmap(int32 Resolution)
+    {
+        TArray<float> Heightmap;
+        Heightmap.SetNumUninitialized(Resolution * Resolution);
+        for (int32 Y = 0; Y < Resolution; ++Y)
+        {
+            for (int32 X = 0; X < Resolution; ++X)
+            {
+                Heightmap[Y * Resolution + X] = 200.0f * FMath::Sin(X * 0.2f) * FMath::Cos(Y * 0.15f);
+            }
+        }
+        return Heightmap;
+    }
+
+    // 같은 청크 안에서 최소 거리보다 가까운 배치 쌍 수 (O(n²) 기준값)
+    int32 CountSpacingViolations(const TArray<AActor*>& Actors, float MinDistance)
+    {
+        const float MinDistanceSq = FMath::Square(MinDistance) - KINDA_SMALL_NUMBER;
+        int32 Violations = 0;
+        for (int32 A = 0; A < Actors.Num(); ++A)
+        {
+            const FVector2D LocationA(Actors[A]->GetActorLocation());
+            for (int32 B = A + 1; B < Actors.Num(); ++B)
+            {
+                if (FVector2D::DistSquared(LocationA, FVector2D(Actors[B]->GetActorLocation())) < MinDistanceSq)
+                {
+                    ++Violations;
+                }
+            }
+        }
+        return Violations;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHSWorldGeneratorPlacementDensityTest, "HuntingSpirit.World.WorldGenerator.PlacementDensity",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHSWorldGeneratorPlacementDensityTest::RunTest(const FString& Parameters)
+{
+    using namespace HSWorldGeneratorPlacementTests;
+
+    FHSScopedTestWorld TestWorld;
+    AHSWorldGenerator* Generator = TestWorld.Spawn<AHSWorldGenerator>(FVector::ZeroVector);
+    if (!TestNotNull(TEXT("World generator spawned"), Generator))
+    {
+        return false;
+    }
+
+    Generator->RandomStream.Initialize(37);
+    const float ChunkSize = Generator->GenerationSettings.ChunkSize;
+    const TArray<float> Heightmap = MakeHeightmap(Generator->GenerationSettings.TerrainResolution);
+
+    // 루트 컴포넌트가 있어 배치 위치가 그대로 남고, 메시가 없어 스폰 충돌 보정이 일어나지 않는 액터로 배치
+    UHSBiomeData* BiomeData = NewObject<UHSBiomeData>();
+    FBiomeSpawnableObject& Spawnable = BiomeData->ResourceNodes.AddDefaulted_GetRef();
+    Spawnable.ActorClass = AStaticMeshActor::StaticClass();
+    Spawnable.SpawnProbability = 1.0f;
+    Spawnable.MinDistanceBetweenObjects = MinDistanceBetweenObjects;
+    Spawnable.bAlignToSurface = true;
+
+    for (int32 Density : Densities)
+    {
+        Spawnable.MinSpawnCount = Density;
+        Spawnable.MaxSpawnCount = Density;
+
+        double TotalPlacementMs = 0.0;
+        int32 TotalPlaced = 0;
+        int32 Violations = 0;
+        int32 OutOfBounds = 0;
+
+        for (int32 ChunkIndex = 0; ChunkIndex < ChunksPerDensity; ++ChunkIndex)
+        {
+            FWorldChunk Chunk;
+            Chunk.ChunkCoordinate = FIntPoint(ChunkIndex, Density);
+            Chunk.BiomeData = BiomeData;
+
+            Generator->SpawnObjectsInChunk(Chunk, Heightmap);
+
+            const FHSChunkStreamingStats Stats = Generator->GetChunkStreamingStats();
+            TotalPlacementMs += Stats.LastChunkPlacementMs;
+            TotalPlaced += Stats.LastChunkPlacementCount;
+            TestEqual(TEXT("Placement count matches spawned actors"), Stats.LastChunkPlacementCount, Chunk.SpawnedActors.Num());
+
+            const FVector ChunkCenter = Generator->ChunkToWorldLocation(Chunk.ChunkCoordinate);
+            for (const AActor* Actor : Chunk.SpawnedActors)
+            {
+                const FVector Offset = Actor->GetActorLocation() - ChunkCenter;
+                if (FMath::Abs(Offset.X) > ChunkSize * 0.5f + 1.0f || FMath::Abs(Offset.Y) > ChunkSize * 0.5f + 1.0f)
+                {
+                    ++OutOfBounds;
+                }
+            }
+            Violations += CountSpacingViolations(Chunk.SpawnedActors, MinDistanceBetweenObjects);
+
+            for (AActor* Actor : Chunk.SpawnedActors)
+            {
+                Actor->Destroy();
+            }
+        }
+
+        TestEqual(FString::Printf(TEXT("Density %d: no placements closer than the minimum distance"), Density), Violations, 0);
+        TestEqual(FString::Printf(TEXT("Density %d: placements stay inside the chunk"), Density), OutOfBounds, 0);
+        TestTrue(FString::Printf(TEXT("Density %d: objects were placed"), Density), TotalPlaced > 0);
+
+        const double AverageMs = TotalPlacementMs / ChunksPerDensity;
+        AddInfo(FString::Printf(TEXT("Requested %d objects/chunk: placed %.0f avg, %.3f ms/chunk incl. actor spawn, %.2f us/object"),
+            Density, (double)TotalPlaced / ChunksPerDensity, AverageMs,
+            TotalPlaced > 0 ? TotalPlacementMs * 1000.0 / TotalPlaced : 0.0));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -9,12 +9,30 @@
 #include "Blueprint/UserWidget.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
+#include "Stats/Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("HUD Damage Numbers Update"), STAT_HSDamageNumbersUpdate, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Numbers Merged"), STAT_HSDamageNumbersMerged, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Numbers Dropped"), STAT_HSDamageNumbersDropped, STATGROUP_Game);
 
 AHSGameHUD::AHSGameHUD()
 {
+    // 데미지 넘버 갱신을 HUD 틱 한 곳에서 처리
+    PrimaryActorTick.bCanEverTick = true;
+
     // HUD 가시성 기본값 설정
     bIsHUDVisible = true;
     bShowDebugInfo = false;
+
+    // 데미지 넘버 기본값 설정
+    DamageNumberCoalesceWindow = 0.3f;
+    DamageNumberMergeRadius = 100.0f;
+    DamageNumberLifetime = 1.5f;
+    MaxCoalescedDamageNumberAge = 3.0f;
+    MaxNewDamageNumbersPerFrame = 6;
+    DamageNumberRiseSpeed = 60.0f;
+    MergedDamageNumberCount = 0;
+    DroppedDamageNumberCount = 0;
 }
 
 void AHSGameHUD::BeginPlay()
@@ -47,9 +65,23 @@ void AHSGameHUD::DrawHUD()
         const int32 PooledCount = DamageNumberPool.Num();
         DrawText(FString::Printf(TEXT("Pooled Damage Numbers: %d/%d"), PooledCount, DamageNumberPoolSize), 
                 FColor::Yellow, 10, 50);
+
+        // 합쳐진/버려진 데미지 넘버 누계
+        DrawText(FString::Printf(TEXT("Merged/Dropped Damage Numbers: %d/%d"), MergedDamageNumberCount, DroppedDamageNumberCount), 
+                FColor::Yellow, 10, 70);
     }
 }
 
+void AHSGameHUD::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    SCOPE_CYCLE_COUNTER(STAT_HSDamageNumbersUpdate);
+
+    FlushPendingDamageNumbers();
+    UpdateActiveDamageNumbers(DeltaSeconds);
+}
+
 void AHSGameHUD::UpdateHealthBar(float CurrentHealth, float MaxHealth)
 {
     if (HealthBarWidget)
@@ -66,35 +98,168 @@ void AHSGameHUD::UpdateStaminaBar(float CurrentStamina, float MaxStamina)
     }
 }
 
-void AHSGameHUD::ShowDamageNumber(float Damage, FVector WorldLocation, bool bIsCritical)
+void AHSGameHUD::ShowDamageNumber(float Damage, FVector WorldLocation, bool bIsCritical, AActor* DamageTarget)
 {
-    // 데미지 넘버 위젯을 풀에서 가져오기
-    UHSDamageNumberWidget* DamageNumberWidget = GetDamageNumberFromPool();
-    
-    if (DamageNumberWidget)
+    // 같은 대상의 연속 타격은 기존 넘버에 누적
+    if (TryCoalesceDamageNumber(Damage, WorldLocation, bIsCritical, DamageTarget))
+    {
+        ++MergedDamageNumberCount;
+        INC_DWORD_STAT(STAT_HSDamageNumbersMerged);
+        return;
+    }
+
+    // 실제 생성은 틱에서 프레임 예산 안에서 처리
+    FPendingDamageNumber& PendingNumber = PendingDamageNumbers.AddDefaulted_GetRef();
+    PendingNumber.Target = DamageTarget;
+    PendingNumber.WorldLocation = WorldLocation;
+    PendingNumber.Damage = Damage;
+    PendingNumber.bIsCritical = bIsCritical;
+}
+
+bool AHSGameHUD::IsSameDamageNumberTarget(const TWeakObjectPtr<AActor>& NumberTarget, const FVector& NumberLocation, AActor* DamageTarget, const FVector& WorldLocation) const
+{
+    if (DamageTarget)
+    {
+        return NumberTarget.Get() == DamageTarget;
+    }
+
+    // 대상 없이 요청된 타격은 대상 없는 넘버 중 가까운 것에만 합침 (파괴된 대상의 넘버는 제외)
+    return NumberTarget.IsExplicitlyNull() &&
+        FVector::DistSquared(NumberLocation, WorldLocation) <= FMath::Square(DamageNumberMergeRadius);
+}
+
+bool AHSGameHUD::TryCoalesceDamageNumber(float Damage, const FVector& WorldLocation, bool bIsCritical, AActor* DamageTarget)
+{
+    // 아직 생성되지 않은 같은 프레임의 요청
+    for (FPendingDamageNumber& PendingNumber : PendingDamageNumbers)
+    {
+        if (IsSameDamageNumberTarget(PendingNumber.Target, PendingNumber.WorldLocation, DamageTarget, WorldLocation))
+        {
+            PendingNumber.Damage += Damage;
+            PendingNumber.WorldLocation = WorldLocation;
+            PendingNumber.bIsCritical |= bIsCritical;
+            return true;
+        }
+    }
+
+    // 화면에 떠 있는 넘버 (합치는 시간 안이고 너무 오래 표시되지 않은 경우만)
+    for (FHSActiveDamageNumber& ActiveNumber : ActiveDamageNumbers)
+    {
+        if (!ActiveNumber.Widget ||
+            !IsSameDamageNumberTarget(ActiveNumber.Target, ActiveNumber.WorldLocation, DamageTarget, WorldLocation) ||
+            ActiveNumber.Age - ActiveNumber.LastHitAge > DamageNumberCoalesceWindow ||
+            ActiveNumber.Age >= MaxCoalescedDamageNumberAge)
+        {
+            continue;
+        }
+
+        ActiveNumber.AccumulatedDamage += Damage;
+        ActiveNumber.WorldLocation = WorldLocation;
+        ActiveNumber.bIsCritical |= bIsCritical;
+        ActiveNumber.LastHitAge = ActiveNumber.Age;
+        ActiveNumber.ExpireAge = ActiveNumber.Age + DamageNumberLifetime;
+
+        // 값만 갱신하고 강조 애니메이션을 다시 재생 (상승 위치는 이어서 진행)
+        ActiveNumber.Widget->SetDamageNumber(ActiveNumber.AccumulatedDamage, ActiveNumber.bIsCritical);
+        ActiveNumber.Widget->PlayDamageAnimation();
+        return true;
+    }
+
+    return false;
+}
+
+void AHSGameHUD::FlushPendingDamageNumbers()
+{
+    if (PendingDamageNumbers.Num() == 0)
     {
-        // 월드 좌표를 스크린 좌표로 변환
+        return;
+    }
+
+    // 예산을 넘으면 치명타를 먼저 생성 (같은 종류끼리는 요청 순서 유지)
+    if (PendingDamageNumbers.Num() > MaxNewDamageNumbersPerFrame)
+    {
+        PendingDamageNumbers.StableSort([](const FPendingDamageNumber& A, const FPendingDamageNumber& B)
+        {
+            return A.bIsCritical && !B.bIsCritical;
+        });
+    }
+
+    APlayerController* PlayerController = GetOwningPlayerController();
+    int32 SpawnedCount = 0;
+
+    for (const FPendingDamageNumber& PendingNumber : PendingDamageNumbers)
+    {
+        if (SpawnedCount >= MaxNewDamageNumbersPerFrame)
+        {
+            ++DroppedDamageNumberCount;
+            INC_DWORD_STAT(STAT_HSDamageNumbersDropped);
+            continue;
+        }
+
+        // 화면 밖 타격은 예산을 쓰지 않고 건너뜀
+        FVector2D ScreenLocation;
+        if (!UGameplayStatics::ProjectWorldToScreen(PlayerController, PendingNumber.WorldLocation, ScreenLocation))
+        {
+            continue;
+        }
+
+        UHSDamageNumberWidget* DamageNumberWidget = GetDamageNumberFromPool();
+        if (!DamageNumberWidget)
+        {
+            ++DroppedDamageNumberCount;
+            INC_DWORD_STAT(STAT_HSDamageNumbersDropped);
+            continue;
+        }
+
+        // 데미지 넘버 설정 및 애니메이션 시작
+        DamageNumberWidget->SetDamageNumber(PendingNumber.Damage, PendingNumber.bIsCritical);
+        DamageNumberWidget->SetPositionInViewport(ScreenLocation);
+        DamageNumberWidget->PlayDamageAnimation();
+
+        // 활성 리스트에 추가
+        FHSActiveDamageNumber& ActiveNumber = ActiveDamageNumbers.AddDefaulted_GetRef();
+        ActiveNumber.Widget = DamageNumberWidget;
+        ActiveNumber.Target = PendingNumber.Target;
+        ActiveNumber.WorldLocation = PendingNumber.WorldLocation;
+        ActiveNumber.AccumulatedDamage = PendingNumber.Damage;
+        ActiveNumber.bIsCritical = PendingNumber.bIsCritical;
+        ActiveNumber.ExpireAge = DamageNumberLifetime;
+
+        ++SpawnedCount;
+    }
+
+    PendingDamageNumbers.Reset();
+}
+
+void AHSGameHUD::UpdateActiveDamageNumbers(float DeltaSeconds)
+{
+    APlayerController* PlayerController = GetOwningPlayerController();
+
+    for (int32 i = ActiveDamageNumbers.Num() - 1; i >= 0; --i)
+    {
+        FHSActiveDamageNumber& ActiveNumber = ActiveDamageNumbers[i];
+        ActiveNumber.Age += DeltaSeconds;
+
+        // 수명이 끝났으면 풀로 반환
+        if (ActiveNumber.Age >= ActiveNumber.ExpireAge || !ActiveNumber.Widget)
+        {
+            ReturnDamageNumberToPool(ActiveNumber.Widget);
+            ActiveDamageNumbers.RemoveAtSwap(i, 1, false);
+            continue;
+        }
+
+        // 카메라 이동을 따라가도록 다시 투영하고 경과 시간만큼 위로 올림
         FVector2D ScreenLocation;
-        if (UGameplayStatics::ProjectWorldToScreen(GetOwningPlayerController(), WorldLocation, ScreenLocation))
+        const bool bOnScreen = UGameplayStatics::ProjectWorldToScreen(PlayerController, ActiveNumber.WorldLocation, ScreenLocation);
+        if (bOnScreen != ActiveNumber.bOnScreen)
         {
-            // 데미지 넘버 설정 및 애니메이션 시작
-            DamageNumberWidget->SetDamageNumber(Damage, bIsCritical);
-            DamageNumberWidget->SetPositionInViewport(ScreenLocation);
-            DamageNumberWidget->PlayDamageAnimation();
-            
-            // 활성 리스트에 추가
-            ActiveDamageNumbers.Add(DamageNumberWidget);
-            
-            // 애니메이션 완료 후 풀로 반환하는 콜백 설정
-            FTimerHandle TimerHandle;
-            FTimerDelegate TimerDelegate;
-            TimerDelegate.BindLambda([this, DamageNumberWidget]()
-            {
-                ReturnDamageNumberToPool(DamageNumberWidget);
-            });
-            
-            // 1.5초 후 풀로 반환
-            GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, 1.5f, false);
+            ActiveNumber.bOnScreen = bOnScreen;
+            ActiveNumber.Widget->SetVisibility(bOnScreen ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Hidden);
+        }
+
+        if (bOnScreen)
+        {
+            ActiveNumber.Widget->SetPositionInViewport(ScreenLocation - FVector2D(0.0f, DamageNumberRiseSpeed * ActiveNumber.Age));
         }
     }
 }
@@ -225,10 +390,7 @@ void AHSGameHUD::ReturnDamageNumberToPool(UHSDamageNumberWidget* DamageNumber)
 {
     if (DamageNumber)
     {
-        // 활성 리스트에서 제거
-        ActiveDamageNumbers.Remove(DamageNumber);
-        
-        // 위젯 초기화 및 숨기기
+        // 위젯 초기화 및 숨기기 (활성 리스트에서는 호출자가 제거)
         DamageNumber->SetVisibility(ESlateVisibility::Hidden);
         
         // 풀에 반환
@@ -11,6 +11,34 @@ class UHSStaminaBarWidget;
 class UHSDamageNumberWidget;
 class UUserWidget;
 
+/**
+ * 화면에 표시 중인 데미지 넘버
+ * 같은 대상의 연속 타격은 하나의 항목에 누적됨
+ */
+USTRUCT()
+struct FHSActiveDamageNumber
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    UHSDamageNumberWidget* Widget = nullptr;
+
+    // 누적 대상 (없으면 WorldLocation 근접 여부로 합침)
+    TWeakObjectPtr<AActor> Target;
+
+    FVector WorldLocation = FVector::ZeroVector;
+    float AccumulatedDamage = 0.0f;
+    bool bIsCritical = false;
+    bool bOnScreen = true;
+
+    // 표시 후 경과 시간, 이 시간에 도달하면 풀로 반환
+    float Age = 0.0f;
+    float ExpireAge = 0.0f;
+
+    // 마지막으로 합쳐진 타격 시점 (Age 기준)
+    float LastHitAge = 0.0f;
+};
+
 /**
  * HuntingSpirit 게임의 메인 HUD 클래스
  * 체력바, 스태미너바, 데미지 표시 등 인게임 UI를 관리합니다.
@@ -30,6 +58,9 @@ protected:
     // HUD 그리기 (디버그 정보 등)
     virtual void DrawHUD() override;
 
+    // 데미지 넘버 생성 및 수명/투영 갱신 (프레임당 한 번)
+    virtual void Tick(float DeltaSeconds) override;
+
 public:
     // 체력바 업데이트
     UFUNCTION(BlueprintCallable, Category = "HUD")
@@ -39,9 +70,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HUD")
     void UpdateStaminaBar(float CurrentStamina, float MaxStamina);
     
-    // 데미지 표시
+    // 데미지 표시 (짧은 시간 내 같은 대상의 타격을 하나로 합침, DamageTarget이 없으면 가까운 위치의 타격끼리 합침)
     UFUNCTION(BlueprintCallable, Category = "HUD")
-    void ShowDamageNumber(float Damage, FVector WorldLocation, bool bIsCritical = false);
+    void ShowDamageNumber(float Damage, FVector WorldLocation, bool bIsCritical = false, AActor* DamageTarget = nullptr);
+
+    // 통계
+    int32 GetMergedDamageNumberCount() const { return MergedDamageNumberCount; }
+    int32 GetDroppedDamageNumberCount() const { return DroppedDamageNumberCount; }
     
     // HUD 표시/숨기기 (AHUD 오버라이드)
     virtual void ShowHUD() override;
@@ -75,9 +110,33 @@ protected:
     UPROPERTY()
     TArray<UHSDamageNumberWidget*> DamageNumberPool;
     
-    // 활성화된 데미지 넘버 위젯들
+    // 활성화된 데미지 넘버들
     UPROPERTY()
-    TArray<UHSDamageNumberWidget*> ActiveDamageNumbers;
+    TArray<FHSActiveDamageNumber> ActiveDamageNumbers;
+
+    // 같은 대상의 타격을 합치는 시간 (마지막 타격 이후, 초)
+    UPROPERTY(EditDefaultsOnly, Category = "Damage Numbers")
+    float DamageNumberCoalesceWindow;
+
+    // 데미지 넘버 표시 시간 (초, 합쳐질 때마다 다시 연장)
+    UPROPERTY(EditDefaultsOnly, Category = "Damage Numbers")
+    float DamageNumberLifetime;
+
+    // 대상 없이 요청된 타격을 같은 넘버로 합치는 거리 (월드 단위)
+    UPROPERTY(EditDefaultsOnly, Category = "Damage Numbers")
+    float DamageNumberMergeRadius;
+
+    // 이 시간 이상 표시된 넘버에는 더 합치지 않고 새 넘버를 띄움 (초)
+    UPROPERTY(EditDefaultsOnly, Category = "Damage Numbers")
+    float MaxCoalescedDamageNumberAge;
+
+    // 프레임당 새로 띄울 수 있는 데미지 넘버 수 (치명타 우선, 초과분은 버림)
+    UPROPERTY(EditDefaultsOnly, Category = "Damage Numbers")
+    int32 MaxNewDamageNumbersPerFrame;
+
+    // 데미지 넘버 상승 속도 (화면 픽셀/초)
+    UPROPERTY(EditDefaultsOnly, Category = "Damage Numbers")
+    float DamageNumberRiseSpeed;
 
 private:
     // 위젯 생성 및 초기화
@@ -92,6 +151,32 @@ private:
     // 데미지 넘버 위젯을 풀로 반환
     void ReturnDamageNumberToPool(UHSDamageNumberWidget* DamageNumber);
 
+    // 활성/대기 중인 같은 대상의 넘버에 합치기 (성공 시 true)
+    bool TryCoalesceDamageNumber(float Damage, const FVector& WorldLocation, bool bIsCritical, AActor* DamageTarget);
+
+    // 기존 넘버가 새 타격과 같은 대상인지 (대상이 없으면 둘 다 대상 없이 가까운 위치일 때)
+    bool IsSameDamageNumberTarget(const TWeakObjectPtr<AActor>& NumberTarget, const FVector& NumberLocation, AActor* DamageTarget, const FVector& WorldLocation) const;
+
+    // 이번 프레임에 요청된 넘버를 예산 안에서 생성
+    void FlushPendingDamageNumbers();
+
+    // 활성 넘버의 수명과 화면 위치 갱신
+    void UpdateActiveDamageNumbers(float DeltaSeconds);
+
+    // 이번 프레임에 요청된 새 데미지 넘버
+    struct FPendingDamageNumber
+    {
+        TWeakObjectPtr<AActor> Target;
+        FVector WorldLocation = FVector::ZeroVector;
+        float Damage = 0.0f;
+        bool bIsCritical = false;
+    };
+    TArray<FPendingDamageNumber> PendingDamageNumbers;
+
+    // 통계
+    int32 MergedDamageNumberCount;
+    int32 DroppedDamageNumberCount;
+
     // HUD 가시성 상태
     bool bIsHUDVisible;
     
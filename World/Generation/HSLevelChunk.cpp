@@ -165,8 +165,8 @@ void AHSLevelChunk::GenerateChunkMesh()
         return;
     }
     
-    // 메시 생성기를 통해 지형 메시 생성
-    MeshGenerator->GenerateTerrainMesh(
+    // 메시 생성기를 통해 지형 메시 생성 (용접/최적화는 워커 스레드, 섹션 생성은 완료 후 게임 스레드)
+    MeshGenerator->GenerateTerrainMeshAsync(
         TerrainMeshComponent,
         ChunkData.ChunkSize,
         ChunkData.HeightMap,
@@ -176,7 +176,7 @@ void AHSLevelChunk::GenerateChunkMesh()
     // 청크 경계 블렌딩
     BlendChunkBorders();
     
-    UE_LOG(LogTemp, Log, TEXT("청크 메시 생성 완료: (%d, %d)"), 
+    UE_LOG(LogTemp, Log, TEXT("청크 메시 생성 요청 완료: (%d, %d)"), 
         ChunkData.ChunkCoordinate.X, 
         ChunkData.ChunkCoordinate.Y);
 }
@@ -292,6 +292,12 @@ float AHSLevelChunk::GetDistanceToPlayer() const
 // 청크 메모리 정리
 void AHSLevelChunk::CleanupChunk()
 {
+    // 진행 중인 비동기 메시 빌드 결과가 정리 후에 적용되지 않도록 무효화
+    if (MeshGenerator)
+    {
+        MeshGenerator->CancelPendingAsyncBuilds();
+    }
+    
     // 메시 클리어
     if (TerrainMeshComponent)
     {
@@ -317,6 +323,12 @@ void AHSLevelChunk::CleanupChunk()
             return;
         }
 
+        // 언로드되는 노드는 공간 레지스트리에서 해제
+        if (AHSResourceNode* ResourceNode = Cast<AHSResourceNode>(Actor))
+        {
+            ResourceNode->SetSpatiallyRegistered(false);
+        }
+
         if (ResourceNodePool.IsValid())
         {
             ResourceNodePool->ReturnObjectToPool(Actor);
@@ -913,6 +925,12 @@ void AHSLevelChunk::SpawnResourceNodesInChunk()
 
             if (SpawnedNode)
             {
+                // 배치가 끝난 위치 기준으로 공간 레지스트리에 등록
+                if (AHSResourceNode* ResourceNode = Cast<AHSResourceNode>(SpawnedNode))
+                {
+                    ResourceNode->SetSpatiallyRegistered(true);
+                }
+
                 SpawnedActors.Add(SpawnedNode);
                 ActiveResourceNodes.Add(TWeakObjectPtr<AActor>(SpawnedNode));
             }
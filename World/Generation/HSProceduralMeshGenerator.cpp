@@ -3,6 +3,39 @@
 #include "ProceduralMeshComponent.h"
 #include "Engine/Engine.h"
 #include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "Stats/Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Procedural Mesh Weld Vertices"), STAT_HSWeldVertices, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Procedural Mesh Vertex Cache Optimize"), STAT_HSOptimizeVertexCache, STATGROUP_Game);
+
+namespace HSProceduralMeshConstants
+{
+    // 용접 허용 노말 차이 (내적 기준, 약 2.5도)
+    static constexpr float NormalWeldDotThreshold = 0.999f;
+
+    // 용접 허용 UV 차이
+    static constexpr float UVWeldTolerance = 1.0e-4f;
+
+    // 정점 캐시 최적화 대상 캐시 크기와 Forsyth 점수 상수
+    static constexpr int32 VertexCacheSize = 32;
+    static constexpr float ForsythCacheDecayPower = 1.5f;
+    static constexpr float ForsythLastTriangleScore = 0.75f;
+    static constexpr float ForsythValenceBoostScale = 2.0f;
+
+    // 새 순서에 맞춰 정점 속성 배열 재배치
+    template<typename T>
+    void PermuteVertexAttribute(TArray<T>& Attribute, const TArray<int32>& NewIndexOf)
+    {
+        TArray<T> Reordered;
+        Reordered.SetNumUninitialized(Attribute.Num());
+        for (int32 OldIndex = 0; OldIndex < Attribute.Num(); OldIndex++)
+        {
+            Reordered[NewIndexOf[OldIndex]] = Attribute[OldIndex];
+        }
+        Attribute = MoveTemp(Reordered);
+    }
+}
 
 // 생성자
 HSProceduralMeshGenerator::HSProceduralMeshGenerator()
@@ -59,62 +92,22 @@ void HSProceduralMeshGenerator::GenerateTerrainMesh(
     // 성능 측정 시작
     double StartTime = FPlatformTime::Seconds();
     
-    // LOD 설정 가져오기
-    FMeshLODSettings LODSettings = GetLODSettings(LODLevel);
-    
-    // 높이 맵 크기 계산 (정사각형 가정)
-    int32 MapSize = FMath::Sqrt((float)HeightMap.Num());
-    if (MapSize * MapSize != HeightMap.Num())
+    // 메모리 풀 버퍼에 메시 데이터 빌드
+    FProceduralMeshBuildData& MeshData = MeshDataPool;
+    if (!BuildTerrainMeshData(HeightMap, ChunkSize, GetLODSettings(LODLevel), MeshData))
     {
-        UE_LOG(LogTemp, Error, TEXT("HeightMap이 정사각형이 아닙니다"));
         return;
     }
     
-    // 메모리 풀에서 배열 가져오기
-    TArray<FVector>& Vertices = VertexPool;
-    TArray<FVector>& Normals = NormalPool;
-    TArray<FVector2D>& UVs = UVPool;
-    TArray<int32>& Triangles = TrianglePool;
-    TArray<FProcMeshTangent>& Tangents = TangentPool;
-    
-    // 배열 초기화
-    Vertices.Reset();
-    Normals.Reset();
-    UVs.Reset();
-    Triangles.Reset();
-    Tangents.Reset();
-    
-    // 정점 생성
-    CreateTerrainVertices(Vertices, Normals, UVs, HeightMap, ChunkSize, LODLevel);
-    
-    // 삼각형 생성
-    int32 GridSize = MapSize / LODSettings.VertexReductionFactor;
-    CreateTerrainTriangles(Triangles, GridSize, GridSize, LODLevel);
-    
-    // 노말 스무딩
-    if (LODSettings.NormalSmoothingAngle > 0)
-    {
-        SmoothNormals(Normals, Vertices, Triangles, LODSettings.NormalSmoothingAngle);
-    }
-    
-    // 탄젠트 계산
-    if (LODSettings.bGenerateTangents)
-    {
-        CalculateTangents(Vertices, UVs, Triangles, Tangents);
-    }
-    
-    // 메시 최적화
-    OptimizeMesh(Vertices, Triangles, 0.1f);
-    
     // 메시 컴포넌트에 데이터 설정
     MeshComponent->CreateMeshSection_LinearColor(
         0, // 섹션 인덱스
-        Vertices,
-        Triangles,
-        Normals,
-        UVs,
+        MeshData.Vertices,
+        MeshData.Triangles,
+        MeshData.Normals,
+        MeshData.UVs,
         TArray<FLinearColor>(), // 버텍스 컬러 (사용 안 함)
-        Tangents,
+        MeshData.Tangents,
         true // 충돌 생성
     );
     
@@ -123,13 +116,114 @@ void HSProceduralMeshGenerator::GenerateTerrainMesh(
     
     // 성능 통계 업데이트
     PerfStats.LastGenerationTime = FPlatformTime::Seconds() - StartTime;
-    PerfStats.LastVertexCount = Vertices.Num();
-    PerfStats.LastTriangleCount = Triangles.Num() / 3;
+    PerfStats.LastVertexCount = MeshData.Vertices.Num();
+    PerfStats.LastTriangleCount = MeshData.Triangles.Num() / 3;
     
-    UE_LOG(LogTemp, Log, TEXT("지형 메시 생성 완료: %.2fms, 정점: %d, 삼각형: %d"),
+    UE_LOG(LogTemp, Log, TEXT("지형 메시 생성 완료: %.2fms, 정점: %d, 삼각형: %d, ACMR: %.3f -> %.3f, 정점 처리: %.1f 정점/ms"),
         PerfStats.LastGenerationTime * 1000.0f,
         PerfStats.LastVertexCount,
-        PerfStats.LastTriangleCount);
+        PerfStats.LastTriangleCount,
+        MeshData.ACMRBefore,
+        MeshData.ACMRAfter,
+        MeshData.VerticesPerMs);
+}
+
+// 지형 메시 비동기 생성 함수
+void HSProceduralMeshGenerator::GenerateTerrainMeshAsync(
+    UProceduralMeshComponent* MeshComponent,
+    float ChunkSize,
+    const TArray<float>& HeightMap,
+    int32 LODLevel)
+{
+    if (!MeshComponent)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MeshComponent가 null입니다"));
+        return;
+    }
+    
+    // 워커에는 생성기 대신 필요한 값만 복사해 전달 (생성기가 먼저 파괴될 수 있음)
+    const int32 BuildSerial = AsyncBuildSerial->Increment();
+    TSharedRef<FThreadSafeCounter, ESPMode::ThreadSafe> SerialCounter = AsyncBuildSerial;
+    TWeakObjectPtr<UProceduralMeshComponent> WeakMeshComponent(MeshComponent);
+    const FMeshLODSettings LODSettings = GetLODSettings(LODLevel);
+    
+    Async(EAsyncExecution::ThreadPool, [HeightMap, ChunkSize, LODSettings, WeakMeshComponent, SerialCounter, BuildSerial]()
+    {
+        TSharedRef<FProceduralMeshBuildData, ESPMode::ThreadSafe> MeshData = MakeShared<FProceduralMeshBuildData, ESPMode::ThreadSafe>();
+        if (!BuildTerrainMeshData(HeightMap, ChunkSize, LODSettings, *MeshData))
+        {
+            return;
+        }
+        
+        // 메시 섹션 생성은 게임 스레드에서
+        AsyncTask(ENamedThreads::GameThread, [MeshData, WeakMeshComponent, SerialCounter, BuildSerial]()
+        {
+            UProceduralMeshComponent* TargetComponent = WeakMeshComponent.Get();
+            if (!TargetComponent || SerialCounter->GetValue() != BuildSerial)
+            {
+                return;
+            }
+            
+            TargetComponent->CreateMeshSection_LinearColor(
+                0,
+                MeshData->Vertices,
+                MeshData->Triangles,
+                MeshData->Normals,
+                MeshData->UVs,
+                TArray<FLinearColor>(),
+                MeshData->Tangents,
+                true
+            );
+            
+            UE_LOG(LogTemp, Log, TEXT("지형 메시 비동기 생성 완료: 빌드 %.2fms, 정점: %d, 삼각형: %d, ACMR: %.3f -> %.3f, 정점 처리: %.1f 정점/ms"),
+                MeshData->BuildTimeSeconds * 1000.0,
+                MeshData->Vertices.Num(),
+                MeshData->Triangles.Num() / 3,
+                MeshData->ACMRBefore,
+                MeshData->ACMRAfter,
+                MeshData->VerticesPerMs);
+        });
+    });
+}
+
+// 지형 메시 데이터 빌드 함수
+bool HSProceduralMeshGenerator::BuildTerrainMeshData(
+    const TArray<float>& HeightMap,
+    float ChunkSize,
+    const FMeshLODSettings& LODSettings,
+    FProceduralMeshBuildData& OutData)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutData.Reset();
+    
+    // 높이 맵 크기 계산 (정사각형 가정)
+    int32 MapSize = FMath::Sqrt((float)HeightMap.Num());
+    if (MapSize < 2 || MapSize * MapSize != HeightMap.Num())
+    {
+        UE_LOG(LogTemp, Error, TEXT("HeightMap이 정사각형이 아닙니다"));
+        return false;
+    }
+    
+    // 정점 생성 (노말과 탄젠트는 높이 맵 중앙 차분으로 같은 패스에서 계산)
+    // 격자 지형은 이 노말이 이미 매끄러우므로 삼각형 기반 스무딩/탄젠트 계산은 생략
+    const int32 Step = FMath::Max(1, LODSettings.VertexReductionFactor);
+    const double VertexStartTime = FPlatformTime::Seconds();
+    CreateTerrainVertices(OutData.Vertices, OutData.Normals, OutData.UVs,
+        LODSettings.bGenerateTangents ? &OutData.Tangents : nullptr, HeightMap, ChunkSize, Step);
+    const double VertexElapsedMs = (FPlatformTime::Seconds() - VertexStartTime) * 1000.0;
+    OutData.VerticesPerMs = VertexElapsedMs > 0.0 ? (float)(OutData.Vertices.Num() / VertexElapsedMs) : 0.0f;
+    
+    // 삼각형 생성 (정점 생성 루프와 같은 행 길이)
+    int32 GridSize = (MapSize + Step - 1) / Step;
+    CreateTerrainTriangles(OutData.Triangles, GridSize, GridSize);
+    
+    // 메시 최적화 (정점 속성도 함께 재배치)
+    OutData.ACMRBefore = CalculateACMR(OutData.Triangles);
+    OptimizeMesh(OutData.Vertices, OutData.Triangles, OutData.Normals, OutData.UVs, OutData.Tangents, 0.1f);
+    OutData.ACMRAfter = CalculateACMR(OutData.Triangles);
+    
+    OutData.BuildTimeSeconds = FPlatformTime::Seconds() - StartTime;
+    return true;
 }
 
 // 평면 메시 생성 함수
@@ -263,27 +357,16 @@ FVector HSProceduralMeshGenerator::CalculateNormalFromHeightMap(
     int32 MapSize,
     float Scale)
 {
-    // 중심점 주변의 높이 값 가져오기
-    auto GetHeight = [&](int32 dx, int32 dy) -> float
-    {
-        int32 nx = FMath::Clamp(X + dx, 0, MapSize - 1);
-        int32 ny = FMath::Clamp(Y + dy, 0, MapSize - 1);
-        return HeightMap[ny * MapSize + nx];
-    };
-    
-    // Sobel 필터를 사용한 노말 계산
-    float HeightL = GetHeight(-1, 0);
-    float HeightR = GetHeight(1, 0);
-    float HeightD = GetHeight(0, -1);
-    float HeightU = GetHeight(0, 1);
+    // 중앙 차분으로 기울기 계산 (경계에서는 한쪽 차분, Scale은 격자 간격)
+    const int32 XL = FMath::Max(X - 1, 0);
+    const int32 XR = FMath::Min(X + 1, MapSize - 1);
+    const int32 YD = FMath::Max(Y - 1, 0);
+    const int32 YU = FMath::Min(Y + 1, MapSize - 1);
     
-    FVector Normal(
-        (HeightL - HeightR) * Scale,
-        (HeightD - HeightU) * Scale,
-        2.0f
-    );
+    const float SlopeX = XR > XL ? (HeightMap[Y * MapSize + XR] - HeightMap[Y * MapSize + XL]) / ((XR - XL) * Scale) : 0.0f;
+    const float SlopeY = YU > YD ? (HeightMap[YU * MapSize + X] - HeightMap[YD * MapSize + X]) / ((YU - YD) * Scale) : 0.0f;
     
-    return Normal.GetSafeNormal();
+    return FVector(-SlopeX, -SlopeY, 1.0f).GetSafeNormal();
 }
 
 // 메시 최적화 함수
@@ -297,6 +380,28 @@ void HSProceduralMeshGenerator::OptimizeMesh(
     
     // 삼각형 스트립 최적화
     OptimizeTriangleStrip(Triangles);
+    
+    // 정점 페치 순서 최적화
+    OptimizeVertexFetch(Vertices, Triangles);
+}
+
+// 메시 최적화 함수 (정점 속성 포함)
+void HSProceduralMeshGenerator::OptimizeMesh(
+    TArray<FVector>& Vertices,
+    TArray<int32>& Triangles,
+    TArray<FVector>& Normals,
+    TArray<FVector2D>& UVs,
+    TArray<FProcMeshTangent>& Tangents,
+    float WeldThreshold)
+{
+    // 정점 용접 (노말/UV가 다른 정점은 경계로 유지)
+    WeldVertices(Vertices, Triangles, WeldThreshold, &Normals, &UVs, &Tangents);
+    
+    // 삼각형 스트립 최적화
+    OptimizeTriangleStrip(Triangles);
+    
+    // 정점 페치 순서 최적화
+    OptimizeVertexFetch(Vertices, Triangles, &Normals, &UVs, &Tangents);
 }
 
 // 탄젠트 계산 함수
@@ -306,47 +411,126 @@ void HSProceduralMeshGenerator::CalculateTangents(
     const TArray<int32>& Triangles,
     TArray<FProcMeshTangent>& Tangents)
 {
-    Tangents.SetNum(Vertices.Num());
+    // 탄젠트 직교화에 필요한 노말도 같은 패스에서 계산
+    TArray<FVector> Normals;
+    CalculateNormalsAndTangents(Vertices, UVs, Triangles, Normals, &Tangents);
+}
+
+// 노말/탄젠트 계산 함수
+void HSProceduralMeshGenerator::CalculateNormalsAndTangents(
+    const TArray<FVector>& Vertices,
+    const TArray<FVector2D>& UVs,
+    const TArray<int32>& Triangles,
+    TArray<FVector>& OutNormals,
+    TArray<FProcMeshTangent>* OutTangents)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    
+    const int32 VertexCount = Vertices.Num();
+    const int32 TriangleCount = Triangles.Num() / 3;
+    const bool bComputeTangents = OutTangents && UVs.Num() == VertexCount;
+    
+    OutNormals.SetNumUninitialized(VertexCount);
+    if (OutTangents)
+    {
+        OutTangents->SetNum(VertexCount);
+    }
+    
+    // 정점별 인접 삼각형 목록 (오프셋 + 평탄 배열)
+    TArray<int32> AdjacencyOffsets;
+    AdjacencyOffsets.SetNumZeroed(VertexCount + 1);
+    for (int32 i = 0; i < TriangleCount * 3; i++)
+    {
+        AdjacencyOffsets[Triangles[i] + 1]++;
+    }
+    for (int32 v = 0; v < VertexCount; v++)
+    {
+        AdjacencyOffsets[v + 1] += AdjacencyOffsets[v];
+    }
     
-    // 병렬 처리를 통한 탄젠트 계산
-    ParallelFor(Triangles.Num() / 3, [&](int32 TriIndex)
+    TArray<int32> AdjacentTriangles;
+    AdjacentTriangles.SetNumUninitialized(TriangleCount * 3);
     {
-        int32 i0 = Triangles[TriIndex * 3 + 0];
-        int32 i1 = Triangles[TriIndex * 3 + 1];
-        int32 i2 = Triangles[TriIndex * 3 + 2];
+        TArray<int32> FillCursor(AdjacencyOffsets.GetData(), VertexCount);
+        for (int32 t = 0; t < TriangleCount; t++)
+        {
+            AdjacentTriangles[FillCursor[Triangles[t * 3]]++] = t;
+            AdjacentTriangles[FillCursor[Triangles[t * 3 + 1]]++] = t;
+            AdjacentTriangles[FillCursor[Triangles[t * 3 + 2]]++] = t;
+        }
+    }
+    
+    // 1단계: 삼각형별 면 노말(면적 가중)과 면 탄젠트 - 삼각형마다 자기 슬롯에만 기록
+    TArray<FVector> FaceNormals;
+    FaceNormals.SetNumUninitialized(TriangleCount);
+    TArray<FVector> FaceTangents;
+    if (bComputeTangents)
+    {
+        FaceTangents.SetNumUninitialized(TriangleCount);
+    }
+    
+    ParallelFor(TriangleCount, [&](int32 TriIndex)
+    {
+        const int32 i0 = Triangles[TriIndex * 3 + 0];
+        const int32 i1 = Triangles[TriIndex * 3 + 1];
+        const int32 i2 = Triangles[TriIndex * 3 + 2];
         
         const FVector& v0 = Vertices[i0];
         const FVector& v1 = Vertices[i1];
         const FVector& v2 = Vertices[i2];
         
-        const FVector2D& uv0 = UVs[i0];
-        const FVector2D& uv1 = UVs[i1];
-        const FVector2D& uv2 = UVs[i2];
-        
-        // 삼각형의 엣지 계산
-        FVector Edge1 = v1 - v0;
-        FVector Edge2 = v2 - v0;
-        
-        FVector2D DeltaUV1 = uv1 - uv0;
-        FVector2D DeltaUV2 = uv2 - uv0;
+        // 엔진 절차적 메시와 같은 감기 방향 기준
+        FaceNormals[TriIndex] = FVector::CrossProduct(v1 - v2, v0 - v2);
         
-        float f = 1.0f / (DeltaUV1.X * DeltaUV2.Y - DeltaUV2.X * DeltaUV1.Y);
+        if (bComputeTangents)
+        {
+            const FVector Edge1 = v1 - v0;
+            const FVector Edge2 = v2 - v0;
+            const FVector2D DeltaUV1 = UVs[i1] - UVs[i0];
+            const FVector2D DeltaUV2 = UVs[i2] - UVs[i0];
+            
+            const float Determinant = DeltaUV1.X * DeltaUV2.Y - DeltaUV2.X * DeltaUV1.Y;
+            FaceTangents[TriIndex] = FMath::Abs(Determinant) > SMALL_NUMBER
+                ? (Edge1 * DeltaUV2.Y - Edge2 * DeltaUV1.Y) / Determinant
+                : FVector::ZeroVector;
+        }
+    });
+    
+    // 2단계: 정점별로 인접 삼각형 값을 모아 정규화 - 공유 정점에 대한 쓰기 경합 없음
+    ParallelFor(VertexCount, [&](int32 VertexIndex)
+    {
+        FVector NormalSum = FVector::ZeroVector;
+        FVector TangentSum = FVector::ZeroVector;
         
-        FVector Tangent;
-        Tangent.X = f * (DeltaUV2.Y * Edge1.X - DeltaUV1.Y * Edge2.X);
-        Tangent.Y = f * (DeltaUV2.Y * Edge1.Y - DeltaUV1.Y * Edge2.Y);
-        Tangent.Z = f * (DeltaUV2.Y * Edge1.Z - DeltaUV1.Y * Edge2.Z);
-        Tangent.Normalize();
+        for (int32 Slot = AdjacencyOffsets[VertexIndex]; Slot < AdjacencyOffsets[VertexIndex + 1]; Slot++)
+        {
+            const int32 TriIndex = AdjacentTriangles[Slot];
+            NormalSum += FaceNormals[TriIndex];
+            if (bComputeTangents)
+            {
+                TangentSum += FaceTangents[TriIndex];
+            }
+        }
         
-        // 각 정점에 탄젠트 할당
-        Tangents[i0].TangentX = Tangent;
-        Tangents[i1].TangentX = Tangent;
-        Tangents[i2].TangentX = Tangent;
+        const FVector Normal = NormalSum.GetSafeNormal(SMALL_NUMBER, FVector::UpVector);
+        OutNormals[VertexIndex] = Normal;
         
-        Tangents[i0].bFlipTangentY = false;
-        Tangents[i1].bFlipTangentY = false;
-        Tangents[i2].bFlipTangentY = false;
+        if (OutTangents)
+        {
+            // 그람-슈미트 직교화, UV가 퇴화한 경우 노말에 수직인 임의 축 사용
+            FVector Tangent = (TangentSum - Normal * FVector::DotProduct(Normal, TangentSum)).GetSafeNormal();
+            if (Tangent.IsZero())
+            {
+                FVector AxisY;
+                Normal.FindBestAxisVectors(Tangent, AxisY);
+            }
+            (*OutTangents)[VertexIndex] = FProcMeshTangent(Tangent, false);
+        }
     });
+    
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    UE_LOG(LogTemp, Verbose, TEXT("노말/탄젠트 계산: 정점 %d, %.2fms (%.1f 정점/ms)"),
+        VertexCount, ElapsedMs, ElapsedMs > 0.0 ? VertexCount / ElapsedMs : 0.0);
 }
 
 // 지형 정점 생성 헬퍼 함수
@@ -354,50 +538,63 @@ void HSProceduralMeshGenerator::CreateTerrainVertices(
     TArray<FVector>& OutVertices,
     TArray<FVector>& OutNormals,
     TArray<FVector2D>& OutUVs,
+    TArray<FProcMeshTangent>* OutTangents,
     const TArray<float>& HeightMap,
     float ChunkSize,
-    int32 LODLevel)
+    int32 Step)
 {
-    FMeshLODSettings LODSettings = GetLODSettings(LODLevel);
     int32 MapSize = FMath::Sqrt((float)HeightMap.Num());
-    int32 Step = LODSettings.VertexReductionFactor;
     
     float CellSize = ChunkSize / (MapSize - 1);
     
-    // 정점 생성
-    for (int32 y = 0; y < MapSize; y += Step)
+    // 정점 생성 (행 단위 병렬 - 각 정점은 자기 슬롯에만 기록)
+    const int32 RowLength = (MapSize + Step - 1) / Step;
+    const int32 VertexCount = RowLength * RowLength;
+    OutVertices.SetNumUninitialized(VertexCount);
+    OutNormals.SetNumUninitialized(VertexCount);
+    OutUVs.SetNumUninitialized(VertexCount);
+    if (OutTangents)
+    {
+        OutTangents->SetNumUninitialized(VertexCount);
+    }
+    
+    ParallelFor(RowLength, [&](int32 Row)
     {
-        for (int32 x = 0; x < MapSize; x += Step)
+        const int32 y = Row * Step;
+        for (int32 Column = 0; Column < RowLength; Column++)
         {
-            int32 Index = y * MapSize + x;
-            float Height = HeightMap[Index];
+            const int32 x = Column * Step;
+            const int32 VertexIndex = Row * RowLength + Column;
+            float Height = HeightMap[y * MapSize + x];
             
             // 위치 계산
-            FVector Position(
+            OutVertices[VertexIndex] = FVector(
                 x * CellSize - ChunkSize * 0.5f,
                 y * CellSize - ChunkSize * 0.5f,
                 Height
             );
             
-            // 노말 계산
-            FVector Normal = CalculateNormalFromHeightMap(HeightMap, x, y, MapSize, CellSize);
+            // 노말 계산 (높이 맵 중앙 차분)
+            const FVector Normal = CalculateNormalFromHeightMap(HeightMap, x, y, MapSize, CellSize);
+            OutNormals[VertexIndex] = Normal;
             
-            // UV 계산
-            FVector2D UV((float)x / (MapSize - 1), (float)y / (MapSize - 1));
+            // 탄젠트 계산 (U 방향 = +X, 노말과 같은 기울기에서 바로 구함)
+            if (OutTangents)
+            {
+                (*OutTangents)[VertexIndex] = FProcMeshTangent(FVector(Normal.Z, 0.0f, -Normal.X).GetSafeNormal(), false);
+            }
             
-            OutVertices.Add(Position);
-            OutNormals.Add(Normal);
-            OutUVs.Add(UV);
+            // UV 계산
+            OutUVs[VertexIndex] = FVector2D((float)x / (MapSize - 1), (float)y / (MapSize - 1));
         }
-    }
+    });
 }
 
 // 지형 삼각형 생성 헬퍼 함수
 void HSProceduralMeshGenerator::CreateTerrainTriangles(
     TArray<int32>& OutTriangles,
     int32 GridSizeX,
-    int32 GridSizeY,
-    int32 LODLevel)
+    int32 GridSizeY)
 {
     // 삼각형 인덱스 생성
     for (int32 y = 0; y < GridSizeY - 1; y++)
@@ -423,50 +620,420 @@ void HSProceduralMeshGenerator::CreateTerrainTriangles(
 }
 
 // 정점 용접 함수
-void HSProceduralMeshGenerator::WeldVertices(
+int32 HSProceduralMeshGenerator::WeldVertices(
     TArray<FVector>& Vertices,
     TArray<int32>& Triangles,
-    float Threshold)
+    float Threshold,
+    TArray<FVector>* Normals,
+    TArray<FVector2D>* UVs,
+    TArray<FProcMeshTangent>* Tangents)
 {
-    TMap<int32, int32> VertexRemap;
-    TArray<FVector> WeldedVertices;
+    SCOPE_CYCLE_COUNTER(STAT_HSWeldVertices);
     
-    // 중복 정점 찾기 및 제거
-    for (int32 i = 0; i < Vertices.Num(); i++)
+    const int32 VertexCount = Vertices.Num();
+    if (VertexCount == 0)
+    {
+        return 0;
+    }
+    
+    const bool bHasNormals = Normals && Normals->Num() == VertexCount;
+    const bool bHasUVs = UVs && UVs->Num() == VertexCount;
+    const bool bHasTangents = Tangents && Tangents->Num() == VertexCount;
+    
+    // 허용 오차 크기의 셀로 위치를 양자화 - 오차 이내의 정점은 같은 셀이나 인접 셀에만 존재
+    const float ThresholdSq = FMath::Square(Threshold);
+    const float InvCellSize = 1.0f / FMath::Max(Threshold, KINDA_SMALL_NUMBER);
+    
+    auto GetCell = [InvCellSize](const FVector& Position) -> FIntVector
     {
-        bool bFound = false;
+        return FIntVector(
+            FMath::FloorToInt(Position.X * InvCellSize),
+            FMath::FloorToInt(Position.Y * InvCellSize),
+            FMath::FloorToInt(Position.Z * InvCellSize)
+        );
+    };
+    
+    // 셀별 용접 정점 연결 리스트 (셀 -> 첫 정점, 정점 -> 같은 셀의 다음 정점)
+    TMap<FIntVector, int32> CellHeads;
+    CellHeads.Reserve(VertexCount);
+    TArray<int32> NextInCell;
+    NextInCell.Reserve(VertexCount);
+    
+    TArray<int32> VertexRemap;
+    VertexRemap.SetNumUninitialized(VertexCount);
+    int32 WeldedCount = 0;
+    
+    for (int32 i = 0; i < VertexCount; i++)
+    {
+        const FVector Position = Vertices[i];
+        const FIntVector Cell = GetCell(Position);
+        int32 MatchIndex = INDEX_NONE;
         
-        for (int32 j = 0; j < WeldedVertices.Num(); j++)
+        // 인접 27개 셀에서 조건을 만족하는 가장 먼저 만든 정점 선택
+        for (int32 dz = -1; dz <= 1; dz++)
         {
-            if (FVector::Dist(Vertices[i], WeldedVertices[j]) < Threshold)
+            for (int32 dy = -1; dy <= 1; dy++)
             {
-                VertexRemap.Add(i, j);
-                bFound = true;
-                break;
+                for (int32 dx = -1; dx <= 1; dx++)
+                {
+                    const int32* Head = CellHeads.Find(Cell + FIntVector(dx, dy, dz));
+                    for (int32 j = Head ? *Head : INDEX_NONE; j != INDEX_NONE; j = NextInCell[j])
+                    {
+                        if (MatchIndex != INDEX_NONE && j >= MatchIndex)
+                        {
+                            continue;
+                        }
+                        if (FVector::DistSquared(Vertices[j], Position) >= ThresholdSq)
+                        {
+                            continue;
+                        }
+                        if (bHasNormals && FVector::DotProduct((*Normals)[j], (*Normals)[i]) < HSProceduralMeshConstants::NormalWeldDotThreshold)
+                        {
+                            continue;
+                        }
+                        if (bHasUVs && !(*UVs)[j].Equals((*UVs)[i], HSProceduralMeshConstants::UVWeldTolerance))
+                        {
+                            continue;
+                        }
+                        MatchIndex = j;
+                    }
+                }
             }
         }
         
-        if (!bFound)
+        if (MatchIndex != INDEX_NONE)
+        {
+            VertexRemap[i] = MatchIndex;
+            continue;
+        }
+        
+        // 새 용접 정점 - 항상 앞쪽(WeldedCount <= i)으로 옮기므로 제자리 압축 가능
+        VertexRemap[i] = WeldedCount;
+        Vertices[WeldedCount] = Position;
+        if (bHasNormals)
+        {
+            (*Normals)[WeldedCount] = (*Normals)[i];
+        }
+        if (bHasUVs)
         {
-            VertexRemap.Add(i, WeldedVertices.Num());
-            WeldedVertices.Add(Vertices[i]);
+            (*UVs)[WeldedCount] = (*UVs)[i];
         }
+        if (bHasTangents)
+        {
+            (*Tangents)[WeldedCount] = (*Tangents)[i];
+        }
+        
+        int32& CellHead = CellHeads.FindOrAdd(Cell, INDEX_NONE);
+        NextInCell.Add(CellHead);
+        CellHead = WeldedCount;
+        WeldedCount++;
     }
     
-    // 삼각형 인덱스 업데이트
+    // 삼각형 인덱스 업데이트 (한 번에 재매핑)
     for (int32& Index : Triangles)
     {
         Index = VertexRemap[Index];
     }
     
     // 정점 배열 업데이트
-    Vertices = WeldedVertices;
+    Vertices.SetNum(WeldedCount, false);
+    if (bHasNormals)
+    {
+        Normals->SetNum(WeldedCount, false);
+    }
+    if (bHasUVs)
+    {
+        UVs->SetNum(WeldedCount, false);
+    }
+    if (bHasTangents)
+    {
+        Tangents->SetNum(WeldedCount, false);
+    }
+    
+    return VertexCount - WeldedCount;
 }
 
 // 삼각형 스트립 최적화
 void HSProceduralMeshGenerator::OptimizeTriangleStrip(TArray<int32>& Triangles)
 {
-    // 캐시 최적화
+    SCOPE_CYCLE_COUNTER(STAT_HSOptimizeVertexCache);
+    using namespace HSProceduralMeshConstants;
+    
+    const int32 TriangleCount = Triangles.Num() / 3;
+    if (TriangleCount < 2)
+    {
+        return;
+    }
+    
+    int32 VertexCount = 0;
+    for (int32 Index : Triangles)
+    {
+        VertexCount = FMath::Max(VertexCount, Index + 1);
+    }
+    
+    // 정점별 인접 삼각형 목록 (오프셋 + 평탄 배열, 앞쪽 RemainingValence개가 아직 출력되지 않은 삼각형)
+    TArray<int32> AdjacencyOffsets;
+    AdjacencyOffsets.SetNumZeroed(VertexCount + 1);
+    for (int32 i = 0; i < TriangleCount * 3; i++)
+    {
+        AdjacencyOffsets[Triangles[i] + 1]++;
+    }
+    for (int32 v = 0; v < VertexCount; v++)
+    {
+        AdjacencyOffsets[v + 1] += AdjacencyOffsets[v];
+    }
+    
+    TArray<int32> AdjacentTriangles;
+    AdjacentTriangles.SetNumUninitialized(TriangleCount * 3);
+    TArray<int32> RemainingValence;
+    RemainingValence.SetNumZeroed(VertexCount);
+    for (int32 t = 0; t < TriangleCount; t++)
+    {
+        for (int32 k = 0; k < 3; k++)
+        {
+            const int32 v = Triangles[t * 3 + k];
+            AdjacentTriangles[AdjacencyOffsets[v] + RemainingValence[v]++] = t;
+        }
+    }
+    
+    // 점수 테이블 - 캐시 위치 점수(최근 삼각형 정점은 고정값, 이후 감쇠)와 남은 삼각형 수 보너스
+    float CachePositionScores[VertexCacheSize];
+    for (int32 Position = 0; Position < VertexCacheSize; Position++)
+    {
+        CachePositionScores[Position] = Position < 3
+            ? ForsythLastTriangleScore
+            : FMath::Pow(1.0f - (float)(Position - 3) / (VertexCacheSize - 3), ForsythCacheDecayPower);
+    }
+    
+    TArray<int32> CachePosition;
+    CachePosition.Init(INDEX_NONE, VertexCount);
+    TArray<float> VertexScores;
+    VertexScores.SetNumUninitialized(VertexCount);
+    
+    auto ComputeVertexScore = [&](int32 v) -> float
+    {
+        if (RemainingValence[v] == 0)
+        {
+            return -1.0f;
+        }
+        const float CacheScore = CachePosition[v] >= 0 ? CachePositionScores[CachePosition[v]] : 0.0f;
+        return CacheScore + ForsythValenceBoostScale * FMath::InvSqrt((float)RemainingValence[v]);
+    };
+    
+    auto ComputeTriangleScore = [&](int32 t) -> float
+    {
+        return VertexScores[Triangles[t * 3]] + VertexScores[Triangles[t * 3 + 1]] + VertexScores[Triangles[t * 3 + 2]];
+    };
+    
+    for (int32 v = 0; v < VertexCount; v++)
+    {
+        VertexScores[v] = ComputeVertexScore(v);
+    }
+    
+    // 시작 삼각형은 전체에서 점수가 가장 높은 것
+    int32 BestTriangle = 0;
+    float BestScore = -1.0f;
+    for (int32 t = 0; t < TriangleCount; t++)
+    {
+        const float Score = ComputeTriangleScore(t);
+        if (Score > BestScore)
+        {
+            BestScore = Score;
+            BestTriangle = t;
+        }
+    }
+    
+    TArray<bool> TriangleEmitted;
+    TriangleEmitted.Init(false, TriangleCount);
+    TArray<int32> OrderedTriangles;
+    OrderedTriangles.Reserve(TriangleCount * 3);
+    
+    int32 Cache[VertexCacheSize + 3];
+    int32 NewCache[VertexCacheSize + 3];
+    int32 CacheCount = 0;
+    int32 ScanCursor = 0;
+    
+    for (int32 Emitted = 0; Emitted < TriangleCount; Emitted++)
+    {
+        // 캐시 주변에 남은 삼각형이 없으면 아직 출력되지 않은 다음 삼각형에서 재시작
+        if (BestTriangle == INDEX_NONE)
+        {
+            while (TriangleEmitted[ScanCursor])
+            {
+                ScanCursor++;
+            }
+            BestTriangle = ScanCursor;
+        }
+        
+        const int32 Triangle = BestTriangle;
+        TriangleEmitted[Triangle] = true;
+        
+        int32 NewCacheCount = 0;
+        for (int32 k = 0; k < 3; k++)
+        {
+            const int32 v = Triangles[Triangle * 3 + k];
+            OrderedTriangles.Add(v);
+            
+            // 정점의 남은 삼각형 목록에서 제거
+            const int32 Begin = AdjacencyOffsets[v];
+            const int32 End = Begin + RemainingValence[v];
+            for (int32 Slot = Begin; Slot < End; Slot++)
+            {
+                if (AdjacentTriangles[Slot] == Triangle)
+                {
+                    AdjacentTriangles[Slot] = AdjacentTriangles[End - 1];
+                    RemainingValence[v]--;
+                    break;
+                }
+            }
+            
+            // 방금 쓴 정점을 캐시 맨 앞으로
+            bool bAlreadyInNewCache = false;
+            for (int32 i = 0; i < NewCacheCount; i++)
+            {
+                bAlreadyInNewCache |= NewCache[i] == v;
+            }
+            if (!bAlreadyInNewCache)
+            {
+                NewCache[NewCacheCount++] = v;
+            }
+        }
+        
+        // 기존 캐시 정점을 뒤로 밀고, 캐시 크기를 넘어간 정점은 캐시에서 제외
+        const int32 TriangleVertexCount = NewCacheCount;
+        for (int32 i = 0; i < CacheCount; i++)
+        {
+            const int32 v = Cache[i];
+            bool bInTriangle = false;
+            for (int32 j = 0; j < TriangleVertexCount; j++)
+            {
+                bInTriangle |= NewCache[j] == v;
+            }
+            if (!bInTriangle)
+            {
+                NewCache[NewCacheCount++] = v;
+            }
+        }
+        for (int32 i = VertexCacheSize; i < NewCacheCount; i++)
+        {
+            CachePosition[NewCache[i]] = INDEX_NONE;
+            VertexScores[NewCache[i]] = ComputeVertexScore(NewCache[i]);
+        }
+        
+        CacheCount = FMath::Min(NewCacheCount, VertexCacheSize);
+        for (int32 i = 0; i < CacheCount; i++)
+        {
+            Cache[i] = NewCache[i];
+            CachePosition[Cache[i]] = i;
+            VertexScores[Cache[i]] = ComputeVertexScore(Cache[i]);
+        }
+        
+        // 캐시 정점에 붙은 남은 삼각형 중 점수가 가장 높은 삼각형을 다음으로 선택
+        BestTriangle = INDEX_NONE;
+        BestScore = -1.0f;
+        for (int32 i = 0; i < CacheCount; i++)
+        {
+            const int32 v = Cache[i];
+            const int32 Begin = AdjacencyOffsets[v];
+            for (int32 Slot = Begin; Slot < Begin + RemainingValence[v]; Slot++)
+            {
+                const int32 Candidate = AdjacentTriangles[Slot];
+                const float Score = ComputeTriangleScore(Candidate);
+                if (Score > BestScore)
+                {
+                    BestScore = Score;
+                    BestTriangle = Candidate;
+                }
+            }
+        }
+    }
+    
+    Triangles = MoveTemp(OrderedTriangles);
+}
+
+// 정점 페치 순서 최적화
+void HSProceduralMeshGenerator::OptimizeVertexFetch(
+    TArray<FVector>& Vertices,
+    TArray<int32>& Triangles,
+    TArray<FVector>* Normals,
+    TArray<FVector2D>* UVs,
+    TArray<FProcMeshTangent>* Tangents)
+{
+    const int32 VertexCount = Vertices.Num();
+    if (VertexCount == 0)
+    {
+        return;
+    }
+    
+    // 인덱스 버퍼에서 처음 참조되는 순서로 새 번호 부여
+    TArray<int32> NewIndexOf;
+    NewIndexOf.Init(INDEX_NONE, VertexCount);
+    int32 NextIndex = 0;
+    for (int32& Index : Triangles)
+    {
+        if (NewIndexOf[Index] == INDEX_NONE)
+        {
+            NewIndexOf[Index] = NextIndex++;
+        }
+        Index = NewIndexOf[Index];
+    }
+    
+    // 참조되지 않는 정점은 원래 순서대로 뒤에 둠
+    for (int32 OldIndex = 0; OldIndex < VertexCount; OldIndex++)
+    {
+        if (NewIndexOf[OldIndex] == INDEX_NONE)
+        {
+            NewIndexOf[OldIndex] = NextIndex++;
+        }
+    }
+    
+    HSProceduralMeshConstants::PermuteVertexAttribute(Vertices, NewIndexOf);
+    if (Normals && Normals->Num() == VertexCount)
+    {
+        HSProceduralMeshConstants::PermuteVertexAttribute(*Normals, NewIndexOf);
+    }
+    if (UVs && UVs->Num() == VertexCount)
+    {
+        HSProceduralMeshConstants::PermuteVertexAttribute(*UVs, NewIndexOf);
+    }
+    if (Tangents && Tangents->Num() == VertexCount)
+    {
+        HSProceduralMeshConstants::PermuteVertexAttribute(*Tangents, NewIndexOf);
+    }
+}
+
+// 정점 캐시 효율 측정 함수
+float HSProceduralMeshGenerator::CalculateACMR(
+    const TArray<int32>& Triangles,
+    int32 CacheSize)
+{
+    const int32 TriangleCount = Triangles.Num() / 3;
+    if (TriangleCount == 0 || CacheSize <= 0)
+    {
+        return 0.0f;
+    }
+    
+    int32 VertexCount = 0;
+    for (int32 Index : Triangles)
+    {
+        VertexCount = FMath::Max(VertexCount, Index + 1);
+    }
+    
+    // FIFO 캐시 - 정점이 들어간 시점의 미스 번호로 아직 캐시에 남아 있는지 판단
+    TArray<int32> InsertedAtMiss;
+    InsertedAtMiss.SetNumZeroed(VertexCount);
+    int32 MissCount = 0;
+    
+    for (int32 Index : Triangles)
+    {
+        if (InsertedAtMiss[Index] == 0 || MissCount - InsertedAtMiss[Index] >= CacheSize)
+        {
+            MissCount++;
+            InsertedAtMiss[Index] = MissCount;
+        }
+    }
+    
+    return (float)MissCount / TriangleCount;
 }
 
 // 노말 스무딩 함수
@@ -476,43 +1043,25 @@ void HSProceduralMeshGenerator::SmoothNormals(
     const TArray<int32>& Triangles,
     float SmoothingAngle)
 {
-    TArray<FVector> SmoothNormals;
-    SmoothNormals.SetNum(Vertices.Num());
+    // 각 정점에 대한 노말 평균 계산 (인접 삼각형 수집 방식 병렬 계산)
+    TArray<FVector> AveragedNormals;
+    CalculateNormalsAndTangents(Vertices, TArray<FVector2D>(), Triangles, AveragedNormals, nullptr);
     
-    // 각 정점에 대한 노말 평균 계산
-    for (int32 i = 0; i < Triangles.Num(); i += 3)
+    if (Normals.Num() != Vertices.Num())
     {
-        int32 i0 = Triangles[i];
-        int32 i1 = Triangles[i + 1];
-        int32 i2 = Triangles[i + 2];
-        
-        // 삼각형 노말 계산
-        FVector v0 = Vertices[i0];
-        FVector v1 = Vertices[i1];
-        FVector v2 = Vertices[i2];
-        
-        FVector TriNormal = FVector::CrossProduct(v1 - v0, v2 - v0).GetSafeNormal();
-        
-        // 각 정점에 노말 누적
-        SmoothNormals[i0] += TriNormal;
-        SmoothNormals[i1] += TriNormal;
-        SmoothNormals[i2] += TriNormal;
+        Normals = MoveTemp(AveragedNormals);
+        return;
     }
     
-    // 노말 정규화
-    for (int32 i = 0; i < SmoothNormals.Num(); i++)
+    // 스무딩 각도에 따른 블렌딩
+    const float CosSmoothingAngle = FMath::Cos(FMath::DegreesToRadians(SmoothingAngle));
+    ParallelFor(Normals.Num(), [&](int32 i)
     {
-        SmoothNormals[i].Normalize();
-        
-        // 스무딩 각도에 따른 블렌딩
-        float Dot = FVector::DotProduct(Normals[i], SmoothNormals[i]);
-        float Angle = FMath::Acos(Dot) * (180.0f / PI);
-        
-        if (Angle < SmoothingAngle)
+        if (FVector::DotProduct(Normals[i], AveragedNormals[i]) > CosSmoothingAngle)
         {
-            Normals[i] = SmoothNormals[i];
+            Normals[i] = AveragedNormals[i];
         }
-    }
+    });
 }
 
 // LOD 설정 함수
@@ -535,21 +1084,21 @@ FMeshLODSettings HSProceduralMeshGenerator::GetLODSettings(int32 LODLevel) const
 // 메모리 풀 초기화
 void HSProceduralMeshGenerator::InitializeMemoryPools()
 {
-    VertexPool.Reserve(MaxPoolSize);
-    NormalPool.Reserve(MaxPoolSize);
-    UVPool.Reserve(MaxPoolSize);
-    TrianglePool.Reserve(MaxPoolSize * 3);
-    TangentPool.Reserve(MaxPoolSize);
+    MeshDataPool.Vertices.Reserve(MaxPoolSize);
+    MeshDataPool.Normals.Reserve(MaxPoolSize);
+    MeshDataPool.UVs.Reserve(MaxPoolSize);
+    MeshDataPool.Triangles.Reserve(MaxPoolSize * 3);
+    MeshDataPool.Tangents.Reserve(MaxPoolSize);
 }
 
 // 메모리 풀 정리
 void HSProceduralMeshGenerator::CleanupMemoryPools()
 {
-    VertexPool.Empty();
-    NormalPool.Empty();
-    UVPool.Empty();
-    TrianglePool.Empty();
-    TangentPool.Empty();
+    MeshDataPool.Vertices.Empty();
+    MeshDataPool.Normals.Empty();
+    MeshDataPool.UVs.Empty();
+    MeshDataPool.Triangles.Empty();
+    MeshDataPool.Tangents.Empty();
 }
 
 // 메시 통계 정보 가져오기
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "ProceduralMeshComponent.h"
+#include "HAL/ThreadSafeCounter.h"
 
 /**
  * 절차적 메시 정점 데이터
@@ -40,12 +41,49 @@ struct FMeshLODSettings
     }
 };
 
+/**
+ * 절차적 메시 빌드 결과 (워커 스레드에서 채운 뒤 게임 스레드에서 섹션 생성)
+ */
+struct FProceduralMeshBuildData
+{
+    TArray<FVector> Vertices;
+    TArray<int32> Triangles;
+    TArray<FVector> Normals;
+    TArray<FVector2D> UVs;
+    TArray<FProcMeshTangent> Tangents;
+    double BuildTimeSeconds = 0.0;
+
+    // 인덱스 재정렬 전후의 삼각형당 평균 캐시 미스 (ACMR)
+    float ACMRBefore = 0.0f;
+    float ACMRAfter = 0.0f;
+
+    // 정점/노말/탄젠트 생성 처리량
+    float VerticesPerMs = 0.0f;
+
+    void Reset()
+    {
+        Vertices.Reset();
+        Triangles.Reset();
+        Normals.Reset();
+        UVs.Reset();
+        Tangents.Reset();
+        BuildTimeSeconds = 0.0;
+        ACMRBefore = 0.0f;
+        ACMRAfter = 0.0f;
+        VerticesPerMs = 0.0f;
+    }
+};
+
 /**
  * 절차적 메시 생성기 클래스
  * 다양한 종류의 절차적 메시를 생성하는 유틸리티 클래스
  */
 class HUNTINGSPIRIT_API HSProceduralMeshGenerator
 {
+#if WITH_DEV_AUTOMATION_TESTS
+    friend class FHSProceduralMeshWeldTest;
+#endif
+
 public:
     // 생성자 & 소멸자
     HSProceduralMeshGenerator();
@@ -59,6 +97,25 @@ public:
         int32 LODLevel = 0
     );
     
+    // 지형 메시 비동기 생성 함수 (메시 데이터는 워커 스레드에서 만들고 섹션 생성만 게임 스레드에서 수행)
+    void GenerateTerrainMeshAsync(
+        UProceduralMeshComponent* MeshComponent,
+        float ChunkSize,
+        const TArray<float>& HeightMap,
+        int32 LODLevel = 0
+    );
+    
+    // 진행 중인 비동기 빌드 결과를 버림 (완료되어도 메시에 적용하지 않음)
+    void CancelPendingAsyncBuilds() { AsyncBuildSerial->Increment(); }
+    
+    // 지형 메시 데이터 빌드 함수 (게임 스레드 의존성이 없어 워커 스레드에서 호출 가능)
+    static bool BuildTerrainMeshData(
+        const TArray<float>& HeightMap,
+        float ChunkSize,
+        const FMeshLODSettings& LODSettings,
+        FProceduralMeshBuildData& OutData
+    );
+    
     // 평면 메시 생성 함수
     void GeneratePlaneMesh(
         UProceduralMeshComponent* MeshComponent,
@@ -99,8 +156,8 @@ public:
         FIntPoint Direction
     );
     
-    // 높이 맵에서 노말 계산 함수
-    FVector CalculateNormalFromHeightMap(
+    // 높이 맵에서 노말 계산 함수 (중앙 차분, Scale은 격자 간격)
+    static FVector CalculateNormalFromHeightMap(
         const TArray<float>& HeightMap,
         int32 X,
         int32 Y,
@@ -113,12 +170,28 @@ public:
     FMeshLODSettings GetLODSettings(int32 LODLevel) const;
     
     // 메시 최적화 함수
-    void OptimizeMesh(
+    static void OptimizeMesh(
         TArray<FVector>& Vertices,
         TArray<int32>& Triangles,
         float WeldThreshold = 0.1f
     );
     
+    // 메시 최적화 함수 (정점 속성 포함 - 속성이 다른 정점은 용접하지 않아 UV/노말 경계 유지)
+    static void OptimizeMesh(
+        TArray<FVector>& Vertices,
+        TArray<int32>& Triangles,
+        TArray<FVector>& Normals,
+        TArray<FVector2D>& UVs,
+        TArray<FProcMeshTangent>& Tangents,
+        float WeldThreshold = 0.1f
+    );
+    
+    // 정점 캐시 효율 측정 함수 (FIFO 캐시 시뮬레이션, 삼각형당 평균 캐시 미스 반환)
+    static float CalculateACMR(
+        const TArray<int32>& Triangles,
+        int32 CacheSize = 32
+    );
+    
     // UV 매핑 함수
     void GenerateUVMapping(
         TArray<FVector2D>& UVs,
@@ -127,13 +200,23 @@ public:
     );
     
     // 탄젠트 계산 함수
-    void CalculateTangents(
+    static void CalculateTangents(
         const TArray<FVector>& Vertices,
         const TArray<FVector2D>& UVs,
         const TArray<int32>& Triangles,
         TArray<FProcMeshTangent>& Tangents
     );
     
+    // 노말/탄젠트 계산 함수 (삼각형별 값을 먼저 구한 뒤 정점별로 인접 삼각형을 모아 병렬 계산)
+    // UV가 정점 수와 다르면 탄젠트는 노말에 수직인 임의 축으로 채움
+    static void CalculateNormalsAndTangents(
+        const TArray<FVector>& Vertices,
+        const TArray<FVector2D>& UVs,
+        const TArray<int32>& Triangles,
+        TArray<FVector>& OutNormals,
+        TArray<FProcMeshTangent>* OutTangents
+    );
+    
     // 메시 통계 정보 가져오기
     void GetMeshStatistics(
         const TArray<FVector>& Vertices,
@@ -148,34 +231,48 @@ private:
     TMap<int32, FMeshLODSettings> LODSettingsMap;
     
     // 메시 생성 헬퍼 함수들
-    void CreateTerrainVertices(
+    static void CreateTerrainVertices(
         TArray<FVector>& OutVertices,
         TArray<FVector>& OutNormals,
         TArray<FVector2D>& OutUVs,
+        TArray<FProcMeshTangent>* OutTangents,
         const TArray<float>& HeightMap,
         float ChunkSize,
-        int32 LODLevel
+        int32 Step
     );
     
-    void CreateTerrainTriangles(
+    static void CreateTerrainTriangles(
         TArray<int32>& OutTriangles,
         int32 GridSizeX,
-        int32 GridSizeY,
-        int32 LODLevel
+        int32 GridSizeY
     );
     
-    // 정점 용접 함수 (중복 정점 제거)
-    void WeldVertices(
+    // 정점 용접 함수 (중복 정점 제거, 양자화 위치 해시 사용)
+    // 속성 배열이 주어지면 함께 압축하며, 노말/UV가 다른 정점은 용접하지 않음
+    // @return 제거된 정점 수
+    static int32 WeldVertices(
         TArray<FVector>& Vertices,
         TArray<int32>& Triangles,
-        float Threshold
+        float Threshold,
+        TArray<FVector>* Normals = nullptr,
+        TArray<FVector2D>* UVs = nullptr,
+        TArray<FProcMeshTangent>* Tangents = nullptr
     );
     
-    // 삼각형 스트립 최적화
-    void OptimizeTriangleStrip(TArray<int32>& Triangles);
+    // 삼각형 스트립 최적화 (Forsyth 방식 정점 캐시 순서 재배치)
+    static void OptimizeTriangleStrip(TArray<int32>& Triangles);
+    
+    // 정점 페치 순서 최적화 (인덱스 버퍼에서 처음 참조되는 순서로 정점 재배치)
+    static void OptimizeVertexFetch(
+        TArray<FVector>& Vertices,
+        TArray<int32>& Triangles,
+        TArray<FVector>* Normals = nullptr,
+        TArray<FVector2D>* UVs = nullptr,
+        TArray<FProcMeshTangent>* Tangents = nullptr
+    );
     
     // 노말 스무딩 함수
-    void SmoothNormals(
+    static void SmoothNormals(
         TArray<FVector>& Normals,
         const TArray<FVector>& Vertices,
         const TArray<int32>& Triangles,
@@ -224,12 +321,11 @@ private:
         }
     } PerfStats;
     
-    // 메모리 풀 (재사용을 위한 버퍼)
-    TArray<FVector> VertexPool;
-    TArray<FVector> NormalPool;
-    TArray<FVector2D> UVPool;
-    TArray<int32> TrianglePool;
-    TArray<FProcMeshTangent> TangentPool;
+    // 메모리 풀 (동기 생성 시 재사용하는 버퍼)
+    FProceduralMeshBuildData MeshDataPool;
+    
+    // 비동기 빌드 요청 순번 (늦게 끝난 이전 요청이 최신 메시를 덮어쓰지 않도록 함)
+    TSharedRef<FThreadSafeCounter, ESPMode::ThreadSafe> AsyncBuildSerial = MakeShared<FThreadSafeCounter, ESPMode::ThreadSafe>();
     
     // 최대 풀 크기
     static constexpr int32 MaxPoolSize = 65536; // 64K 정점
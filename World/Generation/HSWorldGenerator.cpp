@@ -12,6 +12,11 @@
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "Engine/AssetManager.h"
+#include "HuntingSpirit/Optimization/HSAssetPreloadManager.h"
+#include "Stats/Stats.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Chunk Object Placement"), STAT_HSChunkObjectPlacement, STATGROUP_Game);
 
 AHSWorldGenerator::AHSWorldGenerator()
 {
@@ -65,16 +70,24 @@ void AHSWorldGenerator::Tick(float DeltaTime)
         TotalGenerationTime += DeltaTime;
         ChunksGeneratedThisFrame = 0;
         
+        // 모든 플레이어 위치 갱신 (생성 우선순위와 언로드 판정에 사용)
+        GatherStreamingViewers();
+
+        // 플레이어 이동을 반영해 대기 청크 우선순위를 주기적으로 다시 계산
+        PendingPriorityRefreshTimer += DeltaTime;
+        if (PendingPriorityRefreshTimer >= PendingPriorityRefreshInterval)
+        {
+            PendingPriorityRefreshTimer = 0.0f;
+            RefreshPendingChunkPriorities();
+        }
+
         // 프레임당 청크 생성 처리
         ProcessChunkGeneration();
         
-        // 플레이어 주변 청크 업데이트
-        if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
+        // 모든 플레이어 주변 청크 업데이트 (로드 영역의 합집합, 중복 요청은 큐에서 걸러짐)
+        for (const FStreamingViewer& Viewer : StreamingViewers)
         {
-            if (APawn* PlayerPawn = PC->GetPawn())
-            {
-                UpdateChunksAroundPlayer(PlayerPawn->GetActorLocation());
-            }
+            UpdateChunksAroundPlayer(Viewer.Location);
         }
         
         // 먼 청크 정리 (메모리 최적화)
@@ -85,6 +98,7 @@ void AHSWorldGenerator::Tick(float DeltaTime)
 void AHSWorldGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     StopWorldGeneration();
+    ReleaseAssetPreloads();
 
     // 모든 생성된 청크 정리
     TArray<FIntPoint> ChunkKeys;
@@ -104,6 +118,8 @@ void AHSWorldGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
         }
     }
     InstancedMeshComponents.Empty();
+    InstanceHandleTables.Empty();
+    PendingInstanceTreeRebuilds.Empty();
     
     Super::EndPlay(EndPlayReason);
 }
@@ -130,7 +146,7 @@ void AHSWorldGenerator::StartWorldGeneration()
         for (int32 Y = -InitialRadius; Y <= InitialRadius; Y++)
         {
             FIntPoint ChunkCoord(CenterChunk.X + X, CenterChunk.Y + Y);
-            ChunkGenerationQueue.Enqueue(ChunkCoord);
+            EnqueueChunk(ChunkCoord);
         }
     }
     
@@ -140,12 +156,28 @@ void AHSWorldGenerator::StartWorldGeneration()
         RandomStream.RandRange(-BossDistance, BossDistance),
         RandomStream.RandRange(-BossDistance, BossDistance)
     );
+
+    // 보스를 미리 선택해 스폰 시점 전에 클래스를 비동기 로드
+    if (GenerationSettings.PossibleBosses.Num() > 0)
+    {
+        int32 BossIndex = RandomStream.RandRange(0, GenerationSettings.PossibleBosses.Num() - 1);
+        SelectedBossClass = GenerationSettings.PossibleBosses[BossIndex];
+
+        if (UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get())
+        {
+            BossPreloadGroup = FName(*FString::Printf(TEXT("%s.Boss"), *GetName()));
+            PreloadManager->RequestPreload(BossPreloadGroup, { SelectedBossClass.ToSoftObjectPath() });
+        }
+    }
 }
 
 void AHSWorldGenerator::StopWorldGeneration()
 {
     bIsGenerating = false;
-    ChunkGenerationQueue.Empty();
+    PendingChunkHeap.Empty();
+    ClearDeferredChunks();
+    PendingChunkSet.Empty();
+    DuplicateCountedChunks.Empty();
 }
 
 void AHSWorldGenerator::GenerateChunk(const FIntPoint& ChunkCoordinate)
@@ -170,10 +202,11 @@ void AHSWorldGenerator::GenerateChunk(const FIntPoint& ChunkCoordinate)
     }
     
     // 지형 메시 생성
-    if (UProceduralMeshComponent* TerrainMesh = GenerateTerrainMesh(ChunkCoordinate, NewChunk.BiomeData))
+    TArray<float> Heightmap;
+    if (UProceduralMeshComponent* TerrainMesh = GenerateTerrainMesh(ChunkCoordinate, NewChunk.BiomeData, Heightmap))
     {
-        // 청크에 오브젝트 스폰
-        SpawnObjectsInChunk(NewChunk);
+        // 청크에 오브젝트 스폰 (지형 높이는 메시 생성 때 계산한 값을 재사용)
+        SpawnObjectsInChunk(NewChunk, Heightmap);
 
         NewChunk.bIsGenerated = true;
         NewChunk.GenerationTime = TotalGenerationTime;
@@ -181,6 +214,12 @@ void AHSWorldGenerator::GenerateChunk(const FIntPoint& ChunkCoordinate)
         
         // 청크 저장
         GeneratedChunks.Add(ChunkCoordinate, NewChunk);
+
+        // 언로드했던 청크를 다시 만든 경우 churn으로 집계
+        if (UnloadedChunkHistory.Contains(ChunkCoordinate))
+        {
+            StreamingStats.ChunkRegenerations++;
+        }
         
         // 진행 상황 업데이트
         float Progress = (float)GeneratedChunks.Num() / (float)(GenerationSettings.WorldSizeInChunks * GenerationSettings.WorldSizeInChunks);
@@ -225,15 +264,8 @@ void AHSWorldGenerator::UnloadChunk(const FIntPoint& ChunkCoordinate)
     {
         if (UHierarchicalInstancedStaticMeshComponent* InstanceComponent = Entry.Component.Get())
         {
-            Entry.InstanceIndices.Sort(TGreater<int32>());
-            for (int32 InstanceIndex : Entry.InstanceIndices)
-            {
-                const int32 InstanceCount = InstanceComponent->GetInstanceCount();
-                if (InstanceIndex >= 0 && InstanceIndex < InstanceCount)
-                {
-                    InstanceComponent->RemoveInstance(InstanceIndex);
-                }
-            }
+            // 청크의 인스턴스를 핸들로 찾아 한 번에 제거
+            RemoveTrackedInstances(InstanceComponent, Entry.InstanceHandles);
 
             if (InstanceComponent->GetInstanceCount() == 0)
             {
@@ -241,6 +273,8 @@ void AHSWorldGenerator::UnloadChunk(const FIntPoint& ChunkCoordinate)
                 {
                     InstancedMeshComponents.Remove(Mesh);
                 }
+                InstanceHandleTables.Remove(InstanceComponent);
+                PendingInstanceTreeRebuilds.Remove(InstanceComponent);
                 InstanceComponent->DestroyComponent();
             }
         }
@@ -249,12 +283,43 @@ void AHSWorldGenerator::UnloadChunk(const FIntPoint& ChunkCoordinate)
 
     // 청크 제거
     GeneratedChunks.Remove(ChunkCoordinate);
+    UnloadedChunkHistory.Add(ChunkCoordinate);
+    StreamingStats.ChunksUnloaded++;
+
+    if (UnloadedChunkHistory.Num() > MaxUnloadedChunkHistory)
+    {
+        PruneUnloadedChunkHistory();
+    }
+}
+
+void AHSWorldGenerator::PruneUnloadedChunkHistory()
+{
+    // 재생성 churn은 플레이어가 경계를 오가며 생기므로 언로드 거리의 두 배 밖 기록은 당분간 다시 쓰이지 않음
+    const float RegenerationRadius = 2.0f * (GenerationSettings.ChunkUnloadDistance + GenerationSettings.ChunkUnloadHysteresis);
+
+    if (StreamingViewers.Num() > 0)
+    {
+        for (auto It = UnloadedChunkHistory.CreateIterator(); It; ++It)
+        {
+            if (GetDistanceToNearestViewer(*It) > RegenerationRadius)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    // 모든 기록이 반경 안에 있거나 플레이어가 없으면 기록을 비워 상한 유지
+    if (UnloadedChunkHistory.Num() > MaxUnloadedChunkHistory)
+    {
+        UnloadedChunkHistory.Empty();
+    }
 }
 
 void AHSWorldGenerator::UpdateChunksAroundPlayer(const FVector& PlayerLocation)
 {
     FIntPoint PlayerChunk = WorldToChunkCoordinate(PlayerLocation);
-    int32 LoadRadius = FMath::CeilToInt(GenerationSettings.ChunkUnloadDistance / GenerationSettings.ChunkSize);
+    const float LoadDistance = GenerationSettings.ChunkUnloadDistance;
+    int32 LoadRadius = FMath::CeilToInt(LoadDistance / GenerationSettings.ChunkSize);
     
     // 플레이어 주변에 청크 생성
     for (int32 X = -LoadRadius; X <= LoadRadius; X++)
@@ -267,15 +332,283 @@ void AHSWorldGenerator::UpdateChunksAroundPlayer(const FVector& PlayerLocation)
             if (FMath::Abs(ChunkCoord.X) <= GenerationSettings.WorldSizeInChunks / 2 &&
                 FMath::Abs(ChunkCoord.Y) <= GenerationSettings.WorldSizeInChunks / 2)
             {
-                if (!GeneratedChunks.Contains(ChunkCoord))
+                // 정사각형 모서리 청크는 언로드 거리 밖이라 만들자마자 지워지므로 원형 영역만 요청
+                if (FVector::Dist2D(PlayerLocation, ChunkToWorldLocation(ChunkCoord)) <= LoadDistance)
                 {
-                    ChunkGenerationQueue.Enqueue(ChunkCoord);
+                    EnqueueChunk(ChunkCoord);
                 }
             }
         }
     }
 }
 
+FHSChunkStreamingStats AHSWorldGenerator::GetChunkStreamingStats() const
+{
+    FHSChunkStreamingStats Stats = StreamingStats;
+    Stats.PendingChunks = PendingChunkHeap.Num() + DeferredChunkCount;
+    return Stats;
+}
+
+void AHSWorldGenerator::GatherStreamingViewers()
+{
+    StreamingViewers.Reset();
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        APlayerController* PC = It->Get();
+        APawn* PlayerPawn = PC ? PC->GetPawn() : nullptr;
+        if (IsValid(PlayerPawn))
+        {
+            StreamingViewers.Add({ PlayerPawn->GetActorLocation(), PlayerPawn->GetVelocity() });
+        }
+    }
+}
+
+bool AHSWorldGenerator::EnqueueChunk(const FIntPoint& ChunkCoordinate)
+{
+    if (GeneratedChunks.Contains(ChunkCoordinate))
+    {
+        return false;
+    }
+
+    bool bAlreadyPending = false;
+    PendingChunkSet.Add(ChunkCoordinate, &bAlreadyPending);
+    if (bAlreadyPending)
+    {
+        // 로드 영역 안의 청크는 매 틱 다시 요청되므로 대기 기간당 한 번만 집계
+        bool bAlreadyCounted = false;
+        DuplicateCountedChunks.Add(ChunkCoordinate, &bAlreadyCounted);
+        if (!bAlreadyCounted)
+        {
+            StreamingStats.DuplicateRequestsAvoided++;
+        }
+        return false;
+    }
+
+    PushPendingChunk(ChunkCoordinate);
+
+    // 스트리밍 범위에 들어온 바이옴의 에셋을 생성 전에 미리 로드
+    PreloadBiomeAssets(GetBiomeAtLocation(ChunkToWorldLocation(ChunkCoordinate)));
+    return true;
+}
+
+void AHSWorldGenerator::PreloadBiomeAssets(UHSBiomeData* BiomeData)
+{
+    if (!BiomeData || BiomePreloadGroups.Contains(BiomeData))
+    {
+        return;
+    }
+
+    UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get();
+    if (!PreloadManager)
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> AssetPaths;
+    for (const TArray<FBiomeSpawnableObject>* Spawnables : { &BiomeData->ResourceNodes, &BiomeData->EnvironmentProps })
+    {
+        for (const FBiomeSpawnableObject& Spawnable : *Spawnables)
+        {
+            if (!Spawnable.ActorClass.IsNull())
+            {
+                AssetPaths.Add(Spawnable.ActorClass.ToSoftObjectPath());
+            }
+        }
+    }
+
+    const FName GroupName(*FString::Printf(TEXT("%s.Biome.%s"), *GetName(), *BiomeData->GetName()));
+    BiomePreloadGroups.Add(BiomeData, GroupName);
+    PreloadManager->RequestPreload(GroupName, AssetPaths,
+        FStreamableDelegate::CreateUObject(this, &AHSWorldGenerator::HandleBiomeAssetsLoaded, TObjectKey<UHSBiomeData>(BiomeData)));
+}
+
+void AHSWorldGenerator::HandleBiomeAssetsLoaded(TObjectKey<UHSBiomeData> BiomeKey)
+{
+    TArray<FIntPoint> DeferredChunks;
+    if (!BiomeDeferredChunks.RemoveAndCopyValue(BiomeKey, DeferredChunks))
+    {
+        return;
+    }
+
+    DeferredChunkCount -= DeferredChunks.Num();
+
+    // 대기 중 취소된 청크(PendingChunkSet에서 빠진 청크)는 제외하고 현재 우선순위로 되돌림
+    for (const FIntPoint& ChunkCoord : DeferredChunks)
+    {
+        if (PendingChunkSet.Contains(ChunkCoord) && !GeneratedChunks.Contains(ChunkCoord))
+        {
+            PushPendingChunk(ChunkCoord);
+        }
+    }
+}
+
+void AHSWorldGenerator::ClearDeferredChunks()
+{
+    for (const auto& DeferredPair : BiomeDeferredChunks)
+    {
+        for (const FIntPoint& ChunkCoord : DeferredPair.Value)
+        {
+            RemovePendingChunk(ChunkCoord);
+        }
+    }
+
+    BiomeDeferredChunks.Empty();
+    DeferredChunkCount = 0;
+}
+
+bool AHSWorldGenerator::AreBiomeAssetsReady(UHSBiomeData* BiomeData) const
+{
+    const FName* GroupName = BiomeData ? BiomePreloadGroups.Find(BiomeData) : nullptr;
+    UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get();
+
+    // 선로딩을 요청하지 않은 경우는 기다리지 않음 (필요 시 동기 로딩으로 대체)
+    if (!GroupName || !PreloadManager)
+    {
+        return true;
+    }
+
+    return PreloadManager->IsPreloadComplete(*GroupName);
+}
+
+void AHSWorldGenerator::ReleaseAssetPreloads()
+{
+    if (UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get())
+    {
+        for (const auto& GroupPair : BiomePreloadGroups)
+        {
+            PreloadManager->ReleasePreload(GroupPair.Value);
+        }
+
+        if (!BossPreloadGroup.IsNone())
+        {
+            PreloadManager->ReleasePreload(BossPreloadGroup);
+        }
+    }
+
+    // 해제된 그룹은 완료 콜백이 오지 않으므로 기다리던 청크도 정리
+    ClearDeferredChunks();
+    BiomePreloadGroups.Empty();
+    BossPreloadGroup = NAME_None;
+    bBossSpawnDeferred = false;
+}
+
+float AHSWorldGenerator::GetDistanceToNearestViewer(const FIntPoint& ChunkCoordinate) const
+{
+    const FVector ChunkWorldPos = ChunkToWorldLocation(ChunkCoordinate);
+    float NearestDistance = TNumericLimits<float>::Max();
+
+    for (const FStreamingViewer& Viewer : StreamingViewers)
+    {
+        NearestDistance = FMath::Min(NearestDistance, FVector::Dist2D(Viewer.Location, ChunkWorldPos));
+    }
+
+    return NearestDistance;
+}
+
+float AHSWorldGenerator::ComputeChunkPriority(const FIntPoint& ChunkCoordinate, float& OutNearestDistance) const
+{
+    const float DirectionBias = GenerationSettings.MovementDirectionPriorityWeight * GenerationSettings.ChunkSize;
+    const FVector ChunkWorldPos = ChunkToWorldLocation(ChunkCoordinate);
+
+    float Priority = TNumericLimits<float>::Max();
+    OutNearestDistance = TNumericLimits<float>::Max();
+
+    for (const FStreamingViewer& Viewer : StreamingViewers)
+    {
+        const FVector ToChunk = (ChunkWorldPos - Viewer.Location).GetSafeNormal2D();
+        const FVector MoveDirection = Viewer.Velocity.GetSafeNormal2D();
+        const float Distance = FVector::Dist2D(Viewer.Location, ChunkWorldPos);
+
+        // 이동 방향 앞쪽은 더 가깝게, 뒤쪽은 더 멀게 취급
+        OutNearestDistance = FMath::Min(OutNearestDistance, Distance);
+        Priority = FMath::Min(Priority, Distance - DirectionBias * FVector::DotProduct(ToChunk, MoveDirection));
+    }
+
+    return Priority;
+}
+
+void AHSWorldGenerator::PushPendingChunk(const FIntPoint& ChunkCoordinate)
+{
+    // 플레이어가 없으면 모든 우선순위가 같아져 요청 순서대로 생성
+    float NearestDistance = 0.0f;
+    const float Priority = ComputeChunkPriority(ChunkCoordinate, NearestDistance);
+    PendingChunkHeap.HeapPush({ Priority, PendingChunkSequence++, ChunkCoordinate }, FPendingChunkEntryPredicate());
+}
+
+void AHSWorldGenerator::RemovePendingChunk(const FIntPoint& ChunkCoordinate)
+{
+    PendingChunkSet.Remove(ChunkCoordinate);
+    DuplicateCountedChunks.Remove(ChunkCoordinate);
+}
+
+void AHSWorldGenerator::RefreshPendingChunkPriorities()
+{
+    if (PendingChunkHeap.Num() == 0)
+    {
+        return;
+    }
+
+    const float DropDistance = GenerationSettings.ChunkUnloadDistance + GenerationSettings.ChunkUnloadHysteresis;
+
+    for (int32 Index = PendingChunkHeap.Num() - 1; Index >= 0; --Index)
+    {
+        FPendingChunkEntry& Entry = PendingChunkHeap[Index];
+
+        float NearestDistance = 0.0f;
+        Entry.Priority = ComputeChunkPriority(Entry.ChunkCoordinate, NearestDistance);
+
+        // 생성 전에 모든 플레이어가 멀어진 청크는 취소 (보스 청크 제외)
+        if (StreamingViewers.Num() > 0 && NearestDistance > DropDistance && Entry.ChunkCoordinate != GenerationSettings.BossSpawnChunk)
+        {
+            RemovePendingChunk(Entry.ChunkCoordinate);
+            PendingChunkHeap.RemoveAtSwap(Index, 1, false);
+            StreamingStats.PendingChunksDropped++;
+        }
+    }
+
+    PendingChunkHeap.Heapify(FPendingChunkEntryPredicate());
+}
+
+bool AHSWorldGenerator::DequeueHighestPriorityChunk(FIntPoint& OutChunkCoordinate)
+{
+    const float DropDistance = GenerationSettings.ChunkUnloadDistance + GenerationSettings.ChunkUnloadHysteresis;
+
+    // 우선순위는 넣을 때와 주기적 재계산 때만 갱신하고, 꺼낸 청크만 현재 위치로 취소 여부를 다시 확인
+    while (PendingChunkHeap.Num() > 0)
+    {
+        FPendingChunkEntry Entry;
+        PendingChunkHeap.HeapPop(Entry, FPendingChunkEntryPredicate(), false);
+
+        if (!PendingChunkSet.Contains(Entry.ChunkCoordinate) || GeneratedChunks.Contains(Entry.ChunkCoordinate))
+        {
+            continue;
+        }
+
+        float NearestDistance = 0.0f;
+        ComputeChunkPriority(Entry.ChunkCoordinate, NearestDistance);
+        if (StreamingViewers.Num() > 0 && NearestDistance > DropDistance && Entry.ChunkCoordinate != GenerationSettings.BossSpawnChunk)
+        {
+            RemovePendingChunk(Entry.ChunkCoordinate);
+            StreamingStats.PendingChunksDropped++;
+            continue;
+        }
+
+        // 바이옴 에셋 대기로 다시 넣을 수 있으므로 중복 집계 기록은 생성 후에 정리
+        OutChunkCoordinate = Entry.ChunkCoordinate;
+        PendingChunkSet.Remove(OutChunkCoordinate);
+        return true;
+    }
+
+    return false;
+}
+
 FIntPoint AHSWorldGenerator::WorldToChunkCoordinate(const FVector& WorldLocation) const
 {
     return FIntPoint(
@@ -314,34 +647,41 @@ UHSBiomeData* AHSWorldGenerator::GetBiomeAtLocation(const FVector& WorldLocation
 
 void AHSWorldGenerator::SpawnBoss()
 {
-    if (bBossSpawned || GenerationSettings.PossibleBosses.Num() == 0)
+    if (bBossSpawned || bBossSpawnDeferred || SelectedBossClass.IsNull())
     {
         return;
     }
     
-    // 랜덤하게 보스 선택
-    int32 BossIndex = RandomStream.RandRange(0, GenerationSettings.PossibleBosses.Num() - 1);
-    TSoftClassPtr<AActor> BossClassPtr = GenerationSettings.PossibleBosses[BossIndex];
+    // 보스 클래스가 아직 로드 중이면 로드 완료 시 다시 스폰 시도
+    UHSAssetPreloadManager* PreloadManager = UHSAssetPreloadManager::Get();
+    if (!SelectedBossClass.Get() && PreloadManager && !BossPreloadGroup.IsNone() && !PreloadManager->IsPreloadComplete(BossPreloadGroup))
+    {
+        bBossSpawnDeferred = true;
+        PreloadManager->RequestPreload(BossPreloadGroup, { SelectedBossClass.ToSoftObjectPath() },
+            FStreamableDelegate::CreateWeakLambda(this, [this]()
+            {
+                bBossSpawnDeferred = false;
+                SpawnBoss();
+            }));
+        return;
+    }
     
-    // 보스 클래스 로드
-    if (!BossClassPtr.IsNull())
+    // 보스 클래스 로드 (선로딩이 끝났으면 바로 반환됨)
+    UClass* BossClass = UHSAssetPreloadManager::ResolveSoftClass(SelectedBossClass, TEXT("AHSWorldGenerator::SpawnBoss"));
+    if (BossClass)
     {
-        UClass* BossClass = BossClassPtr.LoadSynchronous();
-        if (BossClass)
+        FVector BossSpawnLocation = ChunkToWorldLocation(GenerationSettings.BossSpawnChunk);
+        BossSpawnLocation.Z += 500.0f; // 지면 위로 스폰
+        
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+        
+        if (AActor* BossActor = GetWorld()->SpawnActor<AActor>(BossClass, BossSpawnLocation, FRotator::ZeroRotator, SpawnParams))
         {
-            FVector BossSpawnLocation = ChunkToWorldLocation(GenerationSettings.BossSpawnChunk);
-            BossSpawnLocation.Z += 500.0f; // 지면 위로 스폰
-            
-            FActorSpawnParameters SpawnParams;
-            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+            bBossSpawned = true;
+            OnWorldGenerationProgress.Broadcast(1.0f, TEXT("보스가 월드에 출현했습니다!"));
             
-            if (AActor* BossActor = GetWorld()->SpawnActor<AActor>(BossClass, BossSpawnLocation, FRotator::ZeroRotator, SpawnParams))
-            {
-                bBossSpawned = true;
-                OnWorldGenerationProgress.Broadcast(1.0f, TEXT("보스가 월드에 출현했습니다!"));
-                
-                // 보스 주변에 특별한 효과나 환경 변화 적용 가능
-            }
+            // 보스 주변에 특별한 효과나 환경 변화 적용 가능
         }
     }
 }
@@ -395,7 +735,7 @@ void AHSWorldGenerator::GenerateBiomeMap()
     }
 }
 
-UProceduralMeshComponent* AHSWorldGenerator::GenerateTerrainMesh(const FIntPoint& ChunkCoordinate, UHSBiomeData* BiomeData)
+UProceduralMeshComponent* AHSWorldGenerator::GenerateTerrainMesh(const FIntPoint& ChunkCoordinate, UHSBiomeData* BiomeData, TArray<float>& OutHeightmap)
 {
     if (!BiomeData)
     {
@@ -422,30 +762,62 @@ UProceduralMeshComponent* AHSWorldGenerator::GenerateTerrainMesh(const FIntPoint
     FVector ChunkWorldPos = ChunkToWorldLocation(ChunkCoordinate);
     FVector ChunkStartPos = ChunkWorldPos - FVector(GenerationSettings.ChunkSize * 0.5f, GenerationSettings.ChunkSize * 0.5f, 0.0f);
     
-    // 버텍스 생성
-    for (int32 Y = 0; Y < Resolution; Y++)
+    // 높이 샘플링 (가장자리 한 칸을 더 샘플링해 인접 청크와 경계 노말이 이어지도록 함)
+    const int32 PaddedResolution = Resolution + 2;
+    TArray<float> PaddedHeightmap;
+    PaddedHeightmap.SetNumUninitialized(PaddedResolution * PaddedResolution);
+    for (int32 Y = 0; Y < PaddedResolution; Y++)
     {
-        for (int32 X = 0; X < Resolution; X++)
+        for (int32 X = 0; X < PaddedResolution; X++)
         {
-            FVector VertexPosition = ChunkStartPos + FVector(X * CellSize, Y * CellSize, 0.0f);
-            
             // 바이옴 데이터를 사용해 높이 계산
-            float Height = BiomeData->CalculateTerrainHeightAtPosition(
-                FVector2D(VertexPosition.X, VertexPosition.Y), 
+            PaddedHeightmap[Y * PaddedResolution + X] = BiomeData->CalculateTerrainHeightAtPosition(
+                FVector2D(ChunkStartPos.X + (X - 1) * CellSize, ChunkStartPos.Y + (Y - 1) * CellSize),
                 GenerationSettings.RandomSeed
             );
+        }
+    }
+    
+    const int32 VertexCount = Resolution * Resolution;
+    OutHeightmap.SetNumUninitialized(VertexCount);
+    Vertices.SetNumUninitialized(VertexCount);
+    Normals.SetNumUninitialized(VertexCount);
+    Tangents.SetNumUninitialized(VertexCount);
+    UVs.SetNumUninitialized(VertexCount);
+    VertexColors.SetNumUninitialized(VertexCount);
+    
+    // 버텍스/노멀/탄젠트 생성 (행 단위 병렬, 노멀과 탄젠트는 높이 중앙 차분에서 같이 계산)
+    const double VertexStartTime = FPlatformTime::Seconds();
+    const float InvDoubleCellSize = 0.5f / CellSize;
+    ParallelFor(Resolution, [&](int32 Y)
+    {
+        for (int32 X = 0; X < Resolution; X++)
+        {
+            const int32 VertexIndex = Y * Resolution + X;
+            const int32 PaddedIndex = (Y + 1) * PaddedResolution + (X + 1);
+            const float Height = PaddedHeightmap[PaddedIndex];
+            
+            Vertices[VertexIndex] = FVector(X * CellSize, Y * CellSize, Height) + ChunkStartPos - ChunkWorldPos; // 로컬 좌표
+            OutHeightmap[VertexIndex] = Height;
             
-            VertexPosition.Z = Height;
-            Vertices.Add(VertexPosition - ChunkWorldPos); // 로컬 좌표로 변환
+            const float SlopeX = (PaddedHeightmap[PaddedIndex + 1] - PaddedHeightmap[PaddedIndex - 1]) * InvDoubleCellSize;
+            const float SlopeY = (PaddedHeightmap[PaddedIndex + PaddedResolution] - PaddedHeightmap[PaddedIndex - PaddedResolution]) * InvDoubleCellSize;
+            Normals[VertexIndex] = FVector(-SlopeX, -SlopeY, 1.0f).GetSafeNormal();
+            Tangents[VertexIndex] = FProcMeshTangent(FVector(1.0f, 0.0f, SlopeX).GetSafeNormal(), false);
             
             // UV 좌표
-            UVs.Add(FVector2D((float)X / (Resolution - 1), (float)Y / (Resolution - 1)));
+            UVs[VertexIndex] = FVector2D((float)X / (Resolution - 1), (float)Y / (Resolution - 1));
             
             // 버텍스 컬러 (높이 기반)
-            float HeightRatio = FMath::Clamp(Height / BiomeData->TerrainHeightMultiplier, 0.0f, 1.0f);
-            VertexColors.Add(FColor(HeightRatio * 255, HeightRatio * 255, HeightRatio * 255, 255));
+            const float HeightRatio = FMath::Clamp(Height / BiomeData->TerrainHeightMultiplier, 0.0f, 1.0f);
+            VertexColors[VertexIndex] = FColor(HeightRatio * 255, HeightRatio * 255, HeightRatio * 255, 255);
         }
-    }
+    });
+    
+    const double VertexElapsedMs = (FPlatformTime::Seconds() - VertexStartTime) * 1000.0;
+    UE_LOG(LogTemp, Verbose, TEXT("HSWorldGenerator: 청크 (%d, %d) 정점/노멀/탄젠트 %d개, %.2fms (%.1f 정점/ms)"),
+           ChunkCoordinate.X, ChunkCoordinate.Y, VertexCount, VertexElapsedMs,
+           VertexElapsedMs > 0.0 ? VertexCount / VertexElapsedMs : 0.0);
     
     // 삼각형 인덱스 생성
     for (int32 Y = 0; Y < Resolution - 1; Y++)
@@ -469,12 +841,6 @@ UProceduralMeshComponent* AHSWorldGenerator::GenerateTerrainMesh(const FIntPoint
         }
     }
     
-    // 노멀 계산
-    for (int32 i = 0; i < Vertices.Num(); i++)
-    {
-        Normals.Add(FVector::UpVector);
-    }
-    
     // 메시 생성
     TerrainMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, VertexColors, Tangents, true);
     
@@ -493,19 +859,103 @@ UProceduralMeshComponent* AHSWorldGenerator::GenerateTerrainMesh(const FIntPoint
     return TerrainMesh;
 }
 
-void AHSWorldGenerator::SpawnObjectsInChunk(FWorldChunk& Chunk)
+void AHSWorldGenerator::SpawnObjectsInChunk(FWorldChunk& Chunk, const TArray<float>& Heightmap)
 {
+    SCOPE_CYCLE_COUNTER(STAT_HSChunkObjectPlacement);
+
     if (!Chunk.BiomeData)
     {
         return;
     }
     
+    const double PlacementStartTime = FPlatformTime::Seconds();
+    int32 PlacedObjectCount = 0;
+
+    const float ChunkSize = GenerationSettings.ChunkSize;
     FVector ChunkWorldPos = ChunkToWorldLocation(Chunk.ChunkCoordinate);
-    FVector ChunkStartPos = ChunkWorldPos - FVector(GenerationSettings.ChunkSize * 0.5f, GenerationSettings.ChunkSize * 0.5f, 0.0f);
-    TArray<FVector> OccupiedLocations;
-    OccupiedLocations.Reserve(32);
+    FVector ChunkStartPos = ChunkWorldPos - FVector(ChunkSize * 0.5f, ChunkSize * 0.5f, 0.0f);
+
+    // 스폰 대상 선정
+    TArray<FBiomeSpawnableObject> ResourcestoSpawn = Chunk.BiomeData->FilterSpawnablesByProbability(
+        Chunk.BiomeData->ResourceNodes, 
+        RandomStream
+    );
+    TArray<FBiomeSpawnableObject> PropsToSpawn = Chunk.BiomeData->FilterSpawnablesByProbability(
+        Chunk.BiomeData->EnvironmentProps, 
+        RandomStream
+    );
+
+    // 지형 표면 샘플링 - 메시와 같은 삼각 분할로 높이맵을 보간해 트레이스 없이 높이와 법선을 구함
+    const int32 Resolution = GenerationSettings.TerrainResolution;
+    const bool bHasHeightmap = Resolution > 1 && Heightmap.Num() == Resolution * Resolution;
+    const float HeightmapCellSize = bHasHeightmap ? ChunkSize / (Resolution - 1) : ChunkSize;
+
+    auto SampleSurface = [&](float LocalX, float LocalY, float& OutHeight, FVector& OutNormal)
+    {
+        if (!bHasHeightmap)
+        {
+            OutHeight = Chunk.BiomeData->CalculateTerrainHeightAtPosition(
+                FVector2D(ChunkStartPos.X + LocalX, ChunkStartPos.Y + LocalY),
+                GenerationSettings.RandomSeed
+            );
+            OutNormal = FVector::UpVector;
+            return;
+        }
+
+        const float GridX = FMath::Clamp(LocalX / HeightmapCellSize, 0.0f, (float)(Resolution - 1));
+        const float GridY = FMath::Clamp(LocalY / HeightmapCellSize, 0.0f, (float)(Resolution - 1));
+        const int32 X0 = FMath::Min(FMath::FloorToInt(GridX), Resolution - 2);
+        const int32 Y0 = FMath::Min(FMath::FloorToInt(GridY), Resolution - 2);
+        const float U = GridX - X0;
+        const float V = GridY - Y0;
+
+        const float H00 = Heightmap[Y0 * Resolution + X0];
+        const float H10 = Heightmap[Y0 * Resolution + X0 + 1];
+        const float H01 = Heightmap[(Y0 + 1) * Resolution + X0];
+        const float H11 = Heightmap[(Y0 + 1) * Resolution + X0 + 1];
 
-    auto IsLocationValid = [&OccupiedLocations](const FVector& CandidateLocation, float MinDistance) -> bool
+        // 셀은 (X0+1,Y0)-(X0,Y0+1) 대각선으로 나뉨
+        float SlopeX;
+        float SlopeY;
+        if (U + V <= 1.0f)
+        {
+            OutHeight = H00 + U * (H10 - H00) + V * (H01 - H00);
+            SlopeX = (H10 - H00) / HeightmapCellSize;
+            SlopeY = (H01 - H00) / HeightmapCellSize;
+        }
+        else
+        {
+            OutHeight = H11 + (1.0f - U) * (H01 - H11) + (1.0f - V) * (H10 - H11);
+            SlopeX = (H11 - H01) / HeightmapCellSize;
+            SlopeY = (H11 - H10) / HeightmapCellSize;
+        }
+        OutNormal = FVector(-SlopeX, -SlopeY, 1.0f).GetSafeNormal();
+    };
+
+    // 배치 간격 확인용 버킷 격자 - 셀 크기를 최대 최소 간격 이상으로 두어 주변 3x3 셀만 확인
+    float MaxMinDistance = 0.0f;
+    for (const TArray<FBiomeSpawnableObject>* Spawnables : { &ResourcestoSpawn, &PropsToSpawn })
+    {
+        for (const FBiomeSpawnableObject& Spawnable : *Spawnables)
+        {
+            MaxMinDistance = FMath::Max(MaxMinDistance, Spawnable.MinDistanceBetweenObjects);
+        }
+    }
+
+    const float OccupancyCellSize = FMath::Max(MaxMinDistance, ChunkSize / 64.0f);
+    const int32 OccupancyGridSize = FMath::Max(1, FMath::CeilToInt(ChunkSize / OccupancyCellSize));
+    TArray<TArray<FVector2D, TInlineAllocator<4>>> OccupancyCells;
+    OccupancyCells.SetNum(OccupancyGridSize * OccupancyGridSize);
+
+    auto GetOccupancyCell = [&](const FVector& Location) -> FIntPoint
+    {
+        return FIntPoint(
+            FMath::Clamp(FMath::FloorToInt((Location.X - ChunkStartPos.X) / OccupancyCellSize), 0, OccupancyGridSize - 1),
+            FMath::Clamp(FMath::FloorToInt((Location.Y - ChunkStartPos.Y) / OccupancyCellSize), 0, OccupancyGridSize - 1)
+        );
+    };
+
+    auto IsLocationValid = [&](const FVector& CandidateLocation, float MinDistance) -> bool
     {
         if (MinDistance <= 0.0f)
         {
@@ -513,69 +963,99 @@ void AHSWorldGenerator::SpawnObjectsInChunk(FWorldChunk& Chunk)
         }
 
         const float MinDistanceSq = FMath::Square(MinDistance);
-        for (const FVector& ExistingLocation : OccupiedLocations)
+        const FVector2D Candidate2D(CandidateLocation.X, CandidateLocation.Y);
+        const FIntPoint CenterCell = GetOccupancyCell(CandidateLocation);
+        const int32 Reach = FMath::CeilToInt(MinDistance / OccupancyCellSize);
+
+        for (int32 CellY = FMath::Max(0, CenterCell.Y - Reach); CellY <= FMath::Min(OccupancyGridSize - 1, CenterCell.Y + Reach); ++CellY)
         {
-            if (FVector::DistSquared2D(ExistingLocation, CandidateLocation) < MinDistanceSq)
+            for (int32 CellX = FMath::Max(0, CenterCell.X - Reach); CellX <= FMath::Min(OccupancyGridSize - 1, CenterCell.X + Reach); ++CellX)
             {
-                return false;
+                for (const FVector2D& ExistingLocation : OccupancyCells[CellY * OccupancyGridSize + CellX])
+                {
+                    if (FVector2D::DistSquared(ExistingLocation, Candidate2D) < MinDistanceSq)
+                    {
+                        return false;
+                    }
+                }
             }
         }
         return true;
     };
 
-    auto TryComputePlacement = [&](const FBiomeSpawnableObject& Spawnable, FVector& OutLocation, FRotator& OutRotation) -> bool
+    auto MarkOccupied = [&](const FVector& Location)
     {
-        const int32 MaxAttempts = 16;
-        for (int32 Attempt = 0; Attempt < MaxAttempts; ++Attempt)
+        const FIntPoint Cell = GetOccupancyCell(Location);
+        OccupancyCells[Cell.Y * OccupancyGridSize + Cell.X].Add(FVector2D(Location.X, Location.Y));
+    };
+
+    // 지터 격자 샘플링 - 청크를 생성 개수만큼의 층으로 나누고 무작위 순서의 층 안에서 위치를 뽑아 고르게 분포
+    TArray<int32> StrataOrder;
+    auto GeneratePlacements = [&](const FBiomeSpawnableObject& Spawnable, int32 SpawnCount, TArray<FTransform>& OutPlacements)
+    {
+        OutPlacements.Reset();
+        if (SpawnCount <= 0)
         {
-            FVector CandidateLocation = ChunkStartPos + FVector(
-                RandomStream.FRandRange(0.0f, GenerationSettings.ChunkSize),
-                RandomStream.FRandRange(0.0f, GenerationSettings.ChunkSize),
-                0.0f
-            );
+            return;
+        }
 
-            float Height = Chunk.BiomeData->CalculateTerrainHeightAtPosition(
-                FVector2D(CandidateLocation.X, CandidateLocation.Y),
-                GenerationSettings.RandomSeed
-            );
+        const int32 StrataPerSide = FMath::CeilToInt(FMath::Sqrt((float)SpawnCount));
+        const float StratumSize = ChunkSize / StrataPerSide;
+
+        StrataOrder.Reset(StrataPerSide * StrataPerSide);
+        for (int32 Stratum = 0; Stratum < StrataPerSide * StrataPerSide; ++Stratum)
+        {
+            StrataOrder.Add(Stratum);
+        }
+        for (int32 Index = StrataOrder.Num() - 1; Index > 0; --Index)
+        {
+            StrataOrder.Swap(Index, RandomStream.RandRange(0, Index));
+        }
+
+        const int32 MaxAttemptsPerStratum = 4;
+        for (int32 Stratum : StrataOrder)
+        {
+            if (OutPlacements.Num() >= SpawnCount)
+            {
+                break;
+            }
 
-            CandidateLocation.Z = Height;
-            FVector FinalLocation = CandidateLocation + Spawnable.SpawnOffset;
-            FRotator FinalRotation(0.0f, RandomStream.FRandRange(0.0f, 360.0f), 0.0f);
+            const float StratumX = (Stratum % StrataPerSide) * StratumSize;
+            const float StratumY = (Stratum / StrataPerSide) * StratumSize;
 
-            if (Spawnable.bAlignToSurface)
+            for (int32 Attempt = 0; Attempt < MaxAttemptsPerStratum; ++Attempt)
             {
-                FHitResult HitResult;
-                const FVector TraceStart = CandidateLocation + FVector(0.0f, 0.0f, 2000.0f);
-                const FVector TraceEnd = CandidateLocation - FVector(0.0f, 0.0f, 2000.0f);
+                const float LocalX = StratumX + RandomStream.FRandRange(0.0f, StratumSize);
+                const float LocalY = StratumY + RandomStream.FRandRange(0.0f, StratumSize);
+
+                float Height;
+                FVector SurfaceNormal;
+                SampleSurface(LocalX, LocalY, Height, SurfaceNormal);
 
-                if (GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldStatic))
+                FVector FinalLocation = ChunkStartPos + FVector(LocalX, LocalY, Height) + Spawnable.SpawnOffset;
+                FRotator FinalRotation(0.0f, RandomStream.FRandRange(0.0f, 360.0f), 0.0f);
+
+                if (Spawnable.bAlignToSurface)
                 {
-                    FinalLocation = HitResult.Location + Spawnable.SpawnOffset;
-                    FinalRotation = HitResult.Normal.Rotation();
+                    FinalRotation = SurfaceNormal.Rotation();
                     FinalRotation.Pitch -= 90.0f;
                 }
-            }
 
-            if (!IsLocationValid(FinalLocation, Spawnable.MinDistanceBetweenObjects))
-            {
-                continue;
-            }
+                if (!IsLocationValid(FinalLocation, Spawnable.MinDistanceBetweenObjects))
+                {
+                    continue;
+                }
 
-            OutLocation = FinalLocation;
-            OutRotation = FinalRotation;
-            return true;
+                MarkOccupied(FinalLocation);
+                OutPlacements.Emplace(FinalRotation, FinalLocation);
+                break;
+            }
         }
-
-        return false;
     };
 
+    TArray<FTransform> Placements;
+
     // 자원 노드 스폰
-    TArray<FBiomeSpawnableObject> ResourcestoSpawn = Chunk.BiomeData->FilterSpawnablesByProbability(
-        Chunk.BiomeData->ResourceNodes, 
-        RandomStream
-    );
-    
     for (const FBiomeSpawnableObject& Resource : ResourcestoSpawn)
     {
         if (Resource.ActorClass.IsNull())
@@ -583,46 +1063,32 @@ void AHSWorldGenerator::SpawnObjectsInChunk(FWorldChunk& Chunk)
             continue;
         }
         
-        UClass* ActorClass = Resource.ActorClass.LoadSynchronous();
+        UClass* ActorClass = UHSAssetPreloadManager::ResolveSoftClass(Resource.ActorClass, TEXT("AHSWorldGenerator::SpawnObjectsInChunk"));
         if (!ActorClass)
         {
             continue;
         }
         
         int32 SpawnCount = RandomStream.RandRange(Resource.MinSpawnCount, Resource.MaxSpawnCount);
-        
-        int32 SpawnedCount = 0;
-        while (SpawnedCount < SpawnCount)
-        {
-            FVector SpawnLocation;
-            FRotator SpawnRotation;
-            if (!TryComputePlacement(Resource, SpawnLocation, SpawnRotation))
-            {
-                break;
-            }
+        GeneratePlacements(Resource, SpawnCount, Placements);
 
+        for (const FTransform& Placement : Placements)
+        {
             FActorSpawnParameters SpawnParams;
             SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-            if (AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(ActorClass, SpawnLocation, SpawnRotation, SpawnParams))
-            {
-                Chunk.SpawnedActors.Add(SpawnedActor);
-                OccupiedLocations.Add(SpawnedActor->GetActorLocation());
-                ++SpawnedCount;
-            }
-            else
+            AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(ActorClass, Placement.GetLocation(), Placement.Rotator(), SpawnParams);
+            if (!SpawnedActor)
             {
                 break;
             }
+
+            Chunk.SpawnedActors.Add(SpawnedActor);
+            ++PlacedObjectCount;
         }
     }
     
     // 환경 프롭 스폰 (인스턴스 메시로 최적화)
-    TArray<FBiomeSpawnableObject> PropsToSpawn = Chunk.BiomeData->FilterSpawnablesByProbability(
-        Chunk.BiomeData->EnvironmentProps, 
-        RandomStream
-    );
-
     for (const FBiomeSpawnableObject& Prop : PropsToSpawn)
     {
         if (Prop.ActorClass.IsNull())
@@ -630,7 +1096,7 @@ void AHSWorldGenerator::SpawnObjectsInChunk(FWorldChunk& Chunk)
             continue;
         }
 
-        UClass* ActorClass = Prop.ActorClass.LoadSynchronous();
+        UClass* ActorClass = UHSAssetPreloadManager::ResolveSoftClass(Prop.ActorClass, TEXT("AHSWorldGenerator::SpawnObjectsInChunk"));
         if (!ActorClass)
         {
             continue;
@@ -641,41 +1107,36 @@ void AHSWorldGenerator::SpawnObjectsInChunk(FWorldChunk& Chunk)
         UStaticMesh* StaticMesh = DefaultMeshComponent ? DefaultMeshComponent->GetStaticMesh() : nullptr;
 
         const int32 SpawnCount = RandomStream.RandRange(Prop.MinSpawnCount, Prop.MaxSpawnCount);
-        int32 SpawnedCount = 0;
+        GeneratePlacements(Prop, SpawnCount, Placements);
 
-        while (SpawnedCount < SpawnCount)
+        for (const FTransform& Placement : Placements)
         {
-            FVector SpawnLocation;
-            FRotator SpawnRotation;
-            if (!TryComputePlacement(Prop, SpawnLocation, SpawnRotation))
-            {
-                break;
-            }
-
             if (StaticMesh)
             {
-                const FTransform InstanceTransform(SpawnRotation, SpawnLocation);
-                SpawnInstancedMesh(Chunk, StaticMesh, InstanceTransform);
-                OccupiedLocations.Add(SpawnLocation);
-                ++SpawnedCount;
+                SpawnInstancedMesh(Chunk, StaticMesh, Placement);
+                ++PlacedObjectCount;
                 continue;
             }
 
             FActorSpawnParameters SpawnParams;
             SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-            if (AActor* SpawnedProp = GetWorld()->SpawnActor<AActor>(ActorClass, SpawnLocation, SpawnRotation, SpawnParams))
-            {
-                Chunk.SpawnedActors.Add(SpawnedProp);
-                OccupiedLocations.Add(SpawnedProp->GetActorLocation());
-                ++SpawnedCount;
-            }
-            else
+            AActor* SpawnedProp = GetWorld()->SpawnActor<AActor>(ActorClass, Placement.GetLocation(), Placement.Rotator(), SpawnParams);
+            if (!SpawnedProp)
             {
                 break;
             }
+
+            Chunk.SpawnedActors.Add(SpawnedProp);
+            ++PlacedObjectCount;
         }
     }
+
+    // 밀도별 배치 비용 비교용 측정값
+    StreamingStats.LastChunkPlacementMs = (float)((FPlatformTime::Seconds() - PlacementStartTime) * 1000.0);
+    StreamingStats.LastChunkPlacementCount = PlacedObjectCount;
+    UE_LOG(LogTemp, Verbose, TEXT("청크 %s 오브젝트 배치: %d개, %.2fms"),
+           *Chunk.ChunkCoordinate.ToString(), PlacedObjectCount, StreamingStats.LastChunkPlacementMs);
 }
 
 void AHSWorldGenerator::SpawnInstancedMesh(FWorldChunk& Chunk, UStaticMesh* StaticMesh, const FTransform& Transform)
@@ -701,6 +1162,9 @@ void AHSWorldGenerator::SpawnInstancedMesh(FWorldChunk& Chunk, UStaticMesh* Stat
         InstanceComponent->SetStaticMesh(StaticMesh);
         InstanceComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
         InstanceComponent->SetMobility(EComponentMobility::Movable);
+        // 트리 재빌드는 프레임당 한 번으로 모으고, 제거는 스왑 방식으로 고정해 핸들 재매핑과 일치시킴
+        InstanceComponent->bAutoRebuildTreeOnInstanceChanges = false;
+        InstanceComponent->bSupportRemoveAtSwap = true;
         InstanceComponent->RegisterComponent();
         
         InstancedMeshComponents.Add(StaticMesh, InstanceComponent);
@@ -709,7 +1173,7 @@ void AHSWorldGenerator::SpawnInstancedMesh(FWorldChunk& Chunk, UStaticMesh* Stat
     // 인스턴스 추가 (컴포넌트 기준 좌표계)
     const FTransform ComponentTransform = InstanceComponent->GetComponentTransform();
     const FTransform LocalTransform = Transform.GetRelativeTransform(ComponentTransform);
-    const int32 InstanceIndex = InstanceComponent->AddInstance(LocalTransform);
+    const int32 InstanceHandle = AddTrackedInstance(InstanceComponent, LocalTransform);
 
     FChunkInstancedMeshEntry* Entry = Chunk.InstancedMeshEntries.FindByPredicate([InstanceComponent](const FChunkInstancedMeshEntry& Existing)
     {
@@ -723,32 +1187,145 @@ void AHSWorldGenerator::SpawnInstancedMesh(FWorldChunk& Chunk, UStaticMesh* Stat
         Entry = &NewEntry;
     }
 
-    Entry->InstanceIndices.Add(InstanceIndex);
+    Entry->InstanceHandles.Add(InstanceHandle);
+}
+
+int32 AHSWorldGenerator::AddTrackedInstance(UHierarchicalInstancedStaticMeshComponent* InstanceComponent, const FTransform& LocalTransform)
+{
+    FInstanceHandleTable& Table = InstanceHandleTables.FindOrAdd(InstanceComponent);
+
+    const int32 InstanceIndex = InstanceComponent->AddInstance(LocalTransform);
+
+    int32 Handle = INDEX_NONE;
+    if (Table.FreeHandles.Num() > 0)
+    {
+        Handle = Table.FreeHandles.Pop(false);
+        Table.InstanceByHandle[Handle] = InstanceIndex;
+    }
+    else
+    {
+        Handle = Table.InstanceByHandle.Add(InstanceIndex);
+    }
+
+    // AddInstance는 항상 끝에 추가되므로 인스턴스 인덱스와 테이블 길이가 일치
+    check(InstanceIndex == Table.HandleByInstance.Num());
+    Table.HandleByInstance.Add(Handle);
+
+    MarkInstanceTreeDirty(InstanceComponent);
+    return Handle;
+}
+
+void AHSWorldGenerator::RemoveTrackedInstances(UHierarchicalInstancedStaticMeshComponent* InstanceComponent, const TArray<int32>& InstanceHandles)
+{
+    FInstanceHandleTable* Table = InstanceHandleTables.Find(InstanceComponent);
+    if (!Table || InstanceHandles.Num() == 0)
+    {
+        return;
+    }
+
+    // 핸들 -> 현재 인덱스 변환 후 내림차순 정렬
+    // 내림차순으로 스왑 제거하면 끝에서 당겨오는 인스턴스는 항상 아직 남아야 할 인스턴스
+    TArray<int32> InstanceIndices;
+    InstanceIndices.Reserve(InstanceHandles.Num());
+    for (int32 Handle : InstanceHandles)
+    {
+        if (Table->InstanceByHandle.IsValidIndex(Handle) && Table->InstanceByHandle[Handle] != INDEX_NONE)
+        {
+            InstanceIndices.Add(Table->InstanceByHandle[Handle]);
+            Table->InstanceByHandle[Handle] = INDEX_NONE;
+            Table->FreeHandles.Add(Handle);
+        }
+    }
+    InstanceIndices.Sort(TGreater<int32>());
+
+    // 컴포넌트와 동일한 스왑 제거 순서로 핸들 테이블 재매핑
+    for (int32 RemovedIndex : InstanceIndices)
+    {
+        const int32 LastIndex = Table->HandleByInstance.Num() - 1;
+        if (RemovedIndex != LastIndex)
+        {
+            const int32 MovedHandle = Table->HandleByInstance[LastIndex];
+            Table->HandleByInstance[RemovedIndex] = MovedHandle;
+            Table->InstanceByHandle[MovedHandle] = RemovedIndex;
+        }
+        Table->HandleByInstance.Pop(false);
+    }
+
+    // 한 번의 호출로 일괄 제거 (트리 재빌드는 지연)
+    InstanceComponent->RemoveInstances(InstanceIndices);
+    ensureMsgf(Table->HandleByInstance.Num() == InstanceComponent->GetInstanceCount(),
+        TEXT("HSWorldGenerator: 인스턴스 핸들 테이블이 컴포넌트와 어긋났습니다 (%d != %d)"),
+        Table->HandleByInstance.Num(), InstanceComponent->GetInstanceCount());
+
+    MarkInstanceTreeDirty(InstanceComponent);
+}
+
+void AHSWorldGenerator::MarkInstanceTreeDirty(UHierarchicalInstancedStaticMeshComponent* InstanceComponent)
+{
+    PendingInstanceTreeRebuilds.Add(InstanceComponent);
+
+    if (!bInstanceTreeRebuildScheduled)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            bInstanceTreeRebuildScheduled = true;
+            World->GetTimerManager().SetTimerForNextTick(this, &AHSWorldGenerator::FlushInstanceTreeRebuilds);
+        }
+    }
+}
+
+void AHSWorldGenerator::FlushInstanceTreeRebuilds()
+{
+    bInstanceTreeRebuildScheduled = false;
+
+    // 같은 프레임의 로드/언로드로 쌓인 변경을 컴포넌트당 한 번의 비동기 재빌드로 처리
+    for (const TWeakObjectPtr<UHierarchicalInstancedStaticMeshComponent>& ComponentPtr : PendingInstanceTreeRebuilds)
+    {
+        if (UHierarchicalInstancedStaticMeshComponent* InstanceComponent = ComponentPtr.Get())
+        {
+            InstanceComponent->BuildTreeIfOutdated(true, false);
+        }
+    }
+    PendingInstanceTreeRebuilds.Reset();
 }
 
 void AHSWorldGenerator::ProcessChunkGeneration()
 {
-    while (!ChunkGenerationQueue.IsEmpty() && ChunksGeneratedThisFrame < GenerationSettings.MaxChunksToGeneratePerFrame)
+    while (PendingChunkHeap.Num() > 0 && ChunksGeneratedThisFrame < GenerationSettings.MaxChunksToGeneratePerFrame)
     {
         FIntPoint ChunkToGenerate;
-        if (ChunkGenerationQueue.Dequeue(ChunkToGenerate))
+        if (!DequeueHighestPriorityChunk(ChunkToGenerate))
+        {
+            break;
+        }
+
+        // 바이옴 에셋이 아직 로드 중이면 로드 완료까지 따로 보관하고 다음 청크로 진행
+        // (꺼낸 청크는 대기 목록에서 빠지므로 한 틱에 청크마다 최대 한 번만 검사됨)
+        UHSBiomeData* ChunkBiome = GetBiomeAtLocation(ChunkToWorldLocation(ChunkToGenerate));
+        if (!AreBiomeAssetsReady(ChunkBiome))
         {
-            GenerateChunk(ChunkToGenerate);
-            ChunksGeneratedThisFrame++;
+            BiomeDeferredChunks.FindOrAdd(ChunkBiome).Add(ChunkToGenerate);
+            PendingChunkSet.Add(ChunkToGenerate);
+            DeferredChunkCount++;
+            continue;
         }
+
+        GenerateChunk(ChunkToGenerate);
+        DuplicateCountedChunks.Remove(ChunkToGenerate);
+        ChunksGeneratedThisFrame++;
     }
     
     // 모든 청크 생성 완료 체크
-    if (ChunkGenerationQueue.IsEmpty() && !bBossSpawned)
+    if (PendingChunkHeap.Num() == 0 && DeferredChunkCount == 0 && !bBossSpawned)
     {
-        // 보스 청크가 아직 생성되지 않았다면 강제 생성
+        // 보스 청크가 아직 생성되지 않았다면 강제 생성 (바이옴 선로딩을 거치도록 대기 목록으로)
         if (!GeneratedChunks.Contains(GenerationSettings.BossSpawnChunk))
         {
-            GenerateChunk(GenerationSettings.BossSpawnChunk);
+            EnqueueChunk(GenerationSettings.BossSpawnChunk);
         }
     }
     
-    if (ChunkGenerationQueue.IsEmpty() && bBossSpawned)
+    if (PendingChunkHeap.Num() == 0 && DeferredChunkCount == 0 && bBossSpawned)
     {
         OnWorldGenerationComplete.Broadcast();
     }
@@ -756,27 +1333,20 @@ void AHSWorldGenerator::ProcessChunkGeneration()
 
 void AHSWorldGenerator::CleanupDistantChunks()
 {
-    if (!IsValid(UGameplayStatics::GetPlayerController(GetWorld(), 0)))
+    // 플레이어가 없으면 기준이 없으므로 유지
+    if (StreamingViewers.Num() == 0)
     {
         return;
     }
     
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerController(GetWorld(), 0)->GetPawn();
-    if (!IsValid(PlayerPawn))
-    {
-        return;
-    }
-    
-    FVector PlayerLocation = PlayerPawn->GetActorLocation();
+    // 로드 거리보다 히스테리시스만큼 더 멀어져야 언로드 (경계에서 로드/언로드 반복 방지)
+    const float UnloadDistance = GenerationSettings.ChunkUnloadDistance + GenerationSettings.ChunkUnloadHysteresis;
     TArray<FIntPoint> ChunksToUnload;
     
-    // 먼 청크 찾기
+    // 모든 플레이어에게서 먼 청크 찾기
     for (const auto& ChunkPair : GeneratedChunks)
     {
-        FVector ChunkWorldPos = ChunkToWorldLocation(ChunkPair.Key);
-        float Distance = FVector::Dist2D(PlayerLocation, ChunkWorldPos);
-        
-        if (Distance > GenerationSettings.ChunkUnloadDistance)
+        if (GetDistanceToNearestViewer(ChunkPair.Key) > UnloadDistance)
         {
             ChunksToUnload.Add(ChunkPair.Key);
         }
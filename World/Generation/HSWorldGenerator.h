@@ -5,6 +5,7 @@
 #include "GameFramework/Actor.h"
 #include "Engine/DataTable.h"
 #include "UObject/ObjectPtr.h"
+#include "UObject/ObjectKey.h"
 #include "HSBiomeData.h"
 #include "HSWorldGenerator.generated.h"
 
@@ -22,8 +23,9 @@ struct FChunkInstancedMeshEntry
     UPROPERTY(BlueprintReadWrite)
     TObjectPtr<UHierarchicalInstancedStaticMeshComponent> Component;
 
+    // 인스턴스 핸들 (스왑 제거로 바뀌는 인덱스 대신 저장, 생성기의 핸들 테이블로 변환)
     UPROPERTY(BlueprintReadWrite)
-    TArray<int32> InstanceIndices;
+    TArray<int32> InstanceHandles;
 };
 
 /**
@@ -93,6 +95,14 @@ struct FWorldGenerationSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "1000.0"))
     float ChunkUnloadDistance = 15000.0f;
 
+    // 언로드 판정에 더하는 여유 거리 (로드 경계 부근에서의 로드/언로드 반복 방지)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "0.0"))
+    float ChunkUnloadHysteresis = 2500.0f;
+
+    // 이동 방향 앞쪽 청크를 먼저 생성하도록 거리에서 빼는 가중치 (청크 크기 배수)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "0.0"))
+    float MovementDirectionPriorityWeight = 0.5f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss")
     FIntPoint BossSpawnChunk;
 
@@ -100,6 +110,42 @@ struct FWorldGenerationSettings
     TArray<TSoftClassPtr<AActor>> PossibleBosses;
 };
 
+/**
+ * 청크 스트리밍 통계
+ */
+USTRUCT(BlueprintType)
+struct FHSChunkStreamingStats
+{
+    GENERATED_BODY()
+
+    // 대기 중인 청크 수
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    int32 PendingChunks = 0;
+
+    // 대기 중에 다시 요청된 청크 수 (대기 기간당 한 번만 집계)
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    int32 DuplicateRequestsAvoided = 0;
+
+    // 생성 전에 모든 플레이어가 멀어져 취소된 청크 수
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    int32 PendingChunksDropped = 0;
+
+    // 언로드된 청크 수
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    int32 ChunksUnloaded = 0;
+
+    // 언로드 후 다시 생성된 청크 수 (스트리밍 churn)
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    int32 ChunkRegenerations = 0;
+
+    // 마지막 청크의 오브젝트 배치 시간 (ms)과 배치 수 (밀도별 비교용)
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    float LastChunkPlacementMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    int32 LastChunkPlacementCount = 0;
+};
+
 /**
  * 월드 생성 진행 상황 델리게이트
  */
@@ -115,6 +161,11 @@ class HUNTINGSPIRIT_API AHSWorldGenerator : public AActor
 {
     GENERATED_BODY()
 
+#if WITH_DEV_AUTOMATION_TESTS
+    friend class FHSWorldGeneratorInstanceCycleTest;
+    friend class FHSWorldGeneratorPlacementDensityTest;
+#endif
+
 public:
     AHSWorldGenerator();
 
@@ -173,6 +224,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "World Generation")
     void UpdateChunksAroundPlayer(const FVector& PlayerLocation);
 
+    /**
+     * 청크 스트리밍 통계 가져오기
+     */
+    UFUNCTION(BlueprintPure, Category = "World Generation")
+    FHSChunkStreamingStats GetChunkStreamingStats() const;
+
     /**
      * 월드 좌표를 청크 좌표로 변환
      * @param WorldLocation 월드 위치
@@ -208,8 +265,48 @@ protected:
     UPROPERTY()
     TMap<FIntPoint, FWorldChunk> GeneratedChunks;
 
-    // 청크 생성 큐
-    TQueue<FIntPoint> ChunkGenerationQueue;
+    // 청크 생성 대기 힙 (우선순위가 낮을수록 먼저, 같으면 먼저 요청된 청크 우선)
+    struct FPendingChunkEntry
+    {
+        float Priority = 0.0f;
+        uint32 Sequence = 0;
+        FIntPoint ChunkCoordinate;
+    };
+
+    struct FPendingChunkEntryPredicate
+    {
+        bool operator()(const FPendingChunkEntry& A, const FPendingChunkEntry& B) const
+        {
+            return A.Priority < B.Priority || (A.Priority == B.Priority && A.Sequence < B.Sequence);
+        }
+    };
+
+    TArray<FPendingChunkEntry> PendingChunkHeap;
+    uint32 PendingChunkSequence = 0;
+
+    // 대기 중인 청크 집합 (중복 방지, 바이옴 에셋을 기다리는 청크 포함)
+    TSet<FIntPoint> PendingChunkSet;
+
+    // 대기 중 중복 요청이 이미 집계된 청크 (대기 기간당 한 번만 집계)
+    TSet<FIntPoint> DuplicateCountedChunks;
+
+    // 플레이어 이동을 반영해 대기 힙 우선순위를 다시 계산하는 주기
+    static constexpr float PendingPriorityRefreshInterval = 0.25f;
+    float PendingPriorityRefreshTimer = 0.0f;
+
+    // 스트리밍 기준이 되는 플레이어 위치/속도 (매 틱 갱신)
+    struct FStreamingViewer
+    {
+        FVector Location;
+        FVector Velocity;
+    };
+    TArray<FStreamingViewer> StreamingViewers;
+
+    // 한 번이라도 언로드된 청크 (재생성 churn 집계용, 상한을 넘으면 재생성 반경 밖 기록부터 정리)
+    TSet<FIntPoint> UnloadedChunkHistory;
+    static constexpr int32 MaxUnloadedChunkHistory = 1024;
+
+    FHSChunkStreamingStats StreamingStats;
 
     // 현재 생성 중인지 여부
     bool bIsGenerating;
@@ -221,9 +318,35 @@ protected:
     UPROPERTY()
     TMap<UStaticMesh*, UHierarchicalInstancedStaticMeshComponent*> InstancedMeshComponents;
 
+    // 공유 인스턴스 컴포넌트별 핸들 테이블 (스왑 제거 시 이동한 인스턴스의 핸들을 재매핑)
+    struct FInstanceHandleTable
+    {
+        TArray<int32> HandleByInstance;     // 인스턴스 인덱스 -> 핸들
+        TArray<int32> InstanceByHandle;     // 핸들 -> 인스턴스 인덱스 (해제된 핸들은 INDEX_NONE)
+        TArray<int32> FreeHandles;
+    };
+
+    TMap<TObjectKey<UHierarchicalInstancedStaticMeshComponent>, FInstanceHandleTable> InstanceHandleTables;
+
+    // 이번 프레임에 인스턴스가 바뀌어 클러스터 트리 재빌드가 필요한 컴포넌트
+    TSet<TWeakObjectPtr<UHierarchicalInstancedStaticMeshComponent>> PendingInstanceTreeRebuilds;
+    bool bInstanceTreeRebuildScheduled = false;
+
     // 보스가 스폰되었는지 여부
     bool bBossSpawned;
 
+    // 생성 시작 시 선택한 보스 (스폰 전에 미리 비동기 로드)
+    TSoftClassPtr<AActor> SelectedBossClass;
+    FName BossPreloadGroup;
+    bool bBossSpawnDeferred = false;
+
+    // 스트리밍 범위에 들어온 바이옴별 선로딩 그룹 (요청 여부 확인 겸용)
+    TMap<TObjectKey<UHSBiomeData>, FName> BiomePreloadGroups;
+
+    // 바이옴 에셋 로드를 기다리는 청크 (로드 완료 시 대기 목록으로 되돌림, PendingChunkSet에는 남아 있음)
+    TMap<TObjectKey<UHSBiomeData>, TArray<FIntPoint>> BiomeDeferredChunks;
+    int32 DeferredChunkCount = 0;
+
 protected:
     /**
      * 바이옴 맵 생성 (Voronoi 다이어그램 기반)
@@ -234,15 +357,17 @@ protected:
      * 청크의 지형 메시 생성
      * @param ChunkCoordinate 청크 좌표
      * @param BiomeData 바이옴 데이터
+     * @param OutHeightmap 정점 격자 높이 (행 우선, TerrainResolution²개)
      * @return 생성된 프로시저럴 메시 컴포넌트
      */
-    UProceduralMeshComponent* GenerateTerrainMesh(const FIntPoint& ChunkCoordinate, UHSBiomeData* BiomeData);
+    UProceduralMeshComponent* GenerateTerrainMesh(const FIntPoint& ChunkCoordinate, UHSBiomeData* BiomeData, TArray<float>& OutHeightmap);
 
     /**
      * 청크에 오브젝트 스폰
      * @param Chunk 청크 정보
+     * @param Heightmap 지형 메시 생성 시 계산한 높이 (비어 있으면 바이옴 높이 함수 사용)
      */
-    void SpawnObjectsInChunk(FWorldChunk& Chunk);
+    void SpawnObjectsInChunk(FWorldChunk& Chunk, const TArray<float>& Heightmap);
 
     /**
      * 인스턴스 메시로 오브젝트 스폰 (최적화)
@@ -252,6 +377,23 @@ protected:
      */
     void SpawnInstancedMesh(FWorldChunk& Chunk, UStaticMesh* StaticMesh, const FTransform& Transform);
 
+    /**
+     * 핸들 테이블에 등록하며 인스턴스 추가 (트리 재빌드는 프레임 끝으로 지연)
+     * @return 인스턴스 핸들
+     */
+    int32 AddTrackedInstance(UHierarchicalInstancedStaticMeshComponent* InstanceComponent, const FTransform& LocalTransform);
+
+    /**
+     * 핸들 목록의 인스턴스를 한 번의 호출로 일괄 제거하고 이동한 인스턴스의 핸들을 재매핑
+     */
+    void RemoveTrackedInstances(UHierarchicalInstancedStaticMeshComponent* InstanceComponent, const TArray<int32>& InstanceHandles);
+
+    /**
+     * 클러스터 트리 재빌드를 다음 틱에 한 번으로 모아 처리
+     */
+    void MarkInstanceTreeDirty(UHierarchicalInstancedStaticMeshComponent* InstanceComponent);
+    void FlushInstanceTreeRebuilds();
+
     /**
      * 청크 간 경계 부드럽게 처리
      * @param ChunkCoordinate 청크 좌표
@@ -268,6 +410,78 @@ protected:
      */
     void CleanupDistantChunks();
 
+    /**
+     * 바이옴의 스폰 대상 에셋을 비동기로 미리 로드 (바이옴당 한 번만 요청)
+     */
+    void PreloadBiomeAssets(UHSBiomeData* BiomeData);
+
+    /**
+     * 바이옴 에셋 선로딩이 끝났는지 여부 (선로딩 관리자가 없으면 항상 true)
+     */
+    bool AreBiomeAssetsReady(UHSBiomeData* BiomeData) const;
+
+    /**
+     * 바이옴 에셋 로드 완료 시 해당 바이옴을 기다리던 청크를 대기 목록으로 되돌림
+     */
+    void HandleBiomeAssetsLoaded(TObjectKey<UHSBiomeData> BiomeKey);
+
+    /**
+     * 바이옴 에셋을 기다리는 청크 목록 비우기 (PendingChunkSet에서도 제거)
+     */
+    void ClearDeferredChunks();
+
+    /**
+     * 선로딩 그룹 해제
+     */
+    void ReleaseAssetPreloads();
+
+    /**
+     * 모든 플레이어의 위치/속도 수집
+     */
+    void GatherStreamingViewers();
+
+    /**
+     * 중복 없이 청크 생성 요청
+     * @return 새로 대기 목록에 추가되었는지 여부
+     */
+    bool EnqueueChunk(const FIntPoint& ChunkCoordinate);
+
+    /**
+     * 가장 우선순위가 높은 대기 청크를 꺼냄 (모든 플레이어와 멀어진 청크는 취소)
+     */
+    bool DequeueHighestPriorityChunk(FIntPoint& OutChunkCoordinate);
+
+    /**
+     * 현재 플레이어 위치/이동 방향 기준 생성 우선순위 (낮을수록 먼저)
+     * @param OutNearestDistance 가장 가까운 플레이어와의 2D 거리
+     */
+    float ComputeChunkPriority(const FIntPoint& ChunkCoordinate, float& OutNearestDistance) const;
+
+    /**
+     * 청크를 현재 우선순위로 대기 힙에 추가
+     */
+    void PushPendingChunk(const FIntPoint& ChunkCoordinate);
+
+    /**
+     * 대기 힙 전체의 우선순위를 다시 계산하고 멀어진 청크는 취소
+     */
+    void RefreshPendingChunkPriorities();
+
+    /**
+     * 대기 집합에서 청크 제거 (중복 집계 기록도 함께 정리)
+     */
+    void RemovePendingChunk(const FIntPoint& ChunkCoordinate);
+
+    /**
+     * 언로드 기록이 상한을 넘으면 모든 플레이어의 재생성 반경 밖 기록부터 제거
+     */
+    void PruneUnloadedChunkHistory();
+
+    /**
+     * 가장 가까운 플레이어와의 2D 거리 (플레이어가 없으면 float 최대값)
+     */
+    float GetDistanceToNearestViewer(const FIntPoint& ChunkCoordinate) const;
+
     /**
      * 특정 위치에서 가장 가까운 바이옴 시드 찾기
      * @param Location 위치
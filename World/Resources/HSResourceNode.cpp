@@ -8,6 +8,8 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "HuntingSpirit/Characters/Base/HSCharacterBase.h"
+#include "HSResourceNodeRegistry.h"
+#include "HuntingSpirit/Optimization/ObjectPool/HSObjectPool.h"
 
 AHSResourceNode::AHSResourceNode()
 {
@@ -45,6 +47,19 @@ void AHSResourceNode::BeginPlay()
     
     // 초기 시각적 상태 업데이트
     UpdateNodeVisuals();
+
+    // 레벨에 직접 배치/스폰된 노드는 즉시 등록, 풀 소유 노드는 청크가 배치 후 등록
+    if (!Cast<AHSObjectPool>(GetOwner()))
+    {
+        SetSpatiallyRegistered(true);
+    }
+}
+
+void AHSResourceNode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    SetSpatiallyRegistered(false);
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AHSResourceNode::Tick(float DeltaTime)
@@ -182,6 +197,35 @@ void AHSResourceNode::HandleResourceRespawn()
     UpdateNodeVisuals();
 }
 
+void AHSResourceNode::SetSpatiallyRegistered(bool bRegister)
+{
+    bWantsSpatialRegistration = bRegister;
+    SyncSpatialRegistration();
+}
+
+void AHSResourceNode::SyncSpatialRegistration()
+{
+    UWorld* World = GetWorld();
+    UHSResourceNodeRegistry* Registry = World ? World->GetSubsystem<UHSResourceNodeRegistry>() : nullptr;
+    if (!Registry)
+    {
+        bIsInSpatialRegistry = false;
+        return;
+    }
+
+    if (bWantsSpatialRegistration && CanBeGathered())
+    {
+        // 풀에서 재배치된 경우에도 위치를 갱신하도록 항상 재등록
+        Registry->RegisterNode(this);
+        bIsInSpatialRegistry = true;
+    }
+    else if (bIsInSpatialRegistry)
+    {
+        Registry->UnregisterNode(this);
+        bIsInSpatialRegistry = false;
+    }
+}
+
 void AHSResourceNode::EnableGathering()
 {
     bCanBeGathered = true;
@@ -194,6 +238,8 @@ void AHSResourceNode::EnableGathering()
     {
         ResourceInfoWidget->SetVisibility(true);
     }
+
+    SyncSpatialRegistration();
 }
 
 void AHSResourceNode::DisableGathering()
@@ -208,6 +254,9 @@ void AHSResourceNode::DisableGathering()
     {
         ResourceInfoWidget->SetVisibility(false);
     }
+
+    // 고갈된 노드는 공간 레지스트리에서 제외
+    SyncSpatialRegistration();
 }
 
 void AHSResourceNode::UpdateNodeVisuals()
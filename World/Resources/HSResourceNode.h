@@ -59,6 +59,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
 
     // 자원 재생성 타이머 핸들러
@@ -73,6 +74,9 @@ protected:
     // 자원 노드 시각적 업데이트
     void UpdateNodeVisuals();
 
+    // 공간 레지스트리 등록 상태를 채집 가능 여부와 일치시킴
+    void SyncSpatialRegistration();
+
 public:
     // 자원 채집 시작
     UFUNCTION(BlueprintCallable, Category = "Resource")
@@ -102,6 +106,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Resource")
     float GetGatheringTimePerResource() const { return GatheringTimePerResource; }
 
+    // 공간 레지스트리 등록 여부 설정 (청크 스폰/풀 반환 시 호출, 고갈 중에는 자동 해제)
+    void SetSpatiallyRegistered(bool bRegister);
+
 protected:
     // 컴포넌트
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -152,6 +159,10 @@ protected:
     // 자원 재생성 타이머 핸들
     FTimerHandle RespawnTimerHandle;
 
+    // 공간 레지스트리 등록 요청 여부 / 실제 등록 여부
+    bool bWantsSpatialRegistration = false;
+    bool bIsInSpatialRegistry = false;
+
     // 시각 효과
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
     class UParticleSystem* GatheringEffect;
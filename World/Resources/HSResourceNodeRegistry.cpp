@@ -0,0 +1,132 @@
+// HSResourceNodeRegistry.cpp
+#include "HSResourceNodeRegistry.h"
+#include "Engine/World.h"
+
+void UHSResourceNodeRegistry::Deinitialize()
+{
+    Cells.Empty();
+    NodeCells.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UHSResourceNodeRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHSResourceNodeRegistry::RegisterNode(AHSResourceNode* Node)
+{
+    if (!IsValid(Node))
+    {
+        return;
+    }
+
+    const FVector Location = Node->GetActorLocation();
+    const FIntPoint NewCell = GetCellCoord(Location);
+
+    // 이미 등록된 노드는 이전 셀에서 제거 후 재등록
+    if (const FIntPoint* ExistingCell = NodeCells.Find(Node))
+    {
+        RemoveFromCell(*ExistingCell, Node);
+    }
+
+    FHSResourceNodeGridEntry& Entry = Cells.FindOrAdd(NewCell).AddDefaulted_GetRef();
+    Entry.Node = Node;
+    Entry.Location = Location;
+    Entry.ResourceType = Node->GetResourceType();
+
+    NodeCells.Add(Node, NewCell);
+}
+
+void UHSResourceNodeRegistry::UnregisterNode(AHSResourceNode* Node)
+{
+    FIntPoint CellCoord;
+    if (NodeCells.RemoveAndCopyValue(Node, CellCoord))
+    {
+        RemoveFromCell(CellCoord, Node);
+    }
+}
+
+int32 UHSResourceNodeRegistry::QueryNodesInRadius(const FVector& Center, float Radius, EResourceType TypeFilter, TArray<AHSResourceNode*>& OutNodes) const
+{
+    OutNodes.Reset();
+    LastQueryCellsVisited = 0;
+    LastQueryEntriesTested = 0;
+
+    if (Radius <= 0.0f || Cells.Num() == 0)
+    {
+        return 0;
+    }
+
+    const FIntPoint MinCell = GetCellCoord(Center - FVector(Radius, Radius, 0.0f));
+    const FIntPoint MaxCell = GetCellCoord(Center + FVector(Radius, Radius, 0.0f));
+    const float RadiusSquared = FMath::Square(Radius);
+
+    for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+    {
+        for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+        {
+            const TArray<FHSResourceNodeGridEntry>* CellEntries = Cells.Find(FIntPoint(CellX, CellY));
+            if (!CellEntries)
+            {
+                continue;
+            }
+
+            ++LastQueryCellsVisited;
+            for (const FHSResourceNodeGridEntry& Entry : *CellEntries)
+            {
+                ++LastQueryEntriesTested;
+
+                if (TypeFilter != EResourceType::None && Entry.ResourceType != TypeFilter)
+                {
+                    continue;
+                }
+
+                if (FVector::DistSquared(Entry.Location, Center) > RadiusSquared)
+                {
+                    continue;
+                }
+
+                if (AHSResourceNode* Node = Entry.Node.Get())
+                {
+                    OutNodes.Add(Node);
+                }
+            }
+        }
+    }
+
+    return OutNodes.Num();
+}
+
+FIntPoint UHSResourceNodeRegistry::GetCellCoord(const FVector& Location) const
+{
+    return FIntPoint(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize)
+    );
+}
+
+void UHSResourceNodeRegistry::RemoveFromCell(const FIntPoint& CellCoord, const AHSResourceNode* Node)
+{
+    TArray<FHSResourceNodeGridEntry>* CellEntries = Cells.Find(CellCoord);
+    if (!CellEntries)
+    {
+        return;
+    }
+
+    for (int32 Index = 0; Index < CellEntries->Num(); ++Index)
+    {
+        // 파괴 진행 중인 노드도 식별되도록 약참조 자체를 비교
+        if ((*CellEntries)[Index].Node == Node)
+        {
+            CellEntries->RemoveAtSwap(Index, 1, false);
+            break;
+        }
+    }
+
+    if (CellEntries->Num() == 0)
+    {
+        Cells.Remove(CellCoord);
+    }
+}
@@ -0,0 +1,81 @@
+// HSResourceNodeRegistry.h
+// 월드 내 채집 가능한 자원 노드를 2D 그리드로 관리하는 월드 서브시스템
+// 물리 오버랩 없이 셀 단위 조회로 주변 자원 노드를 검색
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HSResourceNode.h"
+#include "HSResourceNodeRegistry.generated.h"
+
+// 그리드 셀에 저장되는 노드 엔트리 (조회 시 액터 메모리 접근 최소화)
+struct FHSResourceNodeGridEntry
+{
+    TWeakObjectPtr<AHSResourceNode> Node;
+    FVector Location = FVector::ZeroVector;
+    EResourceType ResourceType = EResourceType::None;
+};
+
+/**
+ * 자원 노드 공간 레지스트리
+ * - 청크가 노드를 스폰/풀에서 꺼낼 때 등록, 고갈/청크 언로드 시 해제
+ * - XY 평면 균일 그리드로 반경 조회, 자원 타입 필터 지원
+ */
+UCLASS()
+class HUNTINGSPIRIT_API UHSResourceNodeRegistry : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem 인터페이스
+    virtual void Deinitialize() override;
+
+    /**
+     * 자원 노드를 현재 위치의 셀에 등록합니다 (이미 등록된 경우 위치 갱신)
+     * @param Node 등록할 자원 노드
+     */
+    void RegisterNode(AHSResourceNode* Node);
+
+    /**
+     * 자원 노드를 그리드에서 제거합니다
+     * @param Node 제거할 자원 노드
+     */
+    void UnregisterNode(AHSResourceNode* Node);
+
+    /**
+     * 반경 내 등록된 자원 노드를 조회합니다
+     * @param Center 조회 중심
+     * @param Radius 조회 반경
+     * @param TypeFilter 자원 타입 필터 (None이면 전체)
+     * @param OutNodes 결과 노드 목록
+     * @return 찾은 노드 수
+     */
+    int32 QueryNodesInRadius(const FVector& Center, float Radius, EResourceType TypeFilter, TArray<AHSResourceNode*>& OutNodes) const;
+
+    // 통계
+    int32 GetRegisteredNodeCount() const { return NodeCells.Num(); }
+    int32 GetLastQueryCellsVisited() const { return LastQueryCellsVisited; }
+    int32 GetLastQueryEntriesTested() const { return LastQueryEntriesTested; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    FIntPoint GetCellCoord(const FVector& Location) const;
+    void RemoveFromCell(const FIntPoint& CellCoord, const AHSResourceNode* Node);
+
+    // 셀 크기 (기본 채집 감지 범위와 동일)
+    static constexpr float CellSize = 1000.0f;
+
+    // 셀 좌표 -> 노드 엔트리
+    TMap<FIntPoint, TArray<FHSResourceNodeGridEntry>> Cells;
+
+    // 노드 -> 등록된 셀 좌표
+    TMap<TObjectKey<AHSResourceNode>, FIntPoint> NodeCells;
+
+    // 마지막 조회 비용
+    mutable int32 LastQueryCellsVisited = 0;
+    mutable int32 LastQueryEntriesTested = 0;
+};